@@ -11,17 +11,94 @@
 
 #include"DCmotor.h"
 
+/*******************************************************************************
+ *                       Motors Configuration                                  *
+ *******************************************************************************/
 
+/*
+ * One descriptor for every motor, to add a motor increase
+ * DC_MOTOR_NUMBER_OF_MOTORS and add its pins here, example for a second
+ * motor on OC2:
+ * {&DDRB, &PORTB, &PINB, PB4, PB5, &DDRD, PD7, DC_MOTOR_PWM_OC2}
+ */
+const DcMotor_ConfigType g_DcMotor_config[DC_MOTOR_NUMBER_OF_MOTORS] =
+{
+		{
+				&DC_MOTOR_DIRECTION_PORT, &DC_MOTOR_DATA_PORT, &DC_MOTOR_PIN_PORT,
+				DC_MOTOR_PIN_IN1, DC_MOTOR_PIN_IN2,
+				&DC_MOTOR_ENABLE_DIRECTION_PORT, DC_MOTOR_PIN_EN1,
+				DC_MOTOR_PWM_OC0
+		}
+};
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: return the IN1/IN2 pattern of the required direction
+ */
+static uint8 DC_motor_directionPattern(const DcMotor_ConfigType *motor_Ptr, DcMotor_Direction direction)
+{
+	switch(direction)
+	{
+	case DC_MOTOR_CLOCKWISE:
+		return (1<<(motor_Ptr->in2Pin));
+
+	case DC_MOTOR_ANTI_CLOCKWISE:
+		return (1<<(motor_Ptr->in1Pin));
+
+	default:
+		return 0;
+	}
+}
+
+/*
+ * Description: write the compare register of the PWM channel
+ * must be called with interrupts disabled as OCR1A/OCR1B are 16-bit registers
+ */
+static void DC_motor_writeCompare(DcMotor_PwmChannel channel, uint16 duty)
+{
+	switch(channel)
+	{
+	case DC_MOTOR_PWM_OC0:
+		TIMER0_OUTPUT_COMPARE_REGISTER = duty & 0XFF;
+		break;
+
+	case DC_MOTOR_PWM_OC1A:
+		TIMER1_OUTPUT_COMPARE_REGISTER_A = duty;
+		break;
+
+	case DC_MOTOR_PWM_OC1B:
+		TIMER1_OUTPUT_COMPARE_REGISTER_B = duty;
+		break;
+
+	case DC_MOTOR_PWM_OC2:
+		TIMER2_OUTPUT_COMPARE_REGISTER = duty & 0XFF;
+		break;
+	}
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
 
 void DC_motor_Init(void)
 {
-	DC_MOTOR_DIRECTION_PORT = SET_BIT(DC_MOTOR_DIRECTION_PORT , DC_MOTOR_PIN_IN1);
-	DC_MOTOR_DIRECTION_PORT = SET_BIT(DC_MOTOR_DIRECTION_PORT , DC_MOTOR_PIN_IN2);
+	uint8 motor_id;
+
+	for(motor_id = 0; motor_id < DC_MOTOR_NUMBER_OF_MOTORS; motor_id++)
+	{
+		const DcMotor_ConfigType *motor_Ptr = &g_DcMotor_config[motor_id];
+
+		/*configure IN1/IN2 as output pins in one write*/
+		*(motor_Ptr->directionPort) |= (1<<(motor_Ptr->in1Pin)) | (1<<(motor_Ptr->in2Pin));
 
 #if ENABLE_PIN_CONNECTED_TO_MICRO
 
-	DC_MOTOR_ENABLE_DIRECTION_PORT = SET_BIT(DC_MOTOR_ENABLE_DIRECTION_PORT , DC_MOTOR_PIN_EN1);
+		*(motor_Ptr->enableDirectionPort) |= (1<<(motor_Ptr->enablePin));
 #endif
+	}
 }
 /***************************************************************************************************
  * [Function Name]: motor_on_ClockWise
@@ -39,8 +116,7 @@ void DC_motor_Init(void)
 
 void DC_motor_on_ClockWise(void)
 {
-	DC_MOTOR_DATA_PORT = CLEAR_BIT(DC_MOTOR_DATA_PORT , DC_MOTOR_PIN_IN1);
-	DC_MOTOR_DATA_PORT = SET_BIT(DC_MOTOR_DATA_PORT , DC_MOTOR_PIN_IN2);
+	DC_motor_setDirection(DC_MOTOR_0, DC_MOTOR_CLOCKWISE);
 
 }/*End of motor_onClockWise*/
 
@@ -60,8 +136,7 @@ void DC_motor_on_ClockWise(void)
 
 void DC_motor_onAnti_ClockWise(void)
 {
-	DC_MOTOR_DATA_PORT = CLEAR_BIT( DC_MOTOR_DATA_PORT, DC_MOTOR_PIN_IN2);
-	DC_MOTOR_DATA_PORT = SET_BIT (DC_MOTOR_DATA_PORT, DC_MOTOR_PIN_IN1);
+	DC_motor_setDirection(DC_MOTOR_0, DC_MOTOR_ANTI_CLOCKWISE);
 
 }/*End of motor_onClockWise*/
 
@@ -80,8 +155,278 @@ void DC_motor_onAnti_ClockWise(void)
  ***************************************************************************************************/
 void DC_motor_on_Stop(void)
 {
-	DC_MOTOR_DATA_PORT = CLEAR_BIT(DC_MOTOR_DATA_PORT , DC_MOTOR_PIN_IN2);
-	DC_MOTOR_DATA_PORT = CLEAR_BIT( DC_MOTOR_DATA_PORT, DC_MOTOR_PIN_IN1);
+	DC_motor_setDirection(DC_MOTOR_0, DC_MOTOR_STOP);
 
 }/*End of motor_onClockWise*/
+
+/***************************************************************************************************
+ * [Function Name]: DC_motor_setDirection
+ *
+ * [Description]:  Function to change the direction of one motor
+ *                 IN1/IN2 are changed together by one write to the data port
+ *
+ * [Args]:         motor_id, direction
+ *
+ * [In]            motor_id:  -Index of the motor in g_DcMotor_config
+ *
+ *                 direction: -Variable from type enum DcMotor_Direction
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void DC_motor_setDirection(uint8 motor_id, DcMotor_Direction direction)
+{
+	const DcMotor_ConfigType *motor_Ptr = &g_DcMotor_config[motor_id];
+	uint8 mask = (1<<(motor_Ptr->in1Pin)) | (1<<(motor_Ptr->in2Pin));
+	uint8 pattern = DC_motor_directionPattern(motor_Ptr, direction);
+	uint8 sreg = SREG;
+
+	/*
+	 * The port may be shared with other drivers working from interrupts,
+	 * so the read-modify-write is done with interrupts disabled
+	 */
+	cli();
+	*(motor_Ptr->dataPort) = (*(motor_Ptr->dataPort) & (~mask)) | pattern;
+	SREG = sreg;
+
+}/*End of DC_motor_setDirection*/
+
+/***************************************************************************************************
+ * [Function Name]: DC_motor_getDirection
+ *
+ * [Description]:  Function to read the current direction of one motor
+ *                 from its IN1/IN2 pins
+ *
+ * [Args]:         motor_id
+ *
+ * [In]            motor_id: -Index of the motor in g_DcMotor_config
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Direction of the motor
+ ***************************************************************************************************/
+DcMotor_Direction DC_motor_getDirection(uint8 motor_id)
+{
+	const DcMotor_ConfigType *motor_Ptr = &g_DcMotor_config[motor_id];
+	uint8 pins = *(motor_Ptr->pinPort);
+
+	if( BIT_IS_CLEAR(pins, motor_Ptr->in1Pin) && BIT_IS_SET(pins, motor_Ptr->in2Pin) )
+	{
+		return DC_MOTOR_CLOCKWISE;
+	}
+	else if( BIT_IS_SET(pins, motor_Ptr->in1Pin) && BIT_IS_CLEAR(pins, motor_Ptr->in2Pin) )
+	{
+		return DC_MOTOR_ANTI_CLOCKWISE;
+	}
+
+	return DC_MOTOR_STOP;
+
+}/*End of DC_motor_getDirection*/
+
+/***************************************************************************************************
+ * [Function Name]: DC_motor_setDirectionAll
+ *
+ * [Description]:  Function to change the direction of all the motors
+ *                 motors sharing the same port are updated by one port write
+ *
+ * [Args]:         directions
+ *
+ * [In]            directions: -Array of DC_MOTOR_NUMBER_OF_MOTORS directions
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void DC_motor_setDirectionAll(const DcMotor_Direction *directions)
+{
+	volatile uint8 *ports[DC_MOTOR_NUMBER_OF_MOTORS];
+	uint8 masks[DC_MOTOR_NUMBER_OF_MOTORS];
+	uint8 patterns[DC_MOTOR_NUMBER_OF_MOTORS];
+	uint8 ports_count = 0;
+	uint8 motor_id;
+	uint8 port_index;
+	uint8 sreg;
+
+	/*Collect the IN1/IN2 bits of all the motors grouped by their data port*/
+	for(motor_id = 0; motor_id < DC_MOTOR_NUMBER_OF_MOTORS; motor_id++)
+	{
+		const DcMotor_ConfigType *motor_Ptr = &g_DcMotor_config[motor_id];
+
+		for(port_index = 0; port_index < ports_count; port_index++)
+		{
+			if(ports[port_index] == motor_Ptr->dataPort)
+			{
+				break;
+			}
+		}
+
+		if(port_index == ports_count)
+		{
+			ports[port_index] = motor_Ptr->dataPort;
+			masks[port_index] = 0;
+			patterns[port_index] = 0;
+			ports_count++;
+		}
+
+		masks[port_index] |= (1<<(motor_Ptr->in1Pin)) | (1<<(motor_Ptr->in2Pin));
+		patterns[port_index] |= DC_motor_directionPattern(motor_Ptr, directions[motor_id]);
+	}
+
+	/*One write for every port*/
+	sreg = SREG;
+	cli();
+	for(port_index = 0; port_index < ports_count; port_index++)
+	{
+		*(ports[port_index]) = (*(ports[port_index]) & (~masks[port_index])) | patterns[port_index];
+	}
+	SREG = sreg;
+
+}/*End of DC_motor_setDirectionAll*/
+
+/***************************************************************************************************
+ * [Function Name]: DC_motor_setDuty
+ *
+ * [Description]:  Function to change the duty of one motor
+ *
+ * [Args]:         motor_id, duty
+ *
+ * [In]            motor_id: -Index of the motor in g_DcMotor_config
+ *
+ *                 duty:     -Compare value of the PWM channel of the motor
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void DC_motor_setDuty(uint8 motor_id, uint16 duty)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	DC_motor_writeCompare(g_DcMotor_config[motor_id].pwmChannel, duty);
+	SREG = sreg;
+
+}/*End of DC_motor_setDuty*/
+
+/***************************************************************************************************
+ * [Function Name]: DC_motor_setDutyAll
+ *
+ * [Description]:  Function to change the duty of all the motors
+ *                 The compare registers are double buffered in PWM modes, all of
+ *                 them are written in one critical section at the start of the
+ *                 PWM period so they take effect at the same PWM boundary
+ *
+ * [Args]:         duties
+ *
+ * [In]            duties: -Array of DC_MOTOR_NUMBER_OF_MOTORS compare values
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void DC_motor_setDutyAll(const uint16 *duties)
+{
+	uint8 motor_id;
+	uint8 sreg = SREG;
+
+	cli();
+
+#if (DC_MOTOR_DUTY_SYNC_TO_PWM_BOUNDARY != DISABLE)
+	/*
+	 * Wait for the first half of the PWM period, the writes below take few
+	 * cycles so they can't straddle the next update of the compare registers
+	 * The interrupts run between two checks, the last check is made with
+	 * them masked: an interrupt can't push the writes out of the window
+	 * The clock is checked every time, an interrupt may stop Timer0
+	 */
+	while( (TIMER0_INITIAL_VALUE_REGISTER >= DC_MOTOR_DUTY_SAFE_WINDOW) && DC_MOTOR_TIMER0_PRESCALED() )
+	{
+		SREG = sreg;
+		cli();
+	}
+#endif
+
+	for(motor_id = 0; motor_id < DC_MOTOR_NUMBER_OF_MOTORS; motor_id++)
+	{
+		DC_motor_writeCompare(g_DcMotor_config[motor_id].pwmChannel, duties[motor_id]);
+	}
+	SREG = sreg;
+
+}/*End of DC_motor_setDutyAll*/
+
+/***************************************************************************************************
+ * [Function Name]: DC_motor_stopAll
+ *
+ * [Description]:  Function to stop all the motors
+ *                 zero duty and IN1 = IN2 = 0 for every motor
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void DC_motor_stopAll(void)
+{
+	DcMotor_Direction directions[DC_MOTOR_NUMBER_OF_MOTORS];
+	uint16 duties[DC_MOTOR_NUMBER_OF_MOTORS];
+	uint8 motor_id;
+	uint8 sreg = SREG;
+
+	for(motor_id = 0; motor_id < DC_MOTOR_NUMBER_OF_MOTORS; motor_id++)
+	{
+		directions[motor_id] = DC_MOTOR_STOP;
+		duties[motor_id] = 0;
+	}
+
+	/*Stopping must not wait for the PWM boundary, write the duties directly*/
+	cli();
+	for(motor_id = 0; motor_id < DC_MOTOR_NUMBER_OF_MOTORS; motor_id++)
+	{
+		DC_motor_writeCompare(g_DcMotor_config[motor_id].pwmChannel, duties[motor_id]);
+	}
+	SREG = sreg;
+
+	DC_motor_setDirectionAll(directions);
+
+}/*End of DC_motor_stopAll*/
+
+/***************************************************************************************************
+ * [Function Name]: DC_motor_syncPwmTimers
+ *
+ * [Description]:  Function to align the PWM periods of Timer0, Timer1 and Timer2
+ *                 Resets the prescalers and the counters back to back so the
+ *                 channels of the different timers share the same PWM boundary
+ *                 Timer2 is left running unless DC_MOTOR_SYNC_TIMER2
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void DC_motor_syncPwmTimers(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	TIMER0_INITIAL_VALUE_REGISTER = 0;
+	TIMER1_INITIAL_VALUE_REGISTER = 0;
+#if (DC_MOTOR_SYNC_TIMER2 != DISABLE)
+	TIMER2_INITIAL_VALUE_REGISTER = 0;
+
+	/*Reset the prescaler of Timer0/Timer1 (PSR10) and Timer2 (PSR2) together*/
+	SFIOR |= (1<<PSR10) | (1<<PSR2);
+#else
+	/*Timer2 is the system tick, only the prescaler of Timer0/Timer1 (PSR10)*/
+	SFIOR |= (1<<PSR10);
+#endif
+	SREG = sreg;
+
+}/*End of DC_motor_syncPwmTimers*/
 /**************************************************************************************************/
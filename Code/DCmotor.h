@@ -14,6 +14,7 @@
 #include "std_types.h"
 #include "micro_config.h"
 #include "common_macros.h"
+#include "timers.h"
 
 
 /*******************************************************************************
@@ -24,6 +25,10 @@
 #define DISABLE                                 FALSE
 #define ENABLE_PIN_CONNECTED_TO_MICRO          ENABLE
 
+/*
+ * Pins of the first motor (DC_MOTOR_0), kept as macros because the
+ * application reads them directly and the single motor API works on them
+ */
 #define DC_MOTOR_DIRECTION_PORT                  DDRB
 #define DC_MOTOR_DATA_PORT                       PORTB
 #define DC_MOTOR_PIN_PORT                        PINB
@@ -37,7 +42,85 @@
 
 #define DC_MOTOR_PIN_EN1                         PB3
 
+/*
+ * Number of motors described in g_DcMotor_config (DCmotor.c)
+ * one motor for every PWM channel so four motors at most
+ */
+#define DC_MOTOR_MAX_NUMBER_OF_MOTORS            4
+#define DC_MOTOR_NUMBER_OF_MOTORS                1
 
+#define DC_MOTOR_0                               0
+#define DC_MOTOR_1                               1
+#define DC_MOTOR_2                               2
+#define DC_MOTOR_3                               3
+
+/*
+ * Wait until the Timer0 counter is inside the first part of the PWM period
+ * before writing the batch of duties, so all the compare registers are
+ * latched by the hardware at the same PWM boundary
+ */
+#define DC_MOTOR_DUTY_SYNC_TO_PWM_BOUNDARY       ENABLE
+#define DC_MOTOR_DUTY_SAFE_WINDOW                0X80
+
+/*
+ * The wait lasts while Timer0 counts the CPU clock through its prescaler
+ * (F_CPU_CLOCK to F_CPU_1024): the window comes within one PWM period
+ * whatever the prescaler. Stopped or clocked by the T0 pin, the counter may
+ * never enter it, the duties are written at once
+ */
+#define DC_MOTOR_TIMER0_PRESCALED() \
+	( ((TIMER0_CONTROL_REGIRSTER & (~TIMER0_CLOCK_MASK_CLEAR)) >= F_CPU_CLOCK) && \
+	  ((TIMER0_CONTROL_REGIRSTER & (~TIMER0_CLOCK_MASK_CLEAR)) <= F_CPU_1024) )
+
+/*
+ * Timer2 is the system tick of the application (main.c), not a PWM: its
+ * counter is left alone by DC_motor_syncPwmTimers, enable it on a board
+ * with a motor on OC2 and the tick elsewhere
+ */
+#define DC_MOTOR_SYNC_TIMER2                     DISABLE
+
+#if (DC_MOTOR_NUMBER_OF_MOTORS > DC_MOTOR_MAX_NUMBER_OF_MOTORS)
+#error "DC motor driver supports four motors at most (OC0, OC1A, OC1B, OC2)"
+#endif
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	DC_MOTOR_PWM_OC0, DC_MOTOR_PWM_OC1A, DC_MOTOR_PWM_OC1B, DC_MOTOR_PWM_OC2
+
+}DcMotor_PwmChannel;
+
+typedef enum
+{
+	DC_MOTOR_STOP, DC_MOTOR_CLOCKWISE, DC_MOTOR_ANTI_CLOCKWISE
+
+}DcMotor_Direction;
+
+/*
+ * Description of one motor, all descriptors are constant and
+ * listed in g_DcMotor_config
+ */
+typedef struct
+{
+	volatile uint8 *directionPort;
+	volatile uint8 *dataPort;
+	volatile uint8 *pinPort;
+	uint8 in1Pin;
+	uint8 in2Pin;
+	volatile uint8 *enableDirectionPort;
+	uint8 enablePin;
+	DcMotor_PwmChannel pwmChannel;
+
+}DcMotor_ConfigType;
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+extern const DcMotor_ConfigType g_DcMotor_config[DC_MOTOR_NUMBER_OF_MOTORS];
 
 /*******************************************************************************
  *                      Functions Prototypes                                   *
@@ -46,7 +129,7 @@
  * [Function Name]: DC_motor_Init
  *
  * [Description]:  Function to initialize the DC motor
- *                 configure the pins of the motor as output pins
+ *                 configure the pins of all the motors as output pins
  *
  * [Args]:         NONE
  *
@@ -99,6 +182,121 @@ void DC_motor_onAnti_ClockWise(void);
  * [Returns]:      NONE
  *********************************************************************************/
 void DC_motor_on_Stop(void);
+/*********************************************************************************
+ * [Function Name]: DC_motor_setDirection
+ *
+ * [Description]:  Function to change the direction of one motor
+ *                 IN1/IN2 are changed together by one write to the data port
+ *
+ * [Args]:         motor_id, direction
+ *
+ * [In]            motor_id:  -Index of the motor in g_DcMotor_config
+ *
+ *                 direction: -Variable from type enum DcMotor_Direction
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ *********************************************************************************/
+void DC_motor_setDirection(uint8 motor_id, DcMotor_Direction direction);
+/*********************************************************************************
+ * [Function Name]: DC_motor_getDirection
+ *
+ * [Description]:  Function to read the current direction of one motor
+ *                 from its IN1/IN2 pins
+ *
+ * [Args]:         motor_id
+ *
+ * [In]            motor_id: -Index of the motor in g_DcMotor_config
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Direction of the motor
+ *********************************************************************************/
+DcMotor_Direction DC_motor_getDirection(uint8 motor_id);
+/*********************************************************************************
+ * [Function Name]: DC_motor_setDirectionAll
+ *
+ * [Description]:  Function to change the direction of all the motors
+ *                 motors sharing the same port are updated by one port write
+ *
+ * [Args]:         directions
+ *
+ * [In]            directions: -Array of DC_MOTOR_NUMBER_OF_MOTORS directions
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ *********************************************************************************/
+void DC_motor_setDirectionAll(const DcMotor_Direction *directions);
+/*********************************************************************************
+ * [Function Name]: DC_motor_setDuty
+ *
+ * [Description]:  Function to change the duty of one motor
+ *
+ * [Args]:         motor_id, duty
+ *
+ * [In]            motor_id: -Index of the motor in g_DcMotor_config
+ *
+ *                 duty:     -Compare value of the PWM channel of the motor
+ *                            (0:255 for OC0/OC2, 0:ICR1 for OC1A/OC1B)
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ *********************************************************************************/
+void DC_motor_setDuty(uint8 motor_id, uint16 duty);
+/*********************************************************************************
+ * [Function Name]: DC_motor_setDutyAll
+ *
+ * [Description]:  Function to change the duty of all the motors
+ *                 The compare registers are double buffered in PWM modes, all of
+ *                 them are written in one critical section at the start of the
+ *                 PWM period so they take effect at the same PWM boundary
+ *
+ * [Args]:         duties
+ *
+ * [In]            duties: -Array of DC_MOTOR_NUMBER_OF_MOTORS compare values
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ *********************************************************************************/
+void DC_motor_setDutyAll(const uint16 *duties);
+/*********************************************************************************
+ * [Function Name]: DC_motor_stopAll
+ *
+ * [Description]:  Function to stop all the motors
+ *                 zero duty and IN1 = IN2 = 0 for every motor
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ *********************************************************************************/
+void DC_motor_stopAll(void);
+/*********************************************************************************
+ * [Function Name]: DC_motor_syncPwmTimers
+ *
+ * [Description]:  Function to align the PWM periods of Timer0, Timer1 and Timer2
+ *                 Resets the prescalers and the counters back to back so the
+ *                 channels of the different timers share the same PWM boundary
+ *                 (The timers must be configured with the same clock and TOP)
+ *                 Timer2 only with DC_MOTOR_SYNC_TIMER2: reset, the 4 ms tick
+ *                 would come late once
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ *********************************************************************************/
+void DC_motor_syncPwmTimers(void);
 
 
 #endif /* DCMOTOR_H_ */
@@ -1,5 +1,63 @@
 
 #include "adc.h"
+#include "event_queue.h"
+#include "isr_instrumentation.h"
+#include "power.h"
+#include "profiler.h"
+#include "shared_state.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static volatile uint16 g_adcResult = 0;
+static SharedState_SequenceType g_adcSequence = 0; /* publications of g_adcResult */
+static volatile bool g_adcComplete = FALSE;
+static volatile uint8 g_adcChannel = 0;
+static volatile bool g_adcPost = TRUE;
+
+/*******************************************************************************
+ *                       Interrupt Service Routines                            *
+ *******************************************************************************/
+
+ISR(ADC_vect)
+{
+	ISR_INSTR_ENTRY(ISR_ID_ADC);
+
+	uint16 result = ADC; /* ADIF is cleared by hardware when the interrupt is executed */
+
+	g_adcResult = result;
+	SHARED_STATE_PUBLISH(g_adcSequence);
+	g_adcComplete = TRUE;
+
+#if (ADC_POST_EVENTS != DISABLE)
+	if(g_adcPost) /* the caller of ADC_readChannelSleep waits for the result */
+	{
+		EventQueue_post(EVENT_ADC_COMPLETE, result | ((uint16)g_adcChannel << EVENT_ADC_CHANNEL_SHIFT));
+	}
+#endif
+
+	ISR_INSTR_EXIT(ISR_ID_ADC);
+}
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: start an interrupt driven conversion, posted to the event
+ *              queue or not
+ */
+static void ADC_start(uint8 channel_num, bool post)
+{
+	channel_num &= 0x07; /* channel number must be from 0 --> 7 */
+	g_adcChannel = channel_num;
+	g_adcComplete = FALSE;
+	g_adcPost = post;
+	ADMUX = (ADMUX & 0xE0) | channel_num; /* choose the channel in MUX4:0 bits */
+	SET_BIT(ADCSRA,ADIF); /* clear any old flag so the interrupt belongs to this conversion */
+	ADCSRA |= (1<<ADIE) | (1<<ADSC); /* enable the ADC interrupt and start conversion */
+}
 
 /*******************************************************************************
  *                      Functions Definitions                                  *
@@ -24,11 +82,60 @@ void ADC_init(void)
 
 uint16 ADC_readChannel(uint8 channel_num)
 {
+	PROFILE_ENTER(PROFILER_ID_ADC_READ);
 	channel_num &= 0x07; /* channel number must be from 0 --> 7 */
 	ADMUX &= 0xE0; /* clear first 5 bits in the ADMUX (channel number MUX4:0 bits) before set the required channel */
 	ADMUX = ADMUX | channel_num; /* choose the correct channel by setting the channel number in MUX4:0 bits */
+	CLEAR_BIT(ADCSRA,ADIE); /* polling conversion, the ADC interrupt must not take the flag */
 	SET_BIT(ADCSRA,ADSC); /* start conversion write '1' to ADSC */
-	while(BIT_IS_CLEAR(ADCSRA,ADIF)); /* wait for conversion to complete ADIF becomes '1' */
+	{
+		/* time of the busy wait, in the instrumentation table as a vector */
+		ISR_INSTR_ENTRY(ISR_ID_ADC_WAIT);
+		while(BIT_IS_CLEAR(ADCSRA,ADIF)); /* wait for conversion to complete ADIF becomes '1' */
+		ISR_INSTR_EXIT(ISR_ID_ADC_WAIT);
+	}
 	SET_BIT(ADCSRA,ADIF); /* clear ADIF by write '1' to it :) */
+	PROFILE_EXIT(PROFILER_ID_ADC_READ);
 	return ADC; /* return the data register */
 }
+
+void ADC_startConversion(uint8 channel_num)
+{
+	ADC_start(channel_num, TRUE);
+}
+
+uint16 ADC_readChannelSleep(uint8 channel_num)
+{
+	uint8 sreg = SREG;
+
+	PROFILE_ENTER(PROFILER_ID_ADC_READ);
+	ADC_start(channel_num, FALSE);
+	{
+		/* time of the wait, the CPU sleeps until the ADC interrupt */
+		ISR_INSTR_ENTRY(ISR_ID_ADC_WAIT);
+		cli();
+		while(!g_adcComplete)
+		{
+			Power_sleep(POWER_ADC_SLEEP_MODE); /* other interrupts wake it too */
+		}
+		SREG = sreg;
+		ISR_INSTR_EXIT(ISR_ID_ADC_WAIT);
+	}
+	PROFILE_EXIT(PROFILER_ID_ADC_READ);
+	return g_adcResult; /* no other conversion, the interrupt doesn't write it */
+}
+
+bool ADC_isConversionComplete(void)
+{
+	return g_adcComplete;
+}
+
+uint16 ADC_getResult(void)
+{
+	uint16 result;
+
+	/* 16-bit variable written by the ADC interrupt, the interrupts stay enabled */
+	SHARED_STATE_READ(g_adcSequence, result = g_adcResult);
+
+	return result;
+}
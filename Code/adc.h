@@ -7,6 +7,22 @@
 #include "std_types.h"
 #include "common_macros.h"
 
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define ENABLE                                   TRUE
+#define DISABLE                                  FALSE
+
+/*
+ * Conversions started by ADC_startConversion complete in the ADC interrupt
+ * which posts EVENT_ADC_COMPLETE (payload = channel and result) to the
+ * event queue. Only with a consumer of the queue (EventQueue_get in the main
+ * loop), none in this application: the speed group reads ADC_getResult and
+ * the events would only fill the queue and count overflows
+ */
+#define ADC_POST_EVENTS                          DISABLE
+
 /*******************************************************************************
  *                      Functions Prototypes                                   *
  *******************************************************************************/
@@ -24,4 +40,33 @@ void ADC_init(void);
  */
 uint16 ADC_readChannel(uint8 channel_num);
 
+/*
+ * Description :
+ * Function responsible for read analog data from a certain ADC channel
+ * sleeping until the conversion completes (POWER_ADC_SLEEP_MODE of power.h),
+ * the interrupts are enabled during the wait.
+ */
+uint16 ADC_readChannelSleep(uint8 channel_num);
+
+/*
+ * Description :
+ * Function responsible for starting a conversion on a certain ADC channel
+ * without waiting, the ADC interrupt stores the result when it completes.
+ */
+void ADC_startConversion(uint8 channel_num);
+
+/*
+ * Description :
+ * Function responsible for checking if the conversion started by
+ * ADC_startConversion is completed.
+ */
+bool ADC_isConversionComplete(void);
+
+/*
+ * Description :
+ * Function responsible for returning the result of the last conversion
+ * started by ADC_startConversion.
+ */
+uint16 ADC_getResult(void);
+
 #endif /* ADC_H_ */
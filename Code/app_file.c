@@ -10,6 +10,467 @@
 
 #include"app_file.h"
 
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/* Last sample of the potentiometer */
+typedef struct
+{
+	uint16 adc;
+	uint8 duty;
+
+}App_SampleType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Settings in use, written at the tick of the main loop only */
+static App_SettingsType g_appSettings =
+{
+		APP_DEFAULT_SPEED, DC_MOTOR_CLOCKWISE, APP_DEFAULT_RAMP,
+		APP_DEFAULT_GAIN_P, APP_DEFAULT_GAIN_I, APP_DEFAULT_GAIN_D, APP_MODE_LOCAL
+};
+
+/* Settings written by the commands, copied to g_appSettings at the next tick */
+static App_SettingsType g_appSettingsPending;
+static bool g_appSettingsChanged = FALSE;
+
+#if (APP_PERSISTENCE != DISABLE)
+/* Settings changed since the last save, saved once they stay for the delay */
+static bool g_appSettingsDirty = FALSE;
+static uint16 g_appSaveDelay = 0;
+#endif
+
+/* Speed set point after the ramp, read by the speed group (APP_RATE_GROUPS) */
+static uint16 g_appSpeed = 0;
+
+/* Set by the tick interrupt, cleared by the main loop */
+static volatile bool g_appTick = FALSE;
+
+/*
+ * Last sample, written by the main loop, recorded by the tick interrupt
+ * (APP_CAPTURE): two slots, the interrupt reads the one of the index
+ */
+static volatile App_SampleType g_appSample[2];
+static SharedState_SequenceType g_appSampleIndex = 0;
+/*
+ * Publications of the samples: with APP_RATE_GROUPS the speed group writes
+ * them from the overflow interrupt, it can flip the index twice during a
+ * copy of the main loop, which the index alone doesn't show
+ */
+static SharedState_SequenceType g_appSampleSequence = 0;
+
+/* Values on the LCD, out of range to write them the first time */
+static uint16 g_appDisplayed = 0XFFFF;
+#if (APP_SLEEP != DISABLE)
+static uint8 g_appUtilizationShown = 0XFF;
+#endif
+#if (APP_MEMORY_MONITOR != DISABLE)
+static uint16 g_appMemoryShown = 0XFFFF;
+#endif
+#if (APP_MEMORY_MONITOR != DISABLE) && (APP_TELEMETRY != DISABLE)
+/* The sizes of the sections are fixed, sent in the first frame queued only */
+static bool g_appSectionsSent = FALSE;
+#endif
+
+#if (APP_CAPTURE != DISABLE)
+static Capture_ConfigType g_appCapture =
+{
+		APP_CAPTURE_TRIGGER, APP_CAPTURE_CHANNEL, APP_CAPTURE_THRESHOLD, APP_CAPTURE_PRE_TRIGGER
+};
+#endif
+
+#if (APP_OVERCURRENT != DISABLE)
+static const Overcurrent_ConfigType g_appOvercurrent =
+{
+		APP_OVERCURRENT_CHANNEL, APP_OVERCURRENT_NOMINAL, APP_OVERCURRENT_I2T_LIMIT,
+		APP_OVERCURRENT_RETRY_TICKS, APP_OVERCURRENT_MAX_RETRIES, (1<<DC_MOTOR_PWM_OC0)
+};
+#endif
+
+#if (APP_COMMANDS != DISABLE)
+static const CommandParser_EntryType g_appCommands[] =
+{
+		{'S', 0, APP_SPEED_MAX},
+		{'D', DC_MOTOR_STOP, DC_MOTOR_ANTI_CLOCKWISE},
+		{'R', 0, APP_SPEED_MAX},
+		{'P', -32767, 32767},
+		{'I', -32767, 32767},
+		{'K', -32767, 32767},
+		{'M', APP_MODE_LOCAL, APP_MODE_REMOTE},
+#if (APP_CAPTURE != DISABLE)
+		{'C', 0, CAPTURE_SIZE - 1},
+#endif
+#if (APP_AUTOTUNE != DISABLE)
+		{'T', 1, APP_AUTOTUNE_SPEED_MAX},
+#endif
+};
+#endif
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+#if (APP_TELEMETRY != DISABLE) || (APP_AUTOTUNE != DISABLE) || (APP_RATE_GROUPS != DISABLE)
+/*
+ * Description: copy the last sample outside of the interrupts, again if a
+ *              new one was published meanwhile
+ */
+static void App_getSample(App_SampleType * sample_Ptr)
+{
+	uint8 slot;
+
+	SHARED_STATE_READ(g_appSampleSequence,
+			slot = g_appSampleIndex;
+			sample_Ptr->adc = g_appSample[slot].adc;
+			sample_Ptr->duty = g_appSample[slot].duty);
+}
+#endif
+
+#if (APP_AUTOTUNE != DISABLE)
+/*
+ * Description: start the relay around the duty in use, kept in the range
+ *              of the relay, the duty in use comes back at the end
+ */
+static void App_startAutotune(sint16 speed)
+{
+	Autotune_ConfigType autotune;
+	App_SampleType last;
+	uint8 duty;
+
+	App_getSample(&last);
+	duty = last.duty;
+
+	autotune.setpoint = speed;
+	autotune.hysteresis = APP_AUTOTUNE_HYSTERESIS;
+	autotune.bias = (duty < APP_AUTOTUNE_AMPLITUDE) ? APP_AUTOTUNE_AMPLITUDE :
+			((duty > (0XFF - APP_AUTOTUNE_AMPLITUDE)) ? (0XFF - APP_AUTOTUNE_AMPLITUDE) : duty);
+	autotune.amplitude = APP_AUTOTUNE_AMPLITUDE;
+	autotune.revert = duty;
+	autotune.timeout_ticks = APP_AUTOTUNE_TIMEOUT_TICKS;
+	autotune.timer_ID = Timer0;
+	autotune.channel = ChannelA;
+	(void)Autotune_start(&autotune); /* ignored while running */
+}
+
+/*
+ * Description: take the gains of a finished auto tuning, they are applied
+ *              and saved at the next tick like the commanded ones
+ */
+static void App_autotuneTick(void)
+{
+	Autotune_StateType state = Autotune_getState();
+	Autotune_ResultType result;
+	Autotune_GainsType gains;
+
+	if( (state == AUTOTUNE_DONE) && Autotune_getResult(&result) &&
+			Autotune_computeGains(&result, APP_AUTOTUNE_RULE, &gains) )
+	{
+		g_appSettingsPending.kp = gains.kp;
+		g_appSettingsPending.ki = gains.ki;
+		g_appSettingsPending.kd = gains.kd;
+		g_appSettingsChanged = TRUE;
+	}
+
+	/* read before, a measure ending meanwhile is not cleared unseen */
+	if( (state == AUTOTUNE_DONE) || (state == AUTOTUNE_FAILED) )
+	{
+		Autotune_clear();
+	}
+}
+#endif
+
+#if (APP_COMMANDS != DISABLE)
+/*
+ * Description: handler of the commands, in range already
+ */
+static bool App_command(uint8 letter, sint16 value)
+{
+	switch(letter)
+	{
+	case 'S': g_appSettingsPending.speed = (uint16)value; break;
+	case 'D': g_appSettingsPending.direction = (uint8)value; break;
+	case 'R': g_appSettingsPending.ramp = (uint16)value; break;
+	case 'P': g_appSettingsPending.kp = value; break;
+	case 'I': g_appSettingsPending.ki = value; break;
+	case 'K': g_appSettingsPending.kd = value; break;
+	case 'M': g_appSettingsPending.mode = (uint8)value; break;
+#if (APP_CAPTURE != DISABLE)
+	case 'C':
+		/* not a setting, armed at once */
+		g_appCapture.pre_trigger = (uint8)value;
+		Capture_init(&g_appCapture);
+		return TRUE;
+#endif
+#if (APP_AUTOTUNE != DISABLE)
+	case 'T':
+		/* not a setting, the gains come at its end */
+		App_startAutotune(value);
+		return TRUE;
+#endif
+	default: return FALSE;
+	}
+
+	g_appSettingsChanged = TRUE;
+
+	return TRUE;
+}
+#endif
+
+#if (APP_PERSISTENCE != DISABLE)
+/*
+ * Description: check the settings of a record, a valid CRC of an older
+ *              firmware with the same version can still hold wrong values
+ */
+static bool App_settingsValid(const App_SettingsType * Settings_Ptr)
+{
+	return (Settings_Ptr->speed <= APP_SPEED_MAX) && (Settings_Ptr->ramp <= APP_SPEED_MAX) &&
+			(Settings_Ptr->direction <= DC_MOTOR_ANTI_CLOCKWISE) && (Settings_Ptr->mode <= APP_MODE_REMOTE);
+}
+
+/*
+ * Description: the settings changed, save them after the delay
+ */
+static void App_settingsChanged(void)
+{
+	g_appSettingsDirty = TRUE;
+	g_appSaveDelay = APP_PERSISTENCE_DELAY_TICKS;
+}
+#endif
+
+/*
+ * Description: work of the main loop once per tick
+ *              - Apply the settings changed by the commands
+ *              - Start their save once they stay unchanged (APP_PERSISTENCE)
+ *              - Sample the motor current for the I^2t (APP_OVERCURRENT)
+ *              - Move the speed toward its set point by the ramp
+ */
+static void App_controlTick(void)
+{
+	uint16 target;
+	uint16 speed = g_appSpeed;
+	uint8 sreg;
+
+	if(g_appSettingsChanged)
+	{
+		g_appSettingsChanged = FALSE;
+		if(g_appSettingsPending.direction != DC_motor_getDirection(DC_MOTOR_0))
+		{
+			DC_motor_setDirection(DC_MOTOR_0, (DcMotor_Direction)g_appSettingsPending.direction);
+		}
+		g_appSettings = g_appSettingsPending;
+#if (APP_PERSISTENCE != DISABLE)
+		App_settingsChanged();
+#endif
+	}
+
+#if (APP_PERSISTENCE != DISABLE)
+	if(g_appSettingsDirty)
+	{
+		if(g_appSaveDelay != 0)
+		{
+			g_appSaveDelay--;
+		}
+		else if(EepromStore_save(&g_appSettings, sizeof(g_appSettings), APP_SETTINGS_VERSION))
+		{
+			g_appSettingsDirty = FALSE; /* written in the background, tried again next tick if busy */
+		}
+	}
+#endif
+
+#if (APP_OVERCURRENT != DISABLE)
+	Overcurrent_update();
+#endif
+
+#if (APP_AUTOTUNE != DISABLE)
+	App_autotuneTick();
+#endif
+
+	target = g_appSettings.speed;
+	if( (g_appSettings.ramp == 0) || (target == speed) )
+	{
+		speed = target;
+	}
+	else if(target > speed)
+	{
+		speed = ((target - speed) > g_appSettings.ramp) ? (speed + g_appSettings.ramp) : target;
+	}
+	else
+	{
+		speed = ((speed - target) > g_appSettings.ramp) ? (speed - g_appSettings.ramp) : target;
+	}
+
+	sreg = SREG;
+	cli(); /* the speed group must not see half of the value */
+	g_appSpeed = speed;
+	SREG = sreg;
+}
+
+/*
+ * Description: update the duty from a value of the potentiometer
+ */
+static void App_applySample(uint16 res_value)
+{
+	uint8 duty;
+	volatile App_SampleType *sample_Ptr;
+
+	/*Timer0 is 8-bit mode so the value of the resistance goes through
+	 * the duty curve to get the range of 0:255 matching the motor response*/
+	duty = DutyCurve_map( (g_appSettings.mode == APP_MODE_REMOTE) ? g_appSpeed : res_value );
+#if (APP_AUTOTUNE != DISABLE)
+	/* the relay owns the duty meanwhile */
+	if(Autotune_getState() != AUTOTUNE_RUNNING)
+#endif
+	{
+		Timer_changeCompareValue(Timer0, duty, 0);
+	}
+
+	/* the tick interrupt reads the other slot, never half of the sample */
+	sample_Ptr = &g_appSample[SHARED_STATE_WRITE_SLOT(g_appSampleIndex)];
+	sample_Ptr->adc = res_value;
+	sample_Ptr->duty = duty;
+	SHARED_STATE_FLIP(g_appSampleIndex);
+	SHARED_STATE_PUBLISH(g_appSampleSequence);
+}
+
+/*
+ * Description: display a value of the potentiometer
+ *              The LCD costs milliseconds, it is written for a new value only
+ */
+static void App_showSample(uint16 res_value)
+{
+	if(res_value != g_appDisplayed)
+	{
+		g_appDisplayed = res_value;
+		LCD_goToRowColumn(0,12); /* display the number at this position */
+		LCD_intgerToString(res_value); /* display the ADC value on LCD screen */
+	}
+}
+
+#if (APP_RATE_GROUPS == DISABLE)
+/*
+ * Description: read the potentiometer, update the duty then the display
+ */
+static void App_sample(void)
+{
+	/*Variable to store the value of ADC */
+	uint16 res_value;
+
+#if (APP_SLEEP != DISABLE)
+	res_value = ADC_readChannelSleep(0); /* the CPU sleeps during the conversion */
+#else
+	res_value = ADC_readChannel(0); /* read channel zero where the potentiometer is connect */
+#endif
+
+	App_applySample(res_value);
+	App_showSample(res_value);
+}
+#endif
+
+#if (APP_SLEEP != DISABLE)
+/*
+ * Description: display the CPU utilization of the last second in percent
+ */
+static void App_showUtilization(void)
+{
+	uint8 utilization = (uint8)(Power_getUtilization() / 10);
+
+	if(utilization == g_appUtilizationShown)
+	{
+		return;
+	}
+
+	if(g_appUtilizationShown == 0XFF)
+	{
+		LCD_displayStringRowColumn(1, 0, "CPU ");
+	}
+	g_appUtilizationShown = utilization;
+	LCD_goToRowColumn(1, 4);
+	LCD_intgerToString(utilization);
+	/* blanks up to the column 8 over the digits of a wider value */
+	LCD_displayString( (utilization < 10) ? "%   " : ((utilization < 100) ? "%  " : "% ") );
+}
+#endif
+
+#if (APP_MEMORY_MONITOR != DISABLE)
+/*
+ * Description: display the free RAM in bytes after the utilization
+ */
+static void App_showMemory(void)
+{
+	uint16 ram_free = MemoryMonitor_getFree();
+
+	if(ram_free == g_appMemoryShown)
+	{
+		return;
+	}
+
+	if(g_appMemoryShown == 0XFFFF)
+	{
+		LCD_displayStringRowColumn(1, 9, "RAM ");
+	}
+	g_appMemoryShown = ram_free;
+	LCD_goToRowColumn(1, 13);
+	LCD_intgerToString(ram_free);
+	LCD_displayString("  ");
+}
+#endif
+
+#if (APP_RATE_GROUPS != DISABLE)
+/*
+ * Description: task of the speed group, the conversion started by its
+ *              previous run is over, 13 ADC clocks are far below the period
+ */
+static void App_speedTask(void)
+{
+	if(ADC_isConversionComplete())
+	{
+		App_applySample(ADC_getResult());
+	}
+	ADC_startConversion(0);
+}
+
+/*
+ * Description: task of the display group, the LCD belongs to it
+ */
+static void App_displayTask(void)
+{
+	App_SampleType last;
+
+	/* the speed group preempts this one */
+	App_getSample(&last);
+	App_showSample(last.adc);
+#if (APP_SLEEP != DISABLE)
+	App_showUtilization();
+#endif
+#if (APP_MEMORY_MONITOR != DISABLE)
+	App_showMemory();
+#endif
+}
+
+static const RateGroups_TaskType g_appSpeedTasks[] = {App_speedTask};
+static const RateGroups_TaskType g_appDisplayTasks[] = {App_displayTask};
+
+static const RateGroups_GroupType g_appGroups[] =
+{
+		/* PWM period: the current loop of a motor with a current sensor goes here */
+		{1, NULL_PTR, 0},
+		{APP_SPEED_GROUP_DIVIDER, g_appSpeedTasks, sizeof(g_appSpeedTasks) / sizeof(g_appSpeedTasks[0])},
+		{APP_DISPLAY_GROUP_DIVIDER, g_appDisplayTasks, sizeof(g_appDisplayTasks) / sizeof(g_appDisplayTasks[0])}
+};
+
+static const RateGroups_ConfigType g_appRateGroups =
+{
+		g_appGroups, sizeof(g_appGroups) / sizeof(g_appGroups[0])
+};
+#endif
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
 void buttonFunction(void)
 {
 
@@ -30,4 +491,319 @@ void buttonFunction(void)
 
 		}
 
+		/* the settings follow the button, the commands see the direction in use */
+		g_appSettings.direction = DC_motor_getDirection(DC_MOTOR_0);
+		g_appSettingsPending.direction = g_appSettings.direction;
+#if (APP_PERSISTENCE != DISABLE)
+		App_settingsChanged();
+#endif
+
+#if (APP_CAPTURE != DISABLE)
+		Capture_trigger(); /* the press is marked even if the direction didn't change */
+#endif
+
+}
+
+/***************************************************************************************************
+ * [Function Name]: App_init
+ *
+ * [Description]:  Initialize the application
+ *                 - Settings saved in the EEPROM (APP_PERSISTENCE), or their
+ *                   defaults (potentiometer, clock wise), main applies the
+ *                   direction
+ *                 - UART, telemetry and commands when enabled
+ *                 - Overcurrent protection (APP_OVERCURRENT), after Timer0
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void App_init(void)
+{
+#if (APP_PERSISTENCE != DISABLE)
+	App_SettingsType saved;
+#endif
+#if APP_UART
+	UART_ConfigType uart;
+
+	uart.baud_rate = APP_TELEMETRY_BAUD_RATE;
+	uart.speed = UART_NORMAL_SPEED;
+	uart.parity = UART_PARITY_DISABLED;
+	uart.stop_bits = UART_ONE_STOP_BIT;
+	UART_init(&uart);
+#endif
+#if (APP_TELEMETRY != DISABLE)
+#if (APP_MEMORY_MONITOR != DISABLE)
+	Telemetry_init(APP_TELEMETRY_FIELDS | TELEMETRY_FIELD_SECTIONS); /* frames of the loop on the UART */
+#else
+	Telemetry_init(APP_TELEMETRY_FIELDS); /* frames of the loop on the UART */
+#endif
+#endif
+#if (APP_CAPTURE != DISABLE)
+	Capture_init(&g_appCapture);
+#endif
+#if (APP_COMMANDS != DISABLE)
+	CommandParser_init(g_appCommands, sizeof(g_appCommands) / sizeof(g_appCommands[0]), App_command);
+#endif
+#if (APP_SLEEP != DISABLE)
+	Power_init(); /* utilization measured on the tick timer */
+#endif
+#if (APP_MEMORY_MONITOR != DISABLE)
+	MemoryMonitor_init(); /* stack of the start up */
+#endif
+#if (APP_OVERCURRENT != DISABLE)
+	Overcurrent_init(&g_appOvercurrent); /* COM bits of Timer0 configured by main */
+#endif
+
+#if (APP_PERSISTENCE != DISABLE)
+	/* one scan of the EEPROM, the defaults stay if nothing valid is there */
+	if(EepromStore_load(&saved, sizeof(saved), APP_SETTINGS_VERSION) && App_settingsValid(&saved))
+	{
+		g_appSettings = saved;
+	}
+	g_appSettingsDirty = FALSE;
+#endif
+
+	g_appSettingsPending = g_appSettings;
+	g_appSettingsChanged = FALSE;
+	g_appSpeed = g_appSettings.speed;
+
+}/*End of App_init*/
+
+#if (APP_RATE_GROUPS != DISABLE)
+void App_startRateGroups(void)
+{
+	RateGroups_init(&g_appRateGroups);
+}
+#endif
+
+void App_tick(void)
+{
+#if (APP_AUTOTUNE != DISABLE)
+	sint16 speed;
+#endif
+
+	g_appTick = TRUE;
+	Debounce_tick();
+#if (APP_SLEEP != DISABLE)
+	Power_tick();
+#endif
+#if (APP_CAPTURE != DISABLE)
+	Capture_record(g_appSample[g_appSampleIndex].adc, g_appSample[g_appSampleIndex].duty,
+			DC_motor_getDirection(DC_MOTOR_0), 0);
+#endif
+#if (APP_TELEMETRY != DISABLE)
+	Telemetry_tick();
+#endif
+#if (APP_AUTOTUNE != DISABLE)
+	/* the duty sets the magnitude of the speed, in both directions */
+	speed = External_Interrupt_encoderGetVelocity();
+	Autotune_tick((speed < 0) ? -speed : speed);
+#endif
+}
+
+/***************************************************************************************************
+ * [Function Name]: App_loopIteration
+ *
+ * [Description]:  One pass of the application loop
+ *                 - Parse the commands, apply them at the tick (APP_COMMANDS)
+ *                 - Read the potentiometer, at every tick only (APP_SLEEP)
+ *                 - Map it, or the commanded speed, through the duty curve
+ *                   to the duty of Timer0, then display a new value
+ *                 - Switch the direction once for every debounced press
+ *                 - Scan the stack for its high-water mark at every tick and
+ *                   display the free RAM (APP_MEMORY_MONITOR)
+ *                 - Queue a telemetry frame when one is due (APP_TELEMETRY)
+ *                 - Dump the capture once it is frozen (APP_CAPTURE)
+ *                 - Dump the profiler trace once its ring is full, record
+ *                   again once the TX buffer is empty (PROFILER)
+ *                 Separated from main so it can be benchmarked alone
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void App_loopIteration(void)
+{
+#if (APP_TELEMETRY != DISABLE)
+	Telemetry_SampleType sample;
+	App_SampleType last;
+#if (APP_MEMORY_MONITOR != DISABLE)
+	MemoryMonitor_UsageType usage;
+#endif
+#endif
+
+	PROFILE_ENTER(PROFILER_ID_LOOP);
+
+#if (APP_COMMANDS != DISABLE)
+	PROFILE_ENTER(PROFILER_ID_COMMANDS);
+	CommandParser_poll();
+	PROFILE_EXIT(PROFILER_ID_COMMANDS);
+#endif
+	if(g_appTick)
+	{
+		g_appTick = FALSE;
+		PROFILE_ENTER(PROFILER_ID_CONTROL);
+		App_controlTick();
+		PROFILE_EXIT(PROFILER_ID_CONTROL);
+#if (APP_SLEEP != DISABLE) && (APP_RATE_GROUPS == DISABLE)
+		/* the CPU sleeps between the ticks, the potentiometer is sampled once per tick */
+		PROFILE_ENTER(PROFILER_ID_SAMPLE);
+		App_sample();
+		PROFILE_EXIT(PROFILER_ID_SAMPLE);
+		PROFILE_ENTER(PROFILER_ID_UTILIZATION);
+		App_showUtilization();
+		PROFILE_EXIT(PROFILER_ID_UTILIZATION);
+#endif
+#if (APP_MEMORY_MONITOR != DISABLE)
+		MemoryMonitor_scan();
+#if (APP_RATE_GROUPS == DISABLE)
+		App_showMemory();
+#endif
+#endif
+	}
+#if (APP_SLEEP == DISABLE) && (APP_RATE_GROUPS == DISABLE)
+	PROFILE_ENTER(PROFILER_ID_SAMPLE);
+	App_sample();
+	PROFILE_EXIT(PROFILER_ID_SAMPLE);
+#endif
+
+#if (APP_CAPTURE != DISABLE) && APP_UART
+	if(Capture_isDumpPending())
+	{
+		if(Capture_dumpPoll())
+		{
+#if (APP_COMMANDS == DISABLE)
+			Capture_arm(); /* no C command to arm it again */
+#endif
+		}
+	}
+#endif
+
+#if (EXTERNAL_INTERRUPT_ENCODER_MODE == DISABLE)
+	/* switch the direction once for every debounced press of the button */
+	if(Debounce_getPressed(DIRECTION_BUTTON_MASK))
+	{
+		PROFILE_ENTER(PROFILER_ID_BUTTON);
+		buttonFunction();
+		PROFILE_EXIT(PROFILER_ID_BUTTON);
+	}
+#endif
+
+#if (APP_TELEMETRY != DISABLE)
+	if(Telemetry_isDue())
+	{
+		PROFILE_ENTER(PROFILER_ID_TELEMETRY);
+		App_getSample(&last);
+		sample.adc = last.adc;
+		sample.duty = last.duty;
+		sample.direction = DC_motor_getDirection(DC_MOTOR_0);
+		/* no speed or current sensor in this application, not in APP_TELEMETRY_FIELDS */
+		sample.speed = 0;
+		sample.current = 0;
+#if (APP_MEMORY_MONITOR != DISABLE)
+		MemoryMonitor_getUsage(&usage);
+		sample.stack = usage.stack;
+		sample.ram_free = usage.free;
+		sample.data = usage.data;
+		sample.bss = usage.bss;
+		sample.heap = usage.heap;
+		/* dropped if the line is behind, never waits */
+		if(Telemetry_send(&sample) && !g_appSectionsSent)
+		{
+			g_appSectionsSent = TRUE;
+			Telemetry_setFields(APP_TELEMETRY_FIELDS);
+		}
+#else
+		sample.stack = 0;
+		sample.ram_free = 0;
+		sample.data = 0;
+		sample.bss = 0;
+		sample.heap = 0;
+		Telemetry_send(&sample); /* dropped if the line is behind, never waits */
+#endif
+		PROFILE_EXIT(PROFILER_ID_TELEMETRY);
+	}
+#endif
+
+	PROFILE_EXIT(PROFILER_ID_LOOP);
+
+#if (PROFILER != DISABLE) && APP_UART
+	if(Profiler_isFull())
+	{
+		/*
+		 * No markers while the ring is dumped, recording again once the TX
+		 * buffer is empty: the passes woken by the UDRE interrupts of the
+		 * dump would fill the new trace
+		 */
+		Profiler_stop();
+		if(Profiler_dumpPoll() && (UART_getTxFree() == UART_TX_BUFFER_SIZE))
+		{
+			Profiler_start();
+		}
+	}
+#endif
+
+}/*End of App_loopIteration*/
+
+/***************************************************************************************************
+ * [Function Name]: App_idle
+ *
+ * [Description]:  Sleep of the main loop until the next interrupt (APP_SLEEP)
+ *                 - The work is checked with the interrupts disabled, an
+ *                   interrupt between the check and the sleep wakes it at once
+ *                 - Pending: the tick, received bytes left by the parser, a
+ *                   capture or a profiler trace being dumped with room in
+ *                   the TX buffer. The end of the dump wakes the loop by the
+ *                   UDRE interrupt of the last byte
+ *                 Every other work of the loop comes from an interrupt which
+ *                 wakes the CPU (tick, button, ADC, UART, EEPROM)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void App_idle(void)
+{
+#if (APP_SLEEP != DISABLE)
+	bool pending;
+
+	cli();
+	pending = g_appTick;
+#if (APP_COMMANDS != DISABLE)
+	pending = pending || (UART_getRxCount() != 0);
+#endif
+#if (APP_CAPTURE != DISABLE) && APP_UART
+	/* a line waiting for room is sent once the UDRE interrupt wakes the CPU */
+	pending = pending || (Capture_isDumpPending() && (UART_getTxFree() >= CAPTURE_DUMP_LINE_SIZE));
+#endif
+#if (PROFILER != DISABLE) && APP_UART
+	pending = pending || (Profiler_isDumpPending() && (UART_getTxFree() >= PROFILER_DUMP_LINE_SIZE));
+#endif
+	if(!pending)
+	{
+		PROFILE_ENTER(PROFILER_ID_SLEEP);
+		Power_sleep(POWER_IDLE);
+		PROFILE_EXIT(PROFILER_ID_SLEEP);
+	}
+	sei();
+#endif
+
+}/*End of App_idle*/
+
+void App_getSettings(App_SettingsType * Settings_Ptr)
+{
+	*Settings_Ptr = g_appSettings;
 }
@@ -20,6 +20,20 @@
 #include"external_interrupts.h"
 #include"adc.h"
 #include"DCmotor.h"
+#include"duty_curve.h"
+#include"debounce.h"
+#include"isr_instrumentation.h"
+#include"telemetry.h"
+#include"command_parser.h"
+#include"capture.h"
+#include"eeprom_store.h"
+#include"power.h"
+#include"profiler.h"
+#include"shared_state.h"
+#include"rate_groups.h"
+#include"memory_monitor.h"
+#include"autotune.h"
+#include"overcurrent.h"
 
 
 #define RESISTOR_PORT_REG              PORTA
@@ -27,7 +41,189 @@
 #define RESISTOR_PIN_REG               PINA
 #define RESISTOR_PIN                   PA0
 
+/*
+ * Button switching the direction, debounced input connected to INT1
+ * None in the encoder mode, INT1 (PD3) is the channel B of the encoder
+ */
+#if (EXTERNAL_INTERRUPT_ENCODER_MODE == DISABLE)
+#define DIRECTION_BUTTON_MASK          (1<<INTERRUPT1_PIN)
+#else
+#define DIRECTION_BUTTON_MASK          0
+#endif
+
+/*
+ * Timer2 in compare mode gives the tick of the debouncing
+ * F_CPU_1024 selects CS22:0 = 101 which is F_CPU/128 for Timer2,
+ * 8Mhz/128/(249+1) = 250Hz --> 4ms = DEBOUNCE_TICK_MS
+ */
+#define SYSTEM_TICK_TIMER_CLOCK        F_CPU_1024
+#define SYSTEM_TICK_COMPARE_VALUE      249
+
+/*
+ * Telemetry of the loop on the USART at 250 kbaud (uart.h), disabled by default
+ * as RXD/TXD (PD0/PD1) are the RS/RW pins of the LCD on this board
+ */
+#define APP_TELEMETRY                  DISABLE
+#define APP_TELEMETRY_BAUD_RATE        UART_DEFAULT_BAUD_RATE
+#define APP_TELEMETRY_FIELDS           (TELEMETRY_FIELD_ADC | TELEMETRY_FIELD_DUTY | TELEMETRY_FIELD_DIRECTION | \
+		TELEMETRY_FIELD_MEMORY)
+
+/*
+ * Commands of a supervisory PC on the USART (command_parser.h), same pins
+ * as the telemetry so disabled by default too:
+ * S<0:1023>  speed set point, scale of the potentiometer
+ * D<0:2>     direction, DcMotor_Direction (stop, clock wise, anti clock wise)
+ * R<0:1023>  ramp of the speed, set point counts per tick, 0 = no ramp
+ * P, I, K    gains of the speed loop, Q8.8
+ * M<0:1>     mode, App_Mode
+ * T<1:1000>  auto tuning of P, I, K around a speed (APP_AUTOTUNE)
+ * They are applied at the next tick
+ */
+#define APP_COMMANDS                   DISABLE
+
+/*
+ * Capture of the loop in RAM at every tick (capture.h), triggered by a change
+ * of direction or a press of the button, dumped on the UART when APP_UART
+ * C<0:CAPTURE_SIZE-1> command arms it again with that many pre trigger samples
+ */
+#define APP_CAPTURE                    DISABLE
+#define APP_CAPTURE_TRIGGER            CAPTURE_TRIGGER_CHANGE
+#define APP_CAPTURE_CHANNEL            CAPTURE_DIRECTION
+#define APP_CAPTURE_THRESHOLD          0
+#define APP_CAPTURE_PRE_TRIGGER        (CAPTURE_SIZE / 2)
+/*
+ * Settings saved in the EEPROM (eeprom_store.h) once they stay unchanged for
+ * APP_PERSISTENCE_DELAY_TICKS, loaded at start: the gains, the mode and the
+ * last direction, from the commands or the button, survive a reset
+ * APP_SETTINGS_VERSION changes with App_SettingsType, the old records are ignored
+ */
+#define APP_PERSISTENCE                ENABLE
+#define APP_PERSISTENCE_DELAY_TICKS    250      /* ticks seen by the loop, 1s or more */
+#define APP_SETTINGS_VERSION           1
+/*
+ * Idle sleep of the main loop whenever no work is pending (power.h), woken by
+ * the tick, the button, the ADC and the UART. The potentiometer is sampled at
+ * every tick, sleeping during the conversion, and the CPU utilization of the
+ * last second is on the second row of the LCD
+ */
+#define APP_SLEEP                      ENABLE
+/*
+ * Rate groups on the overflow of Timer0 (rate_groups.h), its PWM period
+ * 8Mhz/8/256 = 3906Hz: the speed group samples the potentiometer and updates
+ * the duty at 976Hz, the display group writes the LCD at 10Hz, preempted by
+ * the speed group. The main loop keeps the tick, the commands and the button
+ */
+#define APP_RATE_GROUPS                DISABLE
+#define APP_SPEED_GROUP_DIVIDER        4
+#define APP_DISPLAY_GROUP_DIVIDER      391
+/*
+ * Monitor of the SRAM (memory_monitor.h): the high-water mark of the stack
+ * is scanned a few bytes per tick, the free RAM is at the end of the second
+ * row of the LCD and in the telemetry frames
+ */
+#define APP_MEMORY_MONITOR             ENABLE
+/*
+ * Relay auto tuning of the speed loop (autotune.h) started by the T command,
+ * speed in encoder counts per tick: the relay runs around the duty in use
+ * from the tick interrupt, then the gains of APP_AUTOTUNE_RULE replace P, I
+ * and K and are saved like commanded ones. The duty goes back after
+ * APP_AUTOTUNE_TIMEOUT_TICKS at most. The speed comes from the encoder mode
+ * of INT0/INT1 (external_interrupts.h), the pins of the LCD E and the button
+ */
+#define APP_AUTOTUNE                   DISABLE
+#define APP_AUTOTUNE_RULE              AUTOTUNE_TYREUS_LUYBEN_PI
+#define APP_AUTOTUNE_AMPLITUDE         40       /* compare counts above and below the duty */
+#define APP_AUTOTUNE_HYSTERESIS        1        /* counts per tick */
+#define APP_AUTOTUNE_TIMEOUT_TICKS     2500     /* 10s */
+#define APP_AUTOTUNE_SPEED_MAX         1000
+/*
+ * Overcurrent protection of the motor (overcurrent.h): the slow path samples
+ * the current sense amplifier at every tick of the main loop and disconnects
+ * OC0 once the I^2t above the nominal current reaches the limit, about 1s at
+ * full scale. It retries after the delay and latches after the retries.
+ * The ADC is read from the main loop, not with APP_RATE_GROUPS
+ * This board has no shunt on ADC1: a floating PA1 would trip the motor off,
+ * disabled by default, enable it on a board with the current sense amplifier
+ */
+#define APP_OVERCURRENT                DISABLE
+#define APP_OVERCURRENT_CHANNEL        1        /* ADC1, PA1 */
+#define APP_OVERCURRENT_NOMINAL        400      /* ADC counts */
+#define APP_OVERCURRENT_I2T_LIMIT      200000000UL
+#define APP_OVERCURRENT_RETRY_TICKS    250      /* 1s */
+#define APP_OVERCURRENT_MAX_RETRIES    3
+
+#if (APP_AUTOTUNE != DISABLE) && \
+	((EXTERNAL_INTERRUPT_ENCODER_MODE == DISABLE) || (APP_COMMANDS == DISABLE))
+#error "APP_AUTOTUNE needs the encoder mode and the commands"
+#endif
+#if (APP_OVERCURRENT != DISABLE) && (APP_RATE_GROUPS != DISABLE)
+#error "APP_OVERCURRENT reads the ADC from the main loop, the speed group owns it"
+#endif
+#define APP_UART                       ((APP_TELEMETRY != DISABLE) || (APP_COMMANDS != DISABLE))
+
+#define APP_SPEED_MAX                  1023
+
+/*Settings at reset: the potentiometer drives the motor like before*/
+#define APP_DEFAULT_SPEED              0
+#define APP_DEFAULT_RAMP               0
+#define APP_DEFAULT_GAIN_P             0X0100   /* 1.0 */
+#define APP_DEFAULT_GAIN_I             0
+#define APP_DEFAULT_GAIN_D             0
+
+typedef enum
+{
+	APP_MODE_LOCAL,     /* speed from the potentiometer */
+	APP_MODE_REMOTE     /* speed from the S command */
+
+}App_Mode;
+
+typedef struct
+{
+	uint16 speed;
+	uint8 direction;    /* DcMotor_Direction */
+	uint16 ramp;
+	sint16 kp;          /* Q8.8 */
+	sint16 ki;          /* Q8.8 */
+	sint16 kd;          /* Q8.8 */
+	uint8 mode;         /* App_Mode */
+
+}App_SettingsType;
+
 void buttonFunction(void);
 
+/*
+ * Description: Initialize the settings, saved ones when APP_PERSISTENCE,
+ *              and the UART interfaces (APP_UART)
+ */
+void App_init(void);
+
+#if (APP_RATE_GROUPS != DISABLE)
+/*
+ * Description: Start the rate groups, Timer0 and the LCD initialized
+ */
+void App_startRateGroups(void);
+#endif
+
+/*
+ * Description: System tick, call back of Timer2 every 4ms
+ */
+void App_tick(void);
+
+/*
+ * Description: One pass of the application loop
+ */
+void App_loopIteration(void);
+
+/*
+ * Description: Sleep until the next interrupt if no work is pending (APP_SLEEP),
+ *              after every pass of the loop
+ */
+void App_idle(void);
+
+/*
+ * Description: Get the settings in use
+ */
+void App_getSettings(App_SettingsType * Settings_Ptr);
+
 
 #endif /* APP_FILE_H_ */
@@ -0,0 +1,270 @@
+/**********************************************************************************
+ * [FILE NAME]: autotune.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the relay feedback auto tuning of the speed loop.
+ *
+ ***********************************************************************************/
+
+#include"autotune.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Switches to low of the whole measure, the first one starts the first period*/
+#define AUTOTUNE_SWITCHES                        (AUTOTUNE_SETTLE_CYCLES + AUTOTUNE_MEASURED_CYCLES + 1)
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/*
+ * Coefficients of the rules in Q8.8, applied to Ku for kp, to Ku/Pu for ki
+ * and to Ku*Pu for kd:
+ * Ziegler-Nichols  PI : Kp = 0.45 Ku,  Ti = Pu / 1.2
+ * Ziegler-Nichols  PID: Kp = 0.6 Ku,   Ti = Pu / 2,   Td = Pu / 8
+ * Tyreus-Luyben    PI : Kp = Ku / 3.2, Ti = 2.2 Pu
+ * Tyreus-Luyben    PID: Kp = Ku / 2.2, Ti = 2.2 Pu,   Td = Pu / 6.3
+ */
+static const uint16 g_autotuneRules[][3] =
+{
+		{115, 138, 0},
+		{154, 307, 19},
+		{80, 36, 0},
+		{116, 53, 18}
+};
+
+/* Copy of the configuration, read by the interrupt */
+static Autotune_ConfigType g_autotuneConfig;
+static sint16 g_autotuneUpper;       /* set point + hysteresis */
+static sint16 g_autotuneLower;       /* set point - hysteresis */
+
+/* Written by the control interrupt while RUNNING, by the main loop otherwise */
+static volatile uint8 g_autotuneState = AUTOTUNE_IDLE;
+static bool g_autotuneHigh;
+static uint16 g_autotuneTicks;       /* since the start */
+static uint16 g_autotuneSwitchTick;  /* of the last switch to low */
+static uint8 g_autotuneSwitches;
+static sint16 g_autotuneMax;         /* speed since the last switch to low */
+static sint16 g_autotuneMin;
+static uint32 g_autotunePeriodSum;
+static uint32 g_autotunePeakSum;
+
+static Autotune_ResultType g_autotuneResult;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static void Autotune_end(Autotune_StateType state)
+{
+	Timer_changeCompareValue(g_autotuneConfig.timer_ID, g_autotuneConfig.revert, g_autotuneConfig.channel);
+	g_autotuneState = state;
+}
+
+/*
+ * Description: a switch to low ends a period, add it to the sums once the
+ *              oscillation settled, the last one gives the result
+ */
+static void Autotune_switchLow(sint16 speed)
+{
+	g_autotuneSwitches++;
+	if(g_autotuneSwitches > (AUTOTUNE_SETTLE_CYCLES + 1))
+	{
+		g_autotunePeriodSum += (uint16)(g_autotuneTicks - g_autotuneSwitchTick);
+		g_autotunePeakSum += (uint16)(g_autotuneMax - g_autotuneMin);
+	}
+	g_autotuneSwitchTick = g_autotuneTicks;
+	g_autotuneMax = speed;
+	g_autotuneMin = speed;
+
+	if(g_autotuneSwitches == AUTOTUNE_SWITCHES)
+	{
+		g_autotuneResult.period = (uint16)(g_autotunePeriodSum >> AUTOTUNE_MEASURED_SHIFT);
+		/* a is half of the peak to peak */
+		g_autotuneResult.amplitude = (uint16)(g_autotunePeakSum >> (AUTOTUNE_MEASURED_SHIFT + 1));
+		g_autotuneResult.relay = g_autotuneConfig.amplitude;
+		Autotune_end(AUTOTUNE_DONE);
+	}
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+bool Autotune_start(const Autotune_ConfigType * Config_Ptr)
+{
+	uint8 sreg;
+
+	if( (g_autotuneState == AUTOTUNE_RUNNING) || (Config_Ptr->amplitude == 0) ||
+			(Config_Ptr->amplitude > Config_Ptr->bias) ||
+			(((uint16)Config_Ptr->bias + Config_Ptr->amplitude) > 0XFF) )
+	{
+		return FALSE;
+	}
+
+	sreg = SREG;
+	cli();
+	g_autotuneConfig = *Config_Ptr;
+	g_autotuneUpper = Config_Ptr->setpoint + Config_Ptr->hysteresis;
+	g_autotuneLower = Config_Ptr->setpoint - Config_Ptr->hysteresis;
+	g_autotuneTicks = 0;
+	g_autotuneSwitchTick = 0;
+	g_autotuneSwitches = 0;
+	g_autotuneMax = Config_Ptr->setpoint;
+	g_autotuneMin = Config_Ptr->setpoint;
+	g_autotunePeriodSum = 0;
+	g_autotunePeakSum = 0;
+
+	/* up to the set point first */
+	g_autotuneHigh = TRUE;
+	Timer_changeCompareValue(Config_Ptr->timer_ID, Config_Ptr->bias + Config_Ptr->amplitude, Config_Ptr->channel);
+	g_autotuneState = AUTOTUNE_RUNNING;
+	SREG = sreg;
+
+	return TRUE;
+}
+
+/***************************************************************************************************
+ * [Function Name]: Autotune_tick
+ *
+ * [Description]:  Function of the control interrupt while the relay runs
+ *                 - Past timeout_ticks the compare is reverted, FAILED
+ *                 - The extremes of the speed of the current period
+ *                 - The relay switches to low above the set point plus the
+ *                   hysteresis, to high below it minus the hysteresis
+ *                 A fixed number of additions and compares per tick, no
+ *                 division, the procedure ends within timeout_ticks ticks
+ *
+ * [Args]:         speed
+ *
+ * [In]            speed: -Speed measured in this tick
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Autotune_tick(sint16 speed)
+{
+	if(g_autotuneState != AUTOTUNE_RUNNING)
+	{
+		return;
+	}
+
+	g_autotuneTicks++;
+	if(g_autotuneTicks >= g_autotuneConfig.timeout_ticks)
+	{
+		Autotune_end(AUTOTUNE_FAILED);
+		return;
+	}
+
+	if(speed > g_autotuneMax)
+	{
+		g_autotuneMax = speed;
+	}
+	if(speed < g_autotuneMin)
+	{
+		g_autotuneMin = speed;
+	}
+
+	if(g_autotuneHigh)
+	{
+		if(speed > g_autotuneUpper)
+		{
+			g_autotuneHigh = FALSE;
+			Timer_changeCompareValue(g_autotuneConfig.timer_ID,
+					g_autotuneConfig.bias - g_autotuneConfig.amplitude, g_autotuneConfig.channel);
+			Autotune_switchLow(speed);
+		}
+	}
+	else if(speed < g_autotuneLower)
+	{
+		g_autotuneHigh = TRUE;
+		Timer_changeCompareValue(g_autotuneConfig.timer_ID,
+				g_autotuneConfig.bias + g_autotuneConfig.amplitude, g_autotuneConfig.channel);
+	}
+
+}/*End of Autotune_tick*/
+
+void Autotune_abort(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	if(g_autotuneState == AUTOTUNE_RUNNING)
+	{
+		Autotune_end(AUTOTUNE_IDLE);
+	}
+	SREG = sreg;
+}
+
+Autotune_StateType Autotune_getState(void)
+{
+	return (Autotune_StateType)g_autotuneState;
+}
+
+void Autotune_clear(void)
+{
+	if(g_autotuneState != AUTOTUNE_RUNNING)
+	{
+		g_autotuneState = AUTOTUNE_IDLE;
+	}
+}
+
+bool Autotune_getResult(Autotune_ResultType * Result_Ptr)
+{
+	if(g_autotuneState != AUTOTUNE_DONE)
+	{
+		return FALSE;
+	}
+
+	*Result_Ptr = g_autotuneResult;
+
+	return TRUE;
+}
+
+/***************************************************************************************************
+ * [Function Name]: Autotune_computeGains
+ *
+ * [Description]:  Function to compute the gains of a rule
+ *                 - Ku = 4 d / (pi a) in Q8.8
+ *                 - kp = c Ku, ki = c Ku / Pu, kd = c Ku Pu with the
+ *                   coefficients c of the rule, saturated to Q8.8
+ *
+ * [Args]:         Result_Ptr, rule, Gains_Ptr
+ *
+ * [In]            Result_Ptr: -Pointer to the measure
+ *                 rule: -Autotune_RuleType
+ *
+ * [Out]           Gains_Ptr: -Pointer to the gains
+ *
+ * [Returns]:      FALSE if the measure has no oscillation, TRUE otherwise
+ ***************************************************************************************************/
+bool Autotune_computeGains(const Autotune_ResultType * Result_Ptr, Autotune_RuleType rule,
+		Autotune_GainsType * Gains_Ptr)
+{
+	uint32 ku;
+	uint32 kd;
+
+	if( (Result_Ptr->amplitude == 0) || (Result_Ptr->period == 0) ||
+			(rule > AUTOTUNE_TYREUS_LUYBEN_PID) )
+	{
+		return FALSE;
+	}
+
+	ku = ((uint32)Result_Ptr->relay * AUTOTUNE_FOUR_OVER_PI) / Result_Ptr->amplitude;
+
+	Gains_Ptr->kp = Fixed_saturate16((sint32)((ku * g_autotuneRules[rule][0]) >> 8));
+	Gains_Ptr->ki = Fixed_saturate16((sint32)(((ku * g_autotuneRules[rule][1]) / Result_Ptr->period) >> 8));
+
+	/* Ku Pu can leave 32 bits, the limit is checked before the product */
+	kd = (ku * g_autotuneRules[rule][2]) >> 8;
+	Gains_Ptr->kd = (kd > (0X7FFFUL / Result_Ptr->period)) ? 0X7FFF : (sint16)(kd * Result_Ptr->period);
+
+	return TRUE;
+
+}/*End of Autotune_computeGains*/
@@ -0,0 +1,148 @@
+/**********************************************************************************
+ * [FILE NAME]: autotune.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                relay feedback auto tuning of the speed loop (Astrom-Hagglund):
+ *                - The PWM compare switches between bias + amplitude and
+ *                  bias - amplitude each time the speed crosses the set point
+ *                  (with a hysteresis), the motor oscillates around it
+ *                - Every control tick measures in the interrupt with integer
+ *                  additions and compares only: the period between two
+ *                  switches to low and the peak to peak speed of that period
+ *                - The first AUTOTUNE_SETTLE_CYCLES periods are skipped, the
+ *                  next AUTOTUNE_MEASURED_CYCLES are averaged by a shift
+ *                - The ultimate gain Ku = 4 d / (pi a) and period Pu give the
+ *                  gains of the rule, computed once in the main loop
+ *                The compare goes back to the revert value at the end, on
+ *                abort and after timeout_ticks, whatever the motor did.
+ *
+ *                Units: speed of the feedback (encoder counts per tick), the
+ *                gains in Q8.8 compare counts per speed unit, the integral
+ *                and the derivative per control tick.
+ *
+ ***********************************************************************************/
+
+#ifndef AUTOTUNE_H_
+#define AUTOTUNE_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "timers.h"
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Periods skipped while the oscillation settles*/
+#define AUTOTUNE_SETTLE_CYCLES                   2
+
+/*Periods averaged, power of 2*/
+#define AUTOTUNE_MEASURED_CYCLES                 4
+#define AUTOTUNE_MEASURED_SHIFT                  2
+
+#if (AUTOTUNE_MEASURED_CYCLES != (1 << AUTOTUNE_MEASURED_SHIFT))
+#error "AUTOTUNE_MEASURED_CYCLES must be 2 to the power AUTOTUNE_MEASURED_SHIFT"
+#endif
+
+/*4/pi in Q8.8*/
+#define AUTOTUNE_FOUR_OVER_PI                    326
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	AUTOTUNE_IDLE, AUTOTUNE_RUNNING, AUTOTUNE_DONE, AUTOTUNE_FAILED
+
+}Autotune_StateType;
+
+typedef enum
+{
+	AUTOTUNE_ZIEGLER_NICHOLS_PI, AUTOTUNE_ZIEGLER_NICHOLS_PID,
+	AUTOTUNE_TYREUS_LUYBEN_PI, AUTOTUNE_TYREUS_LUYBEN_PID
+
+}Autotune_RuleType;
+
+typedef struct
+{
+	sint16 setpoint;        /* speed the relay oscillates around */
+	uint8 hysteresis;       /* speed units above and below the set point */
+	uint8 bias;             /* compare value in the middle of the relay */
+	uint8 amplitude;        /* d, compare counts above and below the bias */
+	uint8 revert;           /* compare value at the end */
+	uint16 timeout_ticks;   /* whole procedure, control ticks */
+	Timer_Type timer_ID;    /* PWM of the motor */
+	Channel_Type channel;
+
+}Autotune_ConfigType;
+
+typedef struct
+{
+	uint16 period;          /* Pu, control ticks */
+	uint16 amplitude;       /* a, half of the peak to peak speed */
+	uint8 relay;            /* d of the measure */
+
+}Autotune_ResultType;
+
+typedef struct
+{
+	sint16 kp;              /* Q8.8 */
+	sint16 ki;              /* Q8.8, kp / Ti */
+	sint16 kd;              /* Q8.8, kp * Td */
+
+}Autotune_GainsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to start the relay from the next control tick
+ *              Returns FALSE if running already or the relay leaves 0:255
+ */
+bool Autotune_start(const Autotune_ConfigType * Config_Ptr);
+
+/*
+ * Description: Function of the control interrupt, every tick, with the
+ *              speed measured in this tick
+ */
+void Autotune_tick(sint16 speed);
+
+/*
+ * Description: Function to stop the relay and write the revert compare
+ */
+void Autotune_abort(void);
+
+/*
+ * Description: Function to get the state, DONE and FAILED stay until the
+ *              next start or Autotune_clear
+ */
+Autotune_StateType Autotune_getState(void);
+
+/*
+ * Description: Function to go back to IDLE after DONE or FAILED
+ */
+void Autotune_clear(void);
+
+/*
+ * Description: Function to get the measure of a DONE procedure
+ *              Returns FALSE in the other states
+ */
+bool Autotune_getResult(Autotune_ResultType * Result_Ptr);
+
+/*
+ * Description: Function to compute the gains of a rule from a measure, with
+ *              the divisions, out of the interrupt
+ *              Returns FALSE if the measure has no oscillation
+ */
+bool Autotune_computeGains(const Autotune_ResultType * Result_Ptr, Autotune_RuleType rule,
+		Autotune_GainsType * Gains_Ptr);
+
+#endif /* AUTOTUNE_H_ */
@@ -0,0 +1,322 @@
+/**********************************************************************************
+ * [FILE NAME]: benchmark.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Benchmark firmware of the key paths, empty unless built with
+ *                -DBENCHMARK, main.c is the one left out then.
+ *
+ ***********************************************************************************/
+
+#ifdef BENCHMARK
+
+#include "benchmark.h"
+#include "fixed_point.h"
+#include <stdlib.h>
+#include <avr/sleep.h>
+/* From simavr, the path is given by Tools/benchmark.sh */
+#include "avr_mcu_section.h"
+
+/*******************************************************************************
+ *                      simavr Description                                     *
+ *******************************************************************************/
+
+AVR_MCU(F_CPU, "atmega16");
+AVR_MCU_SIMAVR_CONSOLE(&BENCHMARK_CONSOLE_REGISTER);
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static volatile uint16 g_overflows = 0;
+static uint32 g_measurementCost = 0;
+
+/* Operands and results of the fixed point math, volatile so nothing is folded */
+static volatile sint16 g_fixedA16 = -12345;
+static volatile sint16 g_fixedB16 = 23456;
+static volatile sint32 g_fixedA32 = -0X00028000L;      /* -2.5 */
+static volatile sint32 g_fixedB32 = 0X0003243FL;       /* pi */
+static volatile uint16 g_fixedAngle = 0X2345;
+static volatile sint16 g_fixedResult16;
+static volatile sint32 g_fixedResult32;
+/* Half of the range, twice it saturates */
+static volatile sint16 g_fixedHalf16 = 20000;
+static volatile sint32 g_fixedHalf32 = 0X50000000L;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static void Benchmark_overflow(void)
+{
+	g_overflows++;
+}
+
+static void Benchmark_putString(const char * Str)
+{
+	while(*Str != '\0')
+	{
+		BENCHMARK_CONSOLE_REGISTER = *Str;
+		Str++;
+	}
+}
+
+/*
+ * Description: compare a result with its known value, the one of the C
+ *              reference on the host (Tools/fixed_point_check.c), a line
+ *              "benchmark_error,name,value" if it differs
+ */
+static void Benchmark_expect(const char * name, sint32 value, sint32 expected)
+{
+	char buff[12];
+
+	if(value != expected)
+	{
+		Benchmark_putString("benchmark_error,");
+		Benchmark_putString(name);
+		Benchmark_putString(",");
+		Benchmark_putString(ltoa(value, buff, 10));
+		Benchmark_putString("\n");
+	}
+}
+
+/*
+ * Description: saturation of the assembly additions and subtractions, with
+ *              the same register for both operands (a + a) too
+ */
+static void Benchmark_checkSaturation(void)
+{
+	sint16 half16 = g_fixedHalf16;
+	sint32 half32 = g_fixedHalf32;
+
+	Benchmark_expect("fixed_add16_max", Fixed_add16(half16, half16), FIXED_Q15_MAX);
+	Benchmark_expect("fixed_add16_min", Fixed_add16(-half16, -half16), FIXED_Q15_MIN);
+	Benchmark_expect("fixed_sub16_max", Fixed_sub16(half16, -half16), FIXED_Q15_MAX);
+	Benchmark_expect("fixed_sub16_min", Fixed_sub16(-half16, half16), FIXED_Q15_MIN);
+	Benchmark_expect("fixed_add32_max", Fixed_add32(half32, half32), FIXED_Q16_16_MAX);
+	Benchmark_expect("fixed_add32_min", Fixed_add32(-half32, -half32), FIXED_Q16_16_MIN);
+	Benchmark_expect("fixed_sub32_max", Fixed_sub32(half32, -half32), FIXED_Q16_16_MAX);
+	Benchmark_expect("fixed_sub32_min", Fixed_sub32(-half32, half32), FIXED_Q16_16_MIN);
+}
+
+#if (EXTERNAL_INTERRUPT_ENCODER_MODE != DISABLE)
+/*
+ * Description: one edge of channel A of the encoder, PD2 driven as output
+ */
+static void Benchmark_triggerEncoder(void)
+{
+	TOGGLE_BIT(PORTD, ENCODER_A_PIN);
+	__asm__ __volatile__("nop\n\tnop\n\tnop");
+}
+#endif
+
+/*
+ * Description: rising edge on INT2, its vector runs before the next instruction
+ */
+static void Benchmark_triggerInt2(void)
+{
+	CLEAR_BIT(BENCHMARK_ISR_DATA_PORT, BENCHMARK_ISR_PIN);
+	SET_BIT(BENCHMARK_ISR_DATA_PORT, BENCHMARK_ISR_PIN);
+	__asm__ __volatile__("nop\n\tnop\n\tnop");
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: Benchmark_init
+ *
+ * [Description]:  Function to start the cycle counter of the benchmarks
+ *                 - Timer1 free running at F_CPU, its overflows extend it to 32-bit
+ *                 - The cost of an empty measurement is removed from all of them
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Benchmark_init(void)
+{
+	uint32 start;
+
+	Timer_setCallBack(Benchmark_overflow, Timer1);
+	Timer_startCycleCounter();
+	TIMSK |= (1<<TOIE1);
+
+	start = Benchmark_now();
+	g_measurementCost = Benchmark_now() - start;
+
+}/*End of Benchmark_init*/
+
+uint32 Benchmark_now(void)
+{
+	uint16 low;
+	uint16 high;
+	uint8 sreg = SREG;
+
+	cli();
+	low = TIMER_CYCLE_COUNTER_REGISTER;
+	high = g_overflows;
+	/* overflow not served yet */
+	if( BIT_IS_SET(TIFR, TOV1) && (low < 0X8000) )
+	{
+		high++;
+	}
+	SREG = sreg;
+
+	return ((uint32)high << 16) | low;
+}
+
+void Benchmark_report(const char * name, uint32 cycles)
+{
+	char buff[12];
+
+	cycles = (cycles > g_measurementCost) ? (cycles - g_measurementCost) : 0;
+
+	Benchmark_putString("benchmark,");
+	Benchmark_putString(name);
+	Benchmark_putString(",");
+	Benchmark_putString(ultoa(cycles, buff, 10));
+	Benchmark_putString("\n");
+}
+
+/*******************************************************************************
+ *                               Benchmarks                                    *
+ *******************************************************************************/
+
+int main(void)
+{
+	Timer_ConfigType timer;
+	Timer_ConfigType tick;
+	External_Interrupt_ConfigType isr_trigger;
+	Capture_ConfigType capture;
+	uint16 res_value = 0;
+
+	timer.COM = Clear;
+	timer.timer_ID = Timer0;
+	timer.timer_clock = F_CPU_8;
+	timer.timer_mode = FAST_PWM;
+	timer.timer_InitialValue = 0;
+	timer.timer_compare_MatchValue = 0;
+
+	/* the tick of the application, no call back */
+	tick.COM = Disconnected;
+	tick.timer_ID = Timer2;
+	tick.timer_clock = F_CPU_1024;
+	tick.timer_mode = Compare;
+	tick.timer_InitialValue = 0;
+	tick.timer_compare_MatchValue = 249;
+
+	/* armed and never triggered, the cost of every tick while waiting */
+	capture.trigger = CAPTURE_TRIGGER_ABOVE;
+	capture.channel = CAPTURE_ADC;
+	capture.threshold = 0X7FFF;
+	capture.pre_trigger = 0;
+
+	isr_trigger.INT_ID = INTERRUPT2;
+	isr_trigger.INT_control = Raising;
+
+	sei();
+
+	Benchmark_init();
+	DC_motor_Init();
+	LCD_init();
+	ADC_init();
+	Debounce_init();
+	SET_BIT(BENCHMARK_ISR_DIRECTION_PORT, BENCHMARK_ISR_PIN);
+
+	BENCHMARK_RUN("timer_init", Timer_init(&timer));
+	BENCHMARK_RUN("timer_init_tick", Timer_init(&tick));
+	/* stopped again, its interrupt would add to the paths below */
+	BENCHMARK_RUN("timer_deinit", Timer_DeInit(Timer2));
+
+	/* the first conversion after enabling the ADC is longer */
+	BENCHMARK_RUN("adc_read_channel_first", res_value = ADC_readChannel(0));
+	BENCHMARK_RUN("adc_read_channel", res_value = ADC_readChannel(0));
+
+	BENCHMARK_RUN("duty_update", Timer_changeCompareValue(Timer0, DutyCurve_map(res_value), 0));
+	BENCHMARK_RUN("lcd_display_string", LCD_displayString("ADC Value = "));
+	BENCHMARK_RUN("lcd_integer_to_string", LCD_intgerToString(1023));
+	/* a pass of the loop at a tick, the one sampling the potentiometer */
+	App_tick();
+	BENCHMARK_RUN("main_loop_iteration", App_loopIteration());
+
+	Capture_init(&capture);
+	BENCHMARK_RUN("capture_record_armed", Capture_record(res_value, 128, 1, 0));
+	Capture_trigger();
+	BENCHMARK_RUN("capture_record_trigger", Capture_record(res_value, 128, 1, 0));
+	BENCHMARK_RUN("capture_record_post", Capture_record(res_value, 128, 1, 0));
+
+	/*
+	 * fixed point math, every operation with its load and store of the operands
+	 * then its result against the one of the C reference on the host
+	 */
+	BENCHMARK_RUN("fixed_add16", g_fixedResult16 = Fixed_add16(g_fixedA16, g_fixedB16));
+	Benchmark_expect("fixed_add16", g_fixedResult16, 11111);
+	BENCHMARK_RUN("fixed_sub16", g_fixedResult16 = Fixed_sub16(g_fixedA16, g_fixedB16));
+	Benchmark_expect("fixed_sub16", g_fixedResult16, FIXED_Q15_MIN);
+	BENCHMARK_RUN("fixed_add32", g_fixedResult32 = Fixed_add32(g_fixedA32, g_fixedB32));
+	Benchmark_expect("fixed_add32", g_fixedResult32, 42047L);
+	BENCHMARK_RUN("fixed_sub32", g_fixedResult32 = Fixed_sub32(g_fixedA32, g_fixedB32));
+	Benchmark_expect("fixed_sub32", g_fixedResult32, -369727L);
+	BENCHMARK_RUN("fixed_mul_u16", g_fixedResult32 = (sint32)Fixed_mulU16(g_fixedA16, g_fixedB16));
+	Benchmark_expect("fixed_mul_u16", g_fixedResult32, 1247648096L);
+	BENCHMARK_RUN("fixed_mul_s16", g_fixedResult32 = Fixed_mulS16(g_fixedA16, g_fixedB16));
+	Benchmark_expect("fixed_mul_s16", g_fixedResult32, -289564320L);
+	/* the generic multiplication of gcc, for comparison */
+	BENCHMARK_RUN("fixed_mul_s16_c", g_fixedResult32 = (sint32)g_fixedA16 * g_fixedB16);
+	BENCHMARK_RUN("fixed_mul_q15", g_fixedResult16 = Fixed_mulQ15(g_fixedA16, g_fixedB16));
+	Benchmark_expect("fixed_mul_q15", g_fixedResult16, -8837);
+	BENCHMARK_RUN("fixed_mul_q7_8", g_fixedResult16 = Fixed_mulQ7_8(g_fixedA16, g_fixedB16));
+	Benchmark_expect("fixed_mul_q7_8", g_fixedResult16, FIXED_Q15_MIN);
+	BENCHMARK_RUN("fixed_mul_q16_16", g_fixedResult32 = Fixed_mulQ16_16(g_fixedA32, g_fixedB32));
+	Benchmark_expect("fixed_mul_q16_16", g_fixedResult32, -514718L);
+	BENCHMARK_RUN("fixed_mul_q16_16_c", g_fixedResult32 = (sint32)(((sint64)g_fixedA32 * g_fixedB32) >> 16));
+	BENCHMARK_RUN("fixed_reciprocal_q16_16", g_fixedResult32 = Fixed_reciprocalQ16_16(g_fixedB32));
+	Benchmark_expect("fixed_reciprocal_q16_16", g_fixedResult32, 20861L);
+	BENCHMARK_RUN("fixed_sqrt_q16_16", g_fixedResult32 = Fixed_sqrtQ16_16(g_fixedB32));
+	Benchmark_expect("fixed_sqrt_q16_16", g_fixedResult32, 116159L);
+	BENCHMARK_RUN("fixed_sin_q15", g_fixedResult16 = Fixed_sinQ15(g_fixedAngle));
+	Benchmark_expect("fixed_sin_q15", g_fixedResult16, 24952);
+	BENCHMARK_RUN("fixed_cos_q15", g_fixedResult16 = Fixed_cosQ15(g_fixedAngle));
+	Benchmark_expect("fixed_cos_q15", g_fixedResult16, 21238);
+	Benchmark_checkSaturation();
+
+	/* whole vector from the edge to reti, driver dispatch without a call back */
+	External_Interrupt_init(&isr_trigger);
+	BENCHMARK_RUN("isr_int2_empty", Benchmark_triggerInt2());
+
+	/* the same vector running the debouncing tick of the application */
+	Interrupt_setCallBack(Debounce_tick, INTERRUPT2);
+	BENCHMARK_RUN("isr_int2_debounce_tick", Benchmark_triggerInt2());
+
+	/* edge cost without the vector, to subtract from the two above */
+	External_Interrupt_disable(INTERRUPT2);
+	BENCHMARK_RUN("isr_trigger_baseline", Benchmark_triggerInt2());
+
+#if (EXTERNAL_INTERRUPT_ENCODER_MODE != DISABLE)
+	/* decoding of an edge from the edge to reti, then the toggle alone */
+	External_Interrupt_encoderInit();
+	SET_BIT(DDRD, ENCODER_A_PIN);
+	BENCHMARK_RUN("isr_encoder_edge", Benchmark_triggerEncoder());
+	External_Interrupt_disable(INTERRUPT0);
+	BENCHMARK_RUN("isr_encoder_baseline", Benchmark_triggerEncoder());
+#endif
+
+	Benchmark_putString("benchmark,done,0\n");
+
+	/* sleeping with the interrupts disabled ends simavr */
+	cli();
+	sleep_enable();
+	sleep_cpu();
+
+	return 0;
+}
+
+#endif /*BENCHMARK*/
@@ -0,0 +1,64 @@
+/**********************************************************************************
+ * [FILE NAME]: benchmark.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Benchmark firmware of the key paths, built with -DBENCHMARK
+ *                instead of the application (Tools/benchmark.sh) and run
+ *                under simavr. Every path is measured by Timer1 counting the
+ *                CPU cycles and reported on the simavr console register as
+ *                one "benchmark,<name>,<cycles>" line.
+ *
+ ***********************************************************************************/
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include "app_file.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*
+ * Register printed by simavr, the TWI is not used by the firmware
+ * so its bit rate register is free
+ */
+#define BENCHMARK_CONSOLE_REGISTER               TWBR
+
+/*INT2 (PB2) edge triggered by the firmware itself to measure a whole ISR*/
+#define BENCHMARK_ISR_DIRECTION_PORT             DDRB
+#define BENCHMARK_ISR_DATA_PORT                  PORTB
+#define BENCHMARK_ISR_PIN                        PB2
+
+/*Measure one statement, the cost of the measurement itself is removed*/
+#define BENCHMARK_RUN(name, statement) \
+	do { \
+		uint32 benchmark_start = Benchmark_now(); \
+		statement; \
+		Benchmark_report((name), Benchmark_now() - benchmark_start); \
+	} while(0)
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to start Timer1 as 32-bit cycle counter and measure
+ *              the cost of a measurement
+ */
+void Benchmark_init(void);
+
+/*
+ * Description: Function to get the cycles since Benchmark_init
+ */
+uint32 Benchmark_now(void);
+
+/*
+ * Description: Function to print one result line on the console register
+ */
+void Benchmark_report(const char * name, uint32 cycles);
+
+#endif /* BENCHMARK_H_ */
@@ -0,0 +1,491 @@
+/**********************************************************************************
+ * [FILE NAME]: bldc_motor.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the sensorless six-step driver of the BLDC motor,
+ *                empty when BLDC_MOTOR is disabled.
+ *
+ ***********************************************************************************/
+
+#include"bldc_motor.h"
+
+#if (BLDC_MOTOR != DISABLE)
+
+#include"overcurrent.h"
+#include"profiler.h"
+#include"isr_instrumentation.h"
+
+#if (OVERCURRENT_FAST_PATH != DISABLE)
+#error "The BLDC driver uses the analog comparator, disable OVERCURRENT_FAST_PATH"
+#endif
+
+#if (PROFILER != DISABLE) || (ISR_INSTRUMENTATION != DISABLE)
+#error "The BLDC driver uses Timer1, disable PROFILER and ISR_INSTRUMENTATION"
+#endif
+
+#if (TIMER_POST_EVENTS != DISABLE)
+#error "The steps can't wait for the main loop, disable TIMER_POST_EVENTS"
+#endif
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define BLDC_STEPS                               6
+
+/*
+ * Step of the align, the rotor stops 90 electrical degrees ahead of it: at
+ * the start of the second step after it, the first one of the ramp
+ */
+#define BLDC_ALIGN_STEP                          4
+
+/*MUX4:0, single ended channels*/
+#define BLDC_MUX_MASK                            0X1F
+
+/*
+ * ACIS1:0 of the crossing, AIN0 (neutral) is the positive input:
+ * ACO = 1 while the neutral is above the floating phase
+ * Rising back-EMF: ACO falls, falling back-EMF: ACO rises
+ * After the crossing ACO equals ACIS0
+ */
+#define BLDC_BEMF_RISING                         (1<<ACIS1)
+#define BLDC_BEMF_FALLING                        ((1<<ACIS1) | (1<<ACIS0))
+
+#define BLDC_GATES(HIGH,LOW)                     ((1<<(HIGH)) | (1<<(LOW)))
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint8 gates;        /* pins of BLDC_GATE_PORT */
+	uint8 channel;      /* multiplexer, floating phase */
+	uint8 edge;         /* ACIS1:0 of its crossing */
+
+}Bldc_StepType;
+
+typedef enum
+{
+	BLDC_EVENT_ALIGN,       /* end of an align chunk */
+	BLDC_EVENT_COMMUTATE,   /* 30 degrees after the zero crossing */
+	BLDC_EVENT_ARM,         /* end of the blanking */
+	BLDC_EVENT_DEADLINE     /* ramp: forced step, running: stall */
+
+}Bldc_EventType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/*
+ * Six steps of 60 electrical degrees, forward rotation
+ * Two steps in a row never swap the sides of one phase: one port write, no
+ * dead time needed
+ */
+static const Bldc_StepType g_bldcSteps[BLDC_STEPS] PROGMEM =
+{
+		{BLDC_GATES(BLDC_AH_PIN, BLDC_BL_PIN), BLDC_BEMF_C_CHANNEL, BLDC_BEMF_FALLING},
+		{BLDC_GATES(BLDC_AH_PIN, BLDC_CL_PIN), BLDC_BEMF_B_CHANNEL, BLDC_BEMF_RISING},
+		{BLDC_GATES(BLDC_BH_PIN, BLDC_CL_PIN), BLDC_BEMF_A_CHANNEL, BLDC_BEMF_FALLING},
+		{BLDC_GATES(BLDC_BH_PIN, BLDC_AL_PIN), BLDC_BEMF_C_CHANNEL, BLDC_BEMF_RISING},
+		{BLDC_GATES(BLDC_CH_PIN, BLDC_AL_PIN), BLDC_BEMF_B_CHANNEL, BLDC_BEMF_FALLING},
+		{BLDC_GATES(BLDC_CH_PIN, BLDC_BL_PIN), BLDC_BEMF_A_CHANNEL, BLDC_BEMF_RISING}
+};
+
+/* Written by the interrupts once started, by the main loop otherwise */
+static volatile uint8 g_bldcState = BLDC_STOPPED;
+static uint8 g_bldcEvent = BLDC_EVENT_ALIGN;
+static uint8 g_bldcStep = 0;
+static uint8 g_bldcEdge = 0;             /* ACIS1:0 of the current step */
+static uint8 g_bldcDuty = 0;             /* once the loop is closed */
+static uint8 g_bldcCount = 0;            /* align chunks left, then synced ramp steps */
+static uint8 g_bldcRampSteps = 0;
+static bool g_bldcZeroCross = FALSE;     /* in the current step */
+static uint16 g_bldcStepStart = 0;       /* Timer1 count */
+static uint16 g_bldcLastZeroCross = 0;
+static uint16 g_bldcInterval = 0;        /* forced step of the ramp */
+static volatile uint16 g_bldcPeriod = 0; /* average step, the interval in the ramp */
+static SharedState_SequenceType g_bldcSequence = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: gates off first, then the interrupts, with the interrupts
+ *              disabled
+ */
+static void Bldc_off(Bldc_StateType state)
+{
+	BLDC_GATE_PORT &= ~BLDC_GATE_MASK;
+	TIMER1_INTERRUPT_MASK_REGISTER &= ~(1<<TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A);
+	ACSR &= ~(1<<ACIE);
+	Timer_changeCompareValue(BLDC_PWM_TIMER, 0, BLDC_PWM_CHANNEL);
+	g_bldcState = state;
+	SHARED_STATE_PUBLISH(g_bldcSequence);
+}
+
+/*
+ * Description: next step at now: gates, floating phase and edge of the
+ *              comparator, then the blanking until the ARM event
+ */
+static void Bldc_commutate(uint16 now)
+{
+	const Bldc_StepType *step_Ptr;
+	uint16 blanking;
+
+	g_bldcStep = (g_bldcStep == (BLDC_STEPS - 1)) ? 0 : (g_bldcStep + 1);
+	step_Ptr = &g_bldcSteps[g_bldcStep];
+
+	WRITE_FIELD(BLDC_GATE_PORT, BLDC_GATE_MASK, pgm_read_byte(&step_Ptr->gates));
+	WRITE_FIELD(ADMUX, BLDC_MUX_MASK, pgm_read_byte(&step_Ptr->channel));
+	/* ACIE off while the edge changes, the change may set ACI */
+	g_bldcEdge = pgm_read_byte(&step_Ptr->edge);
+	ACSR = g_bldcEdge;
+
+	g_bldcZeroCross = FALSE;
+	g_bldcStepStart = now;
+
+	/* the current of the phase turned off recirculates, its diode hides the crossing */
+	blanking = g_bldcPeriod >> 2;
+	if(blanking < BLDC_BLANKING_MIN_US)
+	{
+		blanking = BLDC_BLANKING_MIN_US;
+	}
+	TIMER1_OUTPUT_COMPARE_REGISTER_A = now + blanking;
+	g_bldcEvent = BLDC_EVENT_ARM;
+}
+
+/*
+ * Description: crossing at now, the ramp counts it, running schedules the
+ *              step half an average step later
+ */
+static void Bldc_zeroCross(uint16 now)
+{
+	uint16 period = now - g_bldcLastZeroCross;
+	uint16 delay;
+
+	g_bldcLastZeroCross = now;
+	g_bldcZeroCross = TRUE;
+
+	if(g_bldcState == BLDC_RAMP)
+	{
+		g_bldcCount++;
+		if(g_bldcCount < BLDC_SYNC_STEPS)
+		{
+			/* the deadline forces the step */
+			return;
+		}
+		/* close the loop at the speed of the ramp */
+		g_bldcPeriod = g_bldcInterval;
+		g_bldcState = BLDC_RUNNING;
+		Timer_changeCompareValue(BLDC_PWM_TIMER, g_bldcDuty, BLDC_PWM_CHANNEL);
+	}
+	else if(period > BLDC_MAX_PERIOD_US)
+	{
+		Bldc_off(BLDC_STALLED);
+		return;
+	}
+	else
+	{
+		g_bldcPeriod = (g_bldcPeriod + period) >> 1;
+	}
+	SHARED_STATE_PUBLISH(g_bldcSequence);
+
+	delay = g_bldcPeriod >> 1;
+	delay = (delay > (BLDC_ADVANCE_US + BLDC_MIN_DELAY_US)) ? (delay - BLDC_ADVANCE_US) : BLDC_MIN_DELAY_US;
+	TIMER1_OUTPUT_COMPARE_REGISTER_A = now + delay;
+	g_bldcEvent = BLDC_EVENT_COMMUTATE;
+}
+
+/*
+ * Description: end of the blanking, the deadline of the step, then the
+ *              comparator: a crossing during the blanking (the rotor leads
+ *              the ramp, or speeds up) counts at once
+ */
+static void Bldc_arm(void)
+{
+	TIMER1_OUTPUT_COMPARE_REGISTER_A = g_bldcStepStart +
+			((g_bldcState == BLDC_RAMP) ? g_bldcInterval : (uint16)(g_bldcPeriod << 1));
+	g_bldcEvent = BLDC_EVENT_DEADLINE;
+
+	ACSR = g_bldcEdge | (1<<ACI);
+	if( (BIT_IS_SET(ACSR, ACO) != 0) == (BIT_IS_SET(g_bldcEdge, ACIS0) != 0) )
+	{
+		Bldc_zeroCross(TIMER1_INITIAL_VALUE_REGISTER);
+		return;
+	}
+	/* an edge since ACI was cleared is pending already */
+	ACSR = g_bldcEdge | (1<<ACIE);
+}
+
+/*
+ * Description: step without a crossing: forced in the ramp, a stall
+ *              running
+ */
+static void Bldc_deadline(uint16 now)
+{
+	ACSR = g_bldcEdge;
+
+	if(g_bldcState != BLDC_RAMP)
+	{
+		Bldc_off(BLDC_STALLED);
+		return;
+	}
+
+	if(!g_bldcZeroCross)
+	{
+		g_bldcCount = 0;
+	}
+	g_bldcRampSteps++;
+	if(g_bldcRampSteps == BLDC_RAMP_MAX_STEPS)
+	{
+		Bldc_off(BLDC_STALLED);
+		return;
+	}
+
+	if(g_bldcInterval > BLDC_RAMP_END_US)
+	{
+		g_bldcInterval -= g_bldcInterval >> BLDC_RAMP_SHIFT;
+		if(g_bldcInterval < BLDC_RAMP_END_US)
+		{
+			g_bldcInterval = BLDC_RAMP_END_US;
+		}
+	}
+	g_bldcPeriod = g_bldcInterval;
+
+	Bldc_commutate(now);
+}
+
+/*
+ * Description: end of an align chunk, the ramp starts after the last one
+ */
+static void Bldc_align(uint16 now)
+{
+	g_bldcCount--;
+	if(g_bldcCount != 0)
+	{
+		TIMER1_OUTPUT_COMPARE_REGISTER_A = now + BLDC_ALIGN_CHUNK_US;
+		return;
+	}
+
+	Timer_changeCompareValue(BLDC_PWM_TIMER, BLDC_RAMP_DUTY, BLDC_PWM_CHANNEL);
+	g_bldcState = BLDC_RAMP;
+	g_bldcInterval = BLDC_RAMP_START_US;
+	g_bldcPeriod = BLDC_RAMP_START_US;
+	g_bldcRampSteps = 0;
+	g_bldcLastZeroCross = now;
+
+	/* the step before the first one of the ramp, Bldc_commutate moves on */
+	g_bldcStep = BLDC_ALIGN_STEP + 1;
+	if(g_bldcStep == BLDC_STEPS)
+	{
+		g_bldcStep = 0;
+	}
+	Bldc_commutate(now);
+}
+
+/*******************************************************************************
+ *                       Interrupt Service Routines                            *
+ *******************************************************************************/
+
+ISR(ANA_COMP_vect)
+{
+	/* time of the crossing first, the latency is the same every step */
+	uint16 now = TIMER1_INITIAL_VALUE_REGISTER;
+
+	/* one crossing per step */
+	ACSR = g_bldcEdge;
+	Bldc_zeroCross(now);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: Bldc_init
+ *
+ * [Description]:  Function to initialize the driver
+ *                 - Gates outputs, all off
+ *                 - AIN0 and the channels of the phases inputs without pull up
+ *                 - Multiplexer to the comparator: ACME set, ADC off
+ *                 - Timer1 free running at BLDC_TIMER_CLOCK, no interrupt yet
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Bldc_init(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+
+	BLDC_GATE_PORT &= ~BLDC_GATE_MASK;
+	BLDC_GATE_DIRECTION_PORT |= BLDC_GATE_MASK;
+
+	CLEAR_BIT(DDRB, PB2);
+	CLEAR_BIT(PORTB, PB2);
+	DDRA &= ~((1<<BLDC_BEMF_A_CHANNEL) | (1<<BLDC_BEMF_B_CHANNEL) | (1<<BLDC_BEMF_C_CHANNEL));
+	PORTA &= ~((1<<BLDC_BEMF_A_CHANNEL) | (1<<BLDC_BEMF_B_CHANNEL) | (1<<BLDC_BEMF_C_CHANNEL));
+
+	CLEAR_BIT(ADCSRA, ADEN);
+	SET_BIT(SFIOR, ACME);
+	/* comparator on, AIN0 not the bandgap, no capture, ACIE off */
+	ACSR = (1<<ACI);
+
+	/* run-time slot unless bound at build time (isr_bindings.h) */
+#ifndef TIMER1_ISR_HANDLER
+	Timer_setCallBack(Bldc_timerEvent, Timer1);
+#endif
+
+	/*Normal mode, compare outputs disconnected, compare A only*/
+	TIMER1_CONTROL_REGIRSTER_A = 0X00;
+	TIMER1_INTERRUPT_MASK_REGISTER &= ~( (1<<TIMER1_OUTPUT_OVERFLOW_INTERRUPT) |
+			(1<<TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A) | (1<<TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_B) );
+	TIMER1_CONTROL_REGIRSTER_B = BLDC_TIMER_CLOCK;
+
+	g_bldcState = BLDC_STOPPED;
+	SREG = sreg;
+
+}/*End of Bldc_init*/
+
+/***************************************************************************************************
+ * [Function Name]: Bldc_start
+ *
+ * [Description]:  Function to start the motor
+ *                 - Gates of BLDC_ALIGN_STEP at BLDC_ALIGN_DUTY
+ *                 - BLDC_ALIGN_CHUNKS compares of BLDC_ALIGN_CHUNK_US, the
+ *                   interrupts go on with the ramp and close the loop
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the motor is aligned, ramped or running already
+ ***************************************************************************************************/
+bool Bldc_start(void)
+{
+	uint8 sreg;
+
+	if( (g_bldcState != BLDC_STOPPED) && (g_bldcState != BLDC_STALLED) )
+	{
+		return FALSE;
+	}
+
+	sreg = SREG;
+	cli();
+
+	g_bldcStep = BLDC_ALIGN_STEP;
+	g_bldcCount = BLDC_ALIGN_CHUNKS;
+	g_bldcEvent = BLDC_EVENT_ALIGN;
+	ACSR = (1<<ACI);
+	WRITE_FIELD(BLDC_GATE_PORT, BLDC_GATE_MASK, pgm_read_byte(&g_bldcSteps[BLDC_ALIGN_STEP].gates));
+	Timer_changeCompareValue(BLDC_PWM_TIMER, BLDC_ALIGN_DUTY, BLDC_PWM_CHANNEL);
+
+	TIMER1_OUTPUT_COMPARE_REGISTER_A = TIMER1_INITIAL_VALUE_REGISTER + BLDC_ALIGN_CHUNK_US;
+	CLEAR_FLAG(TIMER1_INTERRUPT_FLAG_REGISTER, OCF1A);
+	TIMER1_INTERRUPT_MASK_REGISTER |= (1<<TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A);
+
+	g_bldcState = BLDC_ALIGN;
+	SHARED_STATE_PUBLISH(g_bldcSequence);
+	SREG = sreg;
+
+	return TRUE;
+
+}/*End of Bldc_start*/
+
+void Bldc_stop(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	Bldc_off(BLDC_STOPPED);
+	SREG = sreg;
+}
+
+void Bldc_setDuty(uint8 duty)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	g_bldcDuty = duty;
+	if(g_bldcState == BLDC_RUNNING)
+	{
+		Timer_changeCompareValue(BLDC_PWM_TIMER, duty, BLDC_PWM_CHANNEL);
+	}
+	SREG = sreg;
+}
+
+Bldc_StateType Bldc_getState(void)
+{
+	return (Bldc_StateType)g_bldcState;
+}
+
+uint16 Bldc_getStepPeriod(void)
+{
+	uint16 period;
+	uint8 state;
+
+	SHARED_STATE_READ(g_bldcSequence, period = g_bldcPeriod; state = g_bldcState);
+
+	return (state == BLDC_RUNNING) ? period : 0;
+}
+
+/***************************************************************************************************
+ * [Function Name]: Bldc_timerEvent
+ *
+ * [Description]:  Function of the compare A interrupt of Timer1, at the
+ *                 time of the event set by the previous one
+ *                 - ALIGN: next chunk, or the first step of the ramp
+ *                 - COMMUTATE: next step, blanking until ARM
+ *                 - ARM: deadline of the step, comparator on
+ *                 - DEADLINE: forced step of the ramp, or a stall
+ *                 The times are taken from OCR1A, not from TCNT1: the latency
+ *                 of the interrupt doesn't add up over the steps.
+ *                 A step is three flash reads, two read-modify-writes and one
+ *                 16 bits addition, no loop and no division; the function
+ *                 calls left are at the changes of state only.
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Bldc_timerEvent(void)
+{
+	uint16 now = TIMER1_OUTPUT_COMPARE_REGISTER_A;
+
+	switch(g_bldcEvent)
+	{
+	case BLDC_EVENT_COMMUTATE:
+		Bldc_commutate(now);
+		break;
+	case BLDC_EVENT_ARM:
+		Bldc_arm();
+		break;
+	case BLDC_EVENT_DEADLINE:
+		Bldc_deadline(now);
+		break;
+	default:
+		Bldc_align(now);
+		break;
+	}
+
+}/*End of Bldc_timerEvent*/
+
+#endif /*BLDC_MOTOR*/
@@ -0,0 +1,164 @@
+/**********************************************************************************
+ * [FILE NAME]: bldc_motor.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                sensorless six-step driver of a three-phase BLDC motor:
+ *                - Six gates (high and low side of phases A, B, C) on one
+ *                  port, the high sides ANDed with OC0: Timer0 chops them
+ *                - Each step drives one high and one low side from a table
+ *                  in flash, the third phase floats
+ *                - The back-EMF of the floating phase crosses the virtual
+ *                  neutral (star of three dividers on AIN0) in the middle of
+ *                  the step: the analog comparator watches it through the
+ *                  ADC multiplexer, with the edge of the step
+ *                - The next step is 30 electrical degrees (half a step) after
+ *                  the zero crossing, at a compare of Timer1
+ *                - Start: the rotor is aligned on one step, then turned open
+ *                  loop with steps shorter and shorter until the zero
+ *                  crossings follow the steps, then the loop closes
+ *                Everything runs in the Timer1 compare and comparator
+ *                interrupts: a step is a table read, one port write and a
+ *                few 16 bits additions, no division.
+ *
+ *                Uses Timer1 (1us per count), the comparator and the ADC
+ *                multiplexer (ADC off): not with the profiler, the ISR
+ *                instrumentation or the fast path of the overcurrent. On the
+ *                current board PORTC is the LCD and JTAG must be off.
+ *
+ ***********************************************************************************/
+
+#ifndef BLDC_MOTOR_H_
+#define BLDC_MOTOR_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "timers.h"
+#include "shared_state.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define ENABLE                                   TRUE
+#define DISABLE                                  FALSE
+
+/*Also set on the command line, Tools/bldc_check.c*/
+#ifndef BLDC_MOTOR
+#define BLDC_MOTOR                               DISABLE
+#endif
+
+/*Gates, HIGH turns the transistor on*/
+#define BLDC_GATE_PORT                           PORTC
+#define BLDC_GATE_DIRECTION_PORT                 DDRC
+#define BLDC_AH_PIN                              PC0
+#define BLDC_AL_PIN                              PC1
+#define BLDC_BH_PIN                              PC2
+#define BLDC_BL_PIN                              PC3
+#define BLDC_CH_PIN                              PC4
+#define BLDC_CL_PIN                              PC5
+#define BLDC_GATE_MASK                           ((1<<BLDC_AH_PIN) | (1<<BLDC_AL_PIN) | (1<<BLDC_BH_PIN) | \
+		(1<<BLDC_BL_PIN) | (1<<BLDC_CH_PIN) | (1<<BLDC_CL_PIN))
+
+/*PWM of the high sides, Fast PWM of Timer0 on OC0*/
+#define BLDC_PWM_TIMER                           Timer0
+#define BLDC_PWM_CHANNEL                         ChannelA
+
+/*Dividers of the phases on the multiplexer, ADC0 is the potentiometer*/
+#define BLDC_BEMF_A_CHANNEL                      1
+#define BLDC_BEMF_B_CHANNEL                      2
+#define BLDC_BEMF_C_CHANNEL                      3
+
+/*Times in Timer1 counts: F_CPU_8, 1us at 8Mhz*/
+#define BLDC_TIMER_CLOCK                         F_CPU_8
+
+/*Align: ALIGN_CHUNKS times ALIGN_CHUNK_US on one step at ALIGN_DUTY*/
+#define BLDC_ALIGN_DUTY                          50
+#define BLDC_ALIGN_CHUNK_US                      50000
+#define BLDC_ALIGN_CHUNKS                        8
+
+/*Ramp: steps from START_US to END_US, each one interval >> SHIFT shorter*/
+#define BLDC_RAMP_DUTY                           120
+#define BLDC_RAMP_START_US                       20000
+#define BLDC_RAMP_END_US                         4000
+#define BLDC_RAMP_SHIFT                          4
+#define BLDC_RAMP_MAX_STEPS                      200
+
+/*Consecutive steps with a zero crossing to close the loop*/
+#define BLDC_SYNC_STEPS                          12
+
+/*Comparator ignored after a step: a quarter of it, not less than MIN_US*/
+#define BLDC_BLANKING_MIN_US                     50
+
+/*Delay of the dividers filters, the step comes earlier by this much*/
+#define BLDC_ADVANCE_US                          0
+
+/*Shortest delay from a zero crossing to the step, for the interrupt to end*/
+#define BLDC_MIN_DELAY_US                        20
+
+/*A step longer than this is a stall, the deadline stays in 16 bits*/
+#define BLDC_MAX_PERIOD_US                       25000
+
+#if (BLDC_RAMP_START_US > BLDC_MAX_PERIOD_US) || (BLDC_MAX_PERIOD_US > 0X7FFF)
+#error "BLDC_MAX_PERIOD_US must cover the ramp and stay under 0X8000"
+#endif
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	BLDC_STOPPED, BLDC_ALIGN, BLDC_RAMP, BLDC_RUNNING, BLDC_STALLED
+
+}Bldc_StateType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to set up the gates (all off), Timer1 and the
+ *              comparator, Timer0 must run the Fast PWM already
+ */
+void Bldc_init(void);
+
+/*
+ * Description: Function to align and ramp the motor, Returns FALSE if it
+ *              turns already
+ */
+bool Bldc_start(void);
+
+/*
+ * Description: Function to turn all the gates off and stop the interrupts
+ */
+void Bldc_stop(void);
+
+/*
+ * Description: Function to set the PWM compare once the loop is closed, the
+ *              start uses BLDC_ALIGN_DUTY and BLDC_RAMP_DUTY
+ */
+void Bldc_setDuty(uint8 duty);
+
+/*
+ * Description: Function to get the state, STALLED when the zero crossings
+ *              were lost, the gates are off then
+ */
+Bldc_StateType Bldc_getState(void);
+
+/*
+ * Description: Function to get the average time of a step (60 electrical
+ *              degrees) in us, 0 until the loop is closed
+ */
+uint16 Bldc_getStepPeriod(void);
+
+/*
+ * Description: Function of the compare A interrupt of Timer1
+ */
+void Bldc_timerEvent(void);
+
+#endif /* BLDC_MOTOR_H_ */
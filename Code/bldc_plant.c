@@ -0,0 +1,400 @@
+/**********************************************************************************
+ * [FILE NAME]: bldc_plant.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the model of the BLDC motor, host build only.
+ *
+ ***********************************************************************************/
+
+#ifdef HOST_SIMULATION
+
+#include <math.h>
+#include "bldc_plant.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define BLDC_PLANT_TWO_PI                        6.283185307179586
+#define BLDC_PLANT_SIXTH_PI                      0.5235987755982988
+
+#define BLDC_PLANT_PHASES                        3
+#define BLDC_PLANT_NO_PHASE                      0XFF
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	float64 current;
+	float64 speed;
+	float64 angle;
+
+}BldcPlant_VectorType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static const BldcPlant_ConfigType *g_bldcPlantConfig_Ptr = NULL_PTR;
+static BldcPlant_VectorType g_bldcPlantState;
+static float64 g_bldcPlantAngleOffset = 0;   /* electrical, at the init */
+static float64 g_bldcPlantVoltage = 0;       /* across the pair */
+static uint8 g_bldcPlantHigh = BLDC_PLANT_NO_PHASE;
+static uint8 g_bldcPlantLow = BLDC_PLANT_NO_PHASE;
+static float64 g_bldcPlantLoad = 0;
+static float64 g_bldcPlantTorque = 0;
+static uint8 g_bldcPlantComparator = 0;
+static uint32 g_bldcPlantShootThrough = 0;
+
+/* Gates of phases A, B, C and the channels of their dividers */
+static const uint8 g_bldcPlantHighPins[BLDC_PLANT_PHASES] = {BLDC_AH_PIN, BLDC_BH_PIN, BLDC_CH_PIN};
+static const uint8 g_bldcPlantLowPins[BLDC_PLANT_PHASES] = {BLDC_AL_PIN, BLDC_BL_PIN, BLDC_CL_PIN};
+static const uint8 g_bldcPlantChannels[BLDC_PLANT_PHASES] =
+		{BLDC_BEMF_A_CHANNEL, BLDC_BEMF_B_CHANNEL, BLDC_BEMF_C_CHANNEL};
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: back-EMF shape of phase A (-1:1) at an electrical angle:
+ *              rising through 0 at 0, flat +1 over 30:150 degrees, falling
+ *              through 0 at 180, flat -1 over 210:330 degrees
+ */
+static float64 BldcPlant_shape(float64 angle)
+{
+	angle = fmod(angle, BLDC_PLANT_TWO_PI);
+	if(angle < 0)
+	{
+		angle += BLDC_PLANT_TWO_PI;
+	}
+
+	if(angle < BLDC_PLANT_SIXTH_PI)
+	{
+		return angle / BLDC_PLANT_SIXTH_PI;
+	}
+	if(angle < 5 * BLDC_PLANT_SIXTH_PI)
+	{
+		return 1;
+	}
+	if(angle < 7 * BLDC_PLANT_SIXTH_PI)
+	{
+		return (6 * BLDC_PLANT_SIXTH_PI - angle) / BLDC_PLANT_SIXTH_PI;
+	}
+	if(angle < 11 * BLDC_PLANT_SIXTH_PI)
+	{
+		return -1;
+	}
+	return (angle - 12 * BLDC_PLANT_SIXTH_PI) / BLDC_PLANT_SIXTH_PI;
+}
+
+static float64 BldcPlant_phaseShape(float64 angle, uint8 phase)
+{
+	const BldcPlant_ConfigType *config_Ptr = g_bldcPlantConfig_Ptr;
+
+	return BldcPlant_shape(angle * config_Ptr->pole_pairs + g_bldcPlantAngleOffset -
+			phase * (4 * BLDC_PLANT_SIXTH_PI));
+}
+
+/*
+ * Description: pair of phases driven by the gates, the PWM on the high side
+ *              A phase with both gates on is a shoot-through, the bridge
+ *              is taken as off
+ */
+static void BldcPlant_readGates(void)
+{
+	uint8 gates = BLDC_GATE_PORT;
+	uint32 duty;
+	uint8 highs = 0;
+	uint8 lows = 0;
+	uint8 phase;
+
+	g_bldcPlantHigh = BLDC_PLANT_NO_PHASE;
+	g_bldcPlantLow = BLDC_PLANT_NO_PHASE;
+	g_bldcPlantVoltage = 0;
+
+	for(phase = 0; phase < BLDC_PLANT_PHASES; phase++)
+	{
+		if(BIT_IS_SET(gates, g_bldcPlantHighPins[phase]) && BIT_IS_SET(gates, g_bldcPlantLowPins[phase]))
+		{
+			g_bldcPlantShootThrough++;
+			return;
+		}
+		if(BIT_IS_SET(gates, g_bldcPlantHighPins[phase]))
+		{
+			g_bldcPlantHigh = phase;
+			highs++;
+		}
+		if(BIT_IS_SET(gates, g_bldcPlantLowPins[phase]))
+		{
+			g_bldcPlantLow = phase;
+			lows++;
+		}
+	}
+
+	if( (highs != 1) || (lows != 1) )
+	{
+		g_bldcPlantHigh = BLDC_PLANT_NO_PHASE;
+		g_bldcPlantLow = BLDC_PLANT_NO_PHASE;
+		return;
+	}
+
+	duty = HostHal_getPwmDuty((uint8)BLDC_PWM_TIMER, (uint8)BLDC_PWM_CHANNEL);
+	if(duty == HOST_HAL_PWM_DISCONNECTED)
+	{
+		duty = 0;
+	}
+	g_bldcPlantVoltage = g_bldcPlantConfig_Ptr->supply_voltage * ((float64)duty / HOST_HAL_PWM_FULL_SCALE);
+}
+
+static BldcPlant_VectorType BldcPlant_derivative(const BldcPlant_VectorType *x_Ptr)
+{
+	const BldcPlant_ConfigType *config_Ptr = g_bldcPlantConfig_Ptr;
+	BldcPlant_VectorType dx;
+	float64 friction = config_Ptr->coulomb_friction * x_Ptr->speed /
+			(fabs(x_Ptr->speed) + BLDC_PLANT_FRICTION_SMOOTHING);
+	float64 shape = 0;
+
+	dx.current = 0;
+	if(g_bldcPlantHigh != BLDC_PLANT_NO_PHASE)
+	{
+		shape = BldcPlant_phaseShape(x_Ptr->angle, g_bldcPlantHigh) -
+				BldcPlant_phaseShape(x_Ptr->angle, g_bldcPlantLow);
+		dx.current = (g_bldcPlantVoltage - 2 * config_Ptr->resistance * x_Ptr->current -
+				config_Ptr->back_emf_constant * shape * x_Ptr->speed) / (2 * config_Ptr->inductance);
+	}
+	dx.speed = (config_Ptr->torque_constant * shape * x_Ptr->current -
+			config_Ptr->viscous_friction * x_Ptr->speed - friction - g_bldcPlantLoad) / config_Ptr->inertia;
+	dx.angle = x_Ptr->speed;
+
+	return dx;
+}
+
+static BldcPlant_VectorType BldcPlant_add(const BldcPlant_VectorType *x_Ptr,
+		const BldcPlant_VectorType *dx_Ptr, float64 h)
+{
+	BldcPlant_VectorType y;
+
+	y.current = x_Ptr->current + h * dx_Ptr->current;
+	y.speed = x_Ptr->speed + h * dx_Ptr->speed;
+	y.angle = x_Ptr->angle + h * dx_Ptr->angle;
+
+	return y;
+}
+
+/***************************************************************************************************
+ * [Function Name]: BldcPlant_updateComparator
+ *
+ * [Description]:  Function to drive ACO from the terminals
+ *                 - Back-EMF of each phase e = Ke w f
+ *                 - Star point of the motor: the pair driven carries the
+ *                   same current, Vn = (V_high + V_low - e_high - e_low) / 2
+ *                 - A floating terminal is Vn + e, the driven ones V and 0
+ *                 - Virtual neutral: mean of the three terminals
+ *                 - ACO = 1 while the neutral is above the input selected,
+ *                   changed only past the hysteresis
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void BldcPlant_updateComparator(void)
+{
+	const BldcPlant_ConfigType *config_Ptr = g_bldcPlantConfig_Ptr;
+	float64 emf[BLDC_PLANT_PHASES];
+	float64 terminal[BLDC_PLANT_PHASES];
+	float64 star = 0;
+	float64 neutral;
+	float64 difference;
+	uint8 channel = HostHal_getComparatorInput();
+	uint8 phase;
+	uint8 selected = BLDC_PLANT_NO_PHASE;
+
+	for(phase = 0; phase < BLDC_PLANT_PHASES; phase++)
+	{
+		emf[phase] = config_Ptr->back_emf_constant * g_bldcPlantState.speed *
+				BldcPlant_phaseShape(g_bldcPlantState.angle, phase);
+		if(g_bldcPlantChannels[phase] == channel)
+		{
+			selected = phase;
+		}
+	}
+
+	if(selected == BLDC_PLANT_NO_PHASE)
+	{
+		return;
+	}
+
+	if(g_bldcPlantHigh != BLDC_PLANT_NO_PHASE)
+	{
+		star = (g_bldcPlantVoltage - emf[g_bldcPlantHigh] - emf[g_bldcPlantLow]) / 2;
+	}
+	for(phase = 0; phase < BLDC_PLANT_PHASES; phase++)
+	{
+		terminal[phase] = star + emf[phase];
+	}
+	if(g_bldcPlantHigh != BLDC_PLANT_NO_PHASE)
+	{
+		terminal[g_bldcPlantHigh] = g_bldcPlantVoltage;
+		terminal[g_bldcPlantLow] = 0;
+	}
+
+	neutral = (terminal[0] + terminal[1] + terminal[2]) / BLDC_PLANT_PHASES;
+	difference = neutral - terminal[selected];
+
+	if(difference > config_Ptr->comparator_hysteresis / 2)
+	{
+		g_bldcPlantComparator = 1;
+	}
+	else if(difference < -config_Ptr->comparator_hysteresis / 2)
+	{
+		g_bldcPlantComparator = 0;
+	}
+	HostHal_setComparatorOutput(g_bldcPlantComparator);
+
+}/*End of BldcPlant_updateComparator*/
+
+/*
+ * Description: hook of hal_host
+ */
+static void BldcPlant_hook(void)
+{
+	BldcPlant_step();
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: BldcPlant_init
+ *
+ * [Description]:  Function to initialize the model
+ *                 - Motor at rest at the electrical angle, no load
+ *                 - The model runs every step_time
+ *
+ * [Args]:         Config_Ptr, electrical_angle
+ *
+ * [In]            Config_Ptr: Pointer to the BLDC Plant Configuration Structure,
+ *                             must stay valid as long as the model runs
+ *                 electrical_angle: -Position of the rotor (rad)
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void BldcPlant_init(const BldcPlant_ConfigType * Config_Ptr, float64 electrical_angle)
+{
+	g_bldcPlantConfig_Ptr = Config_Ptr;
+	g_bldcPlantState.current = 0;
+	g_bldcPlantState.speed = 0;
+	g_bldcPlantState.angle = 0;
+	g_bldcPlantAngleOffset = electrical_angle;
+	g_bldcPlantVoltage = 0;
+	g_bldcPlantHigh = BLDC_PLANT_NO_PHASE;
+	g_bldcPlantLow = BLDC_PLANT_NO_PHASE;
+	g_bldcPlantLoad = 0;
+	g_bldcPlantTorque = 0;
+	g_bldcPlantComparator = 0;
+	g_bldcPlantShootThrough = 0;
+
+	HostHal_setPeriodicHook(BldcPlant_hook, (uint32)(Config_Ptr->step_time * F_CPU + 0.5));
+
+}/*End of BldcPlant_init*/
+
+void BldcPlant_deinit(void)
+{
+	HostHal_setPeriodicHook(NULL_PTR, 0);
+}
+
+/***************************************************************************************************
+ * [Function Name]: BldcPlant_step
+ *
+ * [Description]:  Function to advance the model by one step
+ *                 - Sample the gates and the PWM
+ *                 - One RK4 step of the current, speed and angle, the current
+ *                   can't reverse through the diodes
+ *                 - Comparator from the terminals
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void BldcPlant_step(void)
+{
+	const BldcPlant_ConfigType *config_Ptr = g_bldcPlantConfig_Ptr;
+	float64 h = config_Ptr->step_time;
+	BldcPlant_VectorType k1, k2, k3, k4, x;
+	uint8 high = g_bldcPlantHigh;
+	uint8 low = g_bldcPlantLow;
+
+	BldcPlant_readGates();
+
+	/* the next step keeps one phase and its current, the phase left is open at once */
+	if( (g_bldcPlantHigh == BLDC_PLANT_NO_PHASE) || ((high != g_bldcPlantHigh) && (low != g_bldcPlantLow)) )
+	{
+		g_bldcPlantState.current = 0;
+	}
+
+	k1 = BldcPlant_derivative(&g_bldcPlantState);
+	x = BldcPlant_add(&g_bldcPlantState, &k1, h / 2);
+	k2 = BldcPlant_derivative(&x);
+	x = BldcPlant_add(&g_bldcPlantState, &k2, h / 2);
+	k3 = BldcPlant_derivative(&x);
+	x = BldcPlant_add(&g_bldcPlantState, &k3, h);
+	k4 = BldcPlant_derivative(&x);
+
+	g_bldcPlantState.current += h / 6 * (k1.current + 2 * k2.current + 2 * k3.current + k4.current);
+	g_bldcPlantState.speed += h / 6 * (k1.speed + 2 * k2.speed + 2 * k3.speed + k4.speed);
+	g_bldcPlantState.angle += h / 6 * (k1.angle + 2 * k2.angle + 2 * k3.angle + k4.angle);
+
+	if(g_bldcPlantState.current < 0)
+	{
+		g_bldcPlantState.current = 0;
+	}
+
+	g_bldcPlantTorque = 0;
+	if(g_bldcPlantHigh != BLDC_PLANT_NO_PHASE)
+	{
+		g_bldcPlantTorque = config_Ptr->torque_constant * g_bldcPlantState.current *
+				(BldcPlant_phaseShape(g_bldcPlantState.angle, g_bldcPlantHigh) -
+				BldcPlant_phaseShape(g_bldcPlantState.angle, g_bldcPlantLow));
+	}
+
+	BldcPlant_updateComparator();
+
+}/*End of BldcPlant_step*/
+
+void BldcPlant_setLoadTorque(float64 torque)
+{
+	g_bldcPlantLoad = torque;
+}
+
+void BldcPlant_getState(BldcPlant_StateType * State_Ptr)
+{
+	float64 electrical = fmod(g_bldcPlantState.angle * g_bldcPlantConfig_Ptr->pole_pairs +
+			g_bldcPlantAngleOffset, BLDC_PLANT_TWO_PI);
+
+	State_Ptr->current = g_bldcPlantState.current;
+	State_Ptr->speed = g_bldcPlantState.speed;
+	State_Ptr->angle = g_bldcPlantState.angle;
+	State_Ptr->electrical_angle = (electrical < 0) ? (electrical + BLDC_PLANT_TWO_PI) : electrical;
+	State_Ptr->torque = g_bldcPlantTorque;
+	State_Ptr->comparator = g_bldcPlantComparator;
+	State_Ptr->shoot_through = g_bldcPlantShootThrough;
+}
+
+#endif /*HOST_SIMULATION*/
@@ -0,0 +1,115 @@
+/**********************************************************************************
+ * [FILE NAME]: bldc_plant.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Model of a three-phase BLDC motor for the host build
+ *                (HOST_SIMULATION), closing the loop around the six-step
+ *                driver running on hal_host:
+ *                - Inputs: the six gates on BLDC_GATE_PORT and the PWM duty
+ *                  of OC0 chopping the high sides
+ *                - Trapezoidal back-EMF, flat over 120 electrical degrees,
+ *                  the phases 120 degrees apart
+ *                - Electrical: the current of the pair driven through both
+ *                  phases, 2L di/dt = V - 2R i - (e_high - e_low), no
+ *                  reverse current (diodes)
+ *                - Mechanical: J dw/dt = Kt (f_high - f_low) i - B w
+ *                  - Tc sign(w) - T_load
+ *                - Outputs: the floating phase against the virtual neutral
+ *                  (mean of the three terminals) on the analog comparator,
+ *                  through the input selected by the multiplexer
+ *                Fixed step RK4 called by the periodic hook of hal_host. The
+ *                PWM is averaged and the current commutates at once: no
+ *                demagnetization pulse, the blanking of the driver isn't
+ *                exercised by the model.
+ *
+ ***********************************************************************************/
+
+#ifndef BLDC_PLANT_H_
+#define BLDC_PLANT_H_
+
+#ifdef HOST_SIMULATION
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "bldc_motor.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Coulomb friction is smoothed under this speed (rad/s) to keep RK4 stable*/
+#define BLDC_PLANT_FRICTION_SMOOTHING            0.1
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	/* Motor, per phase */
+	float64 resistance;           /* ohm */
+	float64 inductance;           /* henry */
+	float64 back_emf_constant;    /* V / (rad/s) of the shaft, flat part */
+	float64 torque_constant;      /* N.m / A */
+	uint8 pole_pairs;
+	float64 inertia;              /* kg.m^2 */
+	float64 viscous_friction;     /* N.m / (rad/s) */
+	float64 coulomb_friction;     /* N.m */
+	float64 supply_voltage;       /* V of the bridge */
+
+	/* Comparator */
+	float64 comparator_hysteresis;   /* V at the terminals, noise of the dividers */
+
+	/* Integration */
+	float64 step_time;            /* seconds */
+
+}BldcPlant_ConfigType;
+
+typedef struct
+{
+	float64 current;              /* A of the pair driven */
+	float64 speed;                /* rad/s of the shaft */
+	float64 angle;                /* rad of the shaft */
+	float64 electrical_angle;     /* rad, 0:2pi */
+	float64 torque;               /* N.m of the motor */
+	uint8 comparator;             /* ACO */
+	uint32 shoot_through;         /* steps with both sides of a phase on */
+
+}BldcPlant_StateType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to reset the motor at an electrical angle (rad) and
+ *              run it every step_time of the simulated time of hal_host
+ */
+void BldcPlant_init(const BldcPlant_ConfigType * Config_Ptr, float64 electrical_angle);
+
+/*
+ * Description: Function to stop running the model
+ */
+void BldcPlant_deinit(void);
+
+/*
+ * Description: Function to advance the model by step_time, called by hal_host
+ */
+void BldcPlant_step(void);
+
+/*
+ * Description: Function to set the torque of the load (N.m)
+ */
+void BldcPlant_setLoadTorque(float64 torque);
+
+/*
+ * Description: Function to get the state of the motor
+ */
+void BldcPlant_getState(BldcPlant_StateType * State_Ptr);
+
+#endif /*HOST_SIMULATION*/
+
+#endif /* BLDC_PLANT_H_ */
@@ -0,0 +1,240 @@
+/**********************************************************************************
+ * [FILE NAME]: capture.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the capture of the control loop.
+ *
+ ***********************************************************************************/
+
+#include <stdlib.h>
+#include"capture.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+#if (CAPTURE_CHANNEL_ADC != DISABLE)
+uint16 g_capture_adc[CAPTURE_SIZE];
+#endif
+#if (CAPTURE_CHANNEL_DUTY != DISABLE)
+uint8 g_capture_duty[CAPTURE_SIZE];
+#endif
+#if (CAPTURE_CHANNEL_DIRECTION != DISABLE)
+uint8 g_capture_direction[CAPTURE_SIZE];
+#endif
+#if (CAPTURE_CHANNEL_SPEED != DISABLE)
+sint16 g_capture_speed[CAPTURE_SIZE];
+#endif
+
+/*
+ * Written by the tick interrupt while armed or triggered, by the main loop
+ * only while idle or frozen
+ */
+volatile uint8 g_capture_state = CAPTURE_IDLE;
+volatile uint8 g_capture_head = 0;
+volatile uint8 g_capture_filled = 0;       /* pre trigger samples still missing */
+volatile uint8 g_capture_remaining = 0;    /* post trigger samples still missing */
+volatile bool g_capture_softwareTrigger = FALSE;
+uint8 g_capture_trigger = CAPTURE_TRIGGER_SOFTWARE;
+uint8 g_capture_channel = CAPTURE_ADC;
+sint16 g_capture_threshold = 0;
+sint16 g_capture_previous = 0;
+uint8 g_capture_triggerHead = 0;
+
+static uint8 g_capturePreTrigger = 0;
+static uint8 g_captureDumpIndex = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static uint8 * Capture_putNumber(uint8 * Line_Ptr, sint16 value)
+{
+	itoa(value, (char *)Line_Ptr, 10);
+	while(*Line_Ptr != '\0')
+	{
+		Line_Ptr++;
+	}
+
+	return Line_Ptr;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void Capture_init(const Capture_ConfigType * Config_Ptr)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	g_capture_state = CAPTURE_IDLE;
+	SREG = sreg;
+
+	g_capture_trigger = Config_Ptr->trigger;
+	g_capture_channel = Config_Ptr->channel;
+	g_capture_threshold = Config_Ptr->threshold;
+	g_capturePreTrigger = (Config_Ptr->pre_trigger < CAPTURE_SIZE) ? Config_Ptr->pre_trigger : (CAPTURE_SIZE - 1);
+
+	Capture_arm();
+}
+
+/***************************************************************************************************
+ * [Function Name]: Capture_arm
+ *
+ * [Description]:  Function to arm the capture
+ *                 - The trigger waits for pre_trigger samples of history
+ *                 - The capture is frozen (CAPTURE_SIZE - pre_trigger - 1)
+ *                   samples after the trigger sample
+ *                 Any capture in progress is lost
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Capture_arm(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	g_capture_head = 0;
+	g_capture_filled = g_capturePreTrigger;
+	g_capture_remaining = CAPTURE_SIZE - 1 - g_capturePreTrigger;
+	g_capture_softwareTrigger = FALSE;
+	g_capture_previous = 0;
+	g_captureDumpIndex = 0;
+	g_capture_state = CAPTURE_ARMED;
+	SREG = sreg;
+
+}/*End of Capture_arm*/
+
+void Capture_trigger(void)
+{
+	g_capture_softwareTrigger = TRUE;
+}
+
+Capture_State Capture_getState(void)
+{
+	return (Capture_State)g_capture_state;
+}
+
+uint8 Capture_getCount(void)
+{
+	return (g_capture_state == CAPTURE_FROZEN) ? CAPTURE_SIZE : 0;
+}
+
+/***************************************************************************************************
+ * [Function Name]: Capture_getSample
+ *
+ * [Description]:  Function to read a sample of a frozen capture
+ *                 The oldest sample is the one at the head, overwritten next
+ *                 The disabled channels read as zero
+ *
+ * [Args]:         index, Sample_Ptr
+ *
+ * [In]            index: -0 for the oldest sample, Capture_getTriggerIndex()
+ *                         for the trigger sample
+ *
+ * [Out]           Sample_Ptr: Pointer to the sample
+ *
+ * [Returns]:      FALSE if not frozen or index out of the capture, TRUE otherwise
+ ***************************************************************************************************/
+bool Capture_getSample(uint8 index, Capture_SampleType * Sample_Ptr)
+{
+	uint8 position;
+
+	if( (g_capture_state != CAPTURE_FROZEN) || (index >= CAPTURE_SIZE) )
+	{
+		return FALSE;
+	}
+
+	position = (uint8)(g_capture_head + index) & CAPTURE_MASK;
+
+	Sample_Ptr->adc = 0;
+	Sample_Ptr->duty = 0;
+	Sample_Ptr->direction = 0;
+	Sample_Ptr->speed = 0;
+#if (CAPTURE_CHANNEL_ADC != DISABLE)
+	Sample_Ptr->adc = g_capture_adc[position];
+#endif
+#if (CAPTURE_CHANNEL_DUTY != DISABLE)
+	Sample_Ptr->duty = g_capture_duty[position];
+#endif
+#if (CAPTURE_CHANNEL_DIRECTION != DISABLE)
+	Sample_Ptr->direction = g_capture_direction[position];
+#endif
+#if (CAPTURE_CHANNEL_SPEED != DISABLE)
+	Sample_Ptr->speed = g_capture_speed[position];
+#endif
+
+	return TRUE;
+
+}/*End of Capture_getSample*/
+
+uint8 Capture_getTriggerIndex(void)
+{
+	/* CAPTURE_SIZE samples since the trigger was allowed, it is always pre_trigger */
+	return g_capturePreTrigger;
+}
+
+/***************************************************************************************************
+ * [Function Name]: Capture_dumpPoll
+ *
+ * [Description]:  Function to send a frozen capture on the UART, one line per call
+ *                 - "C<index from the trigger>,<adc>,<duty>,<direction>,<speed>\r\n"
+ *                 - The line waits for the next call if the TX buffer is full
+ *                 ASCII like the acknowledgments of the commands, so it never
+ *                 looks like the sync byte of the telemetry frames
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE once the whole capture is sent, FALSE otherwise
+ ***************************************************************************************************/
+bool Capture_dumpPoll(void)
+{
+	uint8 line[CAPTURE_DUMP_LINE_SIZE];
+	uint8 *line_Ptr = line;
+	Capture_SampleType sample;
+
+	if(!Capture_getSample(g_captureDumpIndex, &sample))
+	{
+		return (g_capture_state == CAPTURE_FROZEN);
+	}
+
+	*line_Ptr++ = 'C';
+	line_Ptr = Capture_putNumber(line_Ptr, (sint16)g_captureDumpIndex - g_capturePreTrigger);
+	*line_Ptr++ = ',';
+	line_Ptr = Capture_putNumber(line_Ptr, (sint16)sample.adc);
+	*line_Ptr++ = ',';
+	line_Ptr = Capture_putNumber(line_Ptr, sample.duty);
+	*line_Ptr++ = ',';
+	line_Ptr = Capture_putNumber(line_Ptr, sample.direction);
+	*line_Ptr++ = ',';
+	line_Ptr = Capture_putNumber(line_Ptr, sample.speed);
+	*line_Ptr++ = '\r';
+	*line_Ptr++ = '\n';
+
+	if(UART_send(line, (uint8)(line_Ptr - line)))
+	{
+		g_captureDumpIndex++;
+	}
+
+	return (g_captureDumpIndex >= CAPTURE_SIZE);
+
+}/*End of Capture_dumpPoll*/
+
+bool Capture_isDumpPending(void)
+{
+	return (g_capture_state == CAPTURE_FROZEN) && (g_captureDumpIndex < CAPTURE_SIZE);
+}
@@ -0,0 +1,277 @@
+/**********************************************************************************
+ * [FILE NAME]: capture.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                capture of the control loop, an oscilloscope in RAM:
+ *                - Armed: every tick records one sample in a circular buffer
+ *                - Triggered: a level, an edge or a software event, the
+ *                  recording goes on for the post trigger samples
+ *                - Frozen: the buffer holds the history around the trigger
+ *                  until it is read (Capture_getSample, the host simulator)
+ *                  or dumped on the UART, then armed again
+ *                Each channel has its own array and is enabled at compile
+ *                time, so the disabled ones cost no RAM and no cycle.
+ *                The recording is inline in the tick interrupt: one store per
+ *                channel, the index update and the trigger compare.
+ *
+ ***********************************************************************************/
+
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "uart.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define ENABLE                                   TRUE
+#define DISABLE                                  FALSE
+
+/*Samples of the buffer, power of two from 2 to 128*/
+#define CAPTURE_SIZE                             64
+#define CAPTURE_MASK                             (CAPTURE_SIZE - 1)
+
+#if (CAPTURE_SIZE < 2) || (CAPTURE_SIZE > 128) || (CAPTURE_SIZE & CAPTURE_MASK)
+#error "Capture size must be a power of two from 2 to 128"
+#endif
+
+/*Recorded channels, RAM = CAPTURE_SIZE * (2 + 1 + 1 + 2) bytes with all of them*/
+#define CAPTURE_CHANNEL_ADC                      ENABLE
+#define CAPTURE_CHANNEL_DUTY                     ENABLE
+#define CAPTURE_CHANNEL_DIRECTION                ENABLE
+#define CAPTURE_CHANNEL_SPEED                    DISABLE
+
+/*Longest line of the dump: "C-128,1023,255,2,-32768\r\n"*/
+#define CAPTURE_DUMP_LINE_SIZE                   26
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	CAPTURE_IDLE, CAPTURE_ARMED, CAPTURE_TRIGGERED, CAPTURE_FROZEN
+
+}Capture_State;
+
+typedef enum
+{
+	CAPTURE_TRIGGER_SOFTWARE,      /* Capture_trigger only */
+	CAPTURE_TRIGGER_ABOVE,         /* channel > threshold */
+	CAPTURE_TRIGGER_BELOW,         /* channel < threshold */
+	CAPTURE_TRIGGER_RISING,        /* channel goes above threshold */
+	CAPTURE_TRIGGER_FALLING,       /* channel goes below threshold */
+	CAPTURE_TRIGGER_CHANGE         /* channel changes by more than threshold */
+
+}Capture_TriggerType;
+
+typedef enum
+{
+	CAPTURE_ADC, CAPTURE_DUTY, CAPTURE_DIRECTION, CAPTURE_SPEED
+
+}Capture_Channel;
+
+typedef struct
+{
+	Capture_TriggerType trigger;
+	Capture_Channel channel;       /* compared by the trigger */
+	sint16 threshold;
+	uint8 pre_trigger;             /* samples before the trigger, < CAPTURE_SIZE */
+
+}Capture_ConfigType;
+
+typedef struct
+{
+	uint16 adc;
+	uint8 duty;
+	uint8 direction;
+	sint16 speed;
+
+}Capture_SampleType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to set the trigger and arm the capture
+ */
+void Capture_init(const Capture_ConfigType * Config_Ptr);
+
+/*
+ * Description: Function to arm the capture again with the same trigger
+ */
+void Capture_arm(void);
+
+/*
+ * Description: Function to trigger from the software, any trigger type
+ */
+void Capture_trigger(void);
+
+/*
+ * Description: Function to get the state of the capture
+ */
+Capture_State Capture_getState(void);
+
+/*
+ * Description: Function to get the number of samples of a frozen capture
+ */
+uint8 Capture_getCount(void);
+
+/*
+ * Description: Function to get a sample of a frozen capture, 0 is the oldest
+ *              Returns FALSE if not frozen or out of the capture
+ */
+bool Capture_getSample(uint8 index, Capture_SampleType * Sample_Ptr);
+
+/*
+ * Description: Function to get the index of the trigger sample
+ */
+uint8 Capture_getTriggerIndex(void);
+
+/*
+ * Description: Function to dump a frozen capture on the UART, one line
+ *              "C<index from the trigger>,<adc>,<duty>,<direction>,<speed>"
+ *              per call while the TX buffer has room, from the main loop
+ *              Returns TRUE once the whole capture is sent
+ */
+bool Capture_dumpPoll(void);
+
+/*
+ * Description: Function to check if a frozen capture has lines left to dump
+ */
+bool Capture_isDumpPending(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Only for Capture_record, to be inlined in the tick interrupt */
+#if (CAPTURE_CHANNEL_ADC != DISABLE)
+extern uint16 g_capture_adc[CAPTURE_SIZE];
+#endif
+#if (CAPTURE_CHANNEL_DUTY != DISABLE)
+extern uint8 g_capture_duty[CAPTURE_SIZE];
+#endif
+#if (CAPTURE_CHANNEL_DIRECTION != DISABLE)
+extern uint8 g_capture_direction[CAPTURE_SIZE];
+#endif
+#if (CAPTURE_CHANNEL_SPEED != DISABLE)
+extern sint16 g_capture_speed[CAPTURE_SIZE];
+#endif
+extern volatile uint8 g_capture_state;
+extern volatile uint8 g_capture_head;
+extern volatile uint8 g_capture_filled;
+extern volatile uint8 g_capture_remaining;
+extern volatile bool g_capture_softwareTrigger;
+extern uint8 g_capture_trigger;
+extern uint8 g_capture_channel;
+extern sint16 g_capture_threshold;
+extern sint16 g_capture_previous;
+extern uint8 g_capture_triggerHead;
+
+/*******************************************************************************
+ *                      Inline Functions                                       *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: Capture_record
+ *
+ * [Description]:  Function to record one sample, from the tick interrupt only
+ *                 - Nothing but a compare when not armed
+ *                 - The enabled channels are stored at the head
+ *                 - Armed: the trigger is checked once the pre trigger
+ *                   samples are there, Triggered: the post trigger samples
+ *                   are counted down to the freezing
+ *
+ * [Args]:         adc, duty, direction, speed
+ *
+ * [In]            Values of the channels, the disabled ones are ignored
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static inline void Capture_record(uint16 adc, uint8 duty, uint8 direction, sint16 speed)
+{
+	uint8 state = g_capture_state;
+	uint8 head;
+	sint16 value;
+	bool fire;
+
+	if( (state != CAPTURE_ARMED) && (state != CAPTURE_TRIGGERED) )
+	{
+		return;
+	}
+
+	head = g_capture_head & CAPTURE_MASK;
+#if (CAPTURE_CHANNEL_ADC != DISABLE)
+	g_capture_adc[head] = adc;
+#endif
+#if (CAPTURE_CHANNEL_DUTY != DISABLE)
+	g_capture_duty[head] = duty;
+#endif
+#if (CAPTURE_CHANNEL_DIRECTION != DISABLE)
+	g_capture_direction[head] = direction;
+#endif
+#if (CAPTURE_CHANNEL_SPEED != DISABLE)
+	g_capture_speed[head] = speed;
+#endif
+	g_capture_head = head + 1;
+
+	if(state == CAPTURE_TRIGGERED)
+	{
+		g_capture_remaining--;
+		if(g_capture_remaining == 0)
+		{
+			g_capture_state = CAPTURE_FROZEN;
+		}
+		return;
+	}
+
+	switch(g_capture_channel)
+	{
+	case CAPTURE_ADC:       value = (sint16)adc; break;
+	case CAPTURE_DUTY:      value = duty;        break;
+	case CAPTURE_DIRECTION: value = direction;   break;
+	default:                value = speed;       break;
+	}
+
+	if(g_capture_filled != 0)
+	{
+		/* the pre trigger history is not complete yet */
+		g_capture_filled--;
+		fire = FALSE;
+	}
+	else
+	{
+		switch(g_capture_trigger)
+		{
+		case CAPTURE_TRIGGER_ABOVE:   fire = (value > g_capture_threshold); break;
+		case CAPTURE_TRIGGER_BELOW:   fire = (value < g_capture_threshold); break;
+		case CAPTURE_TRIGGER_RISING:  fire = (value > g_capture_threshold) && (g_capture_previous <= g_capture_threshold); break;
+		case CAPTURE_TRIGGER_FALLING: fire = (value < g_capture_threshold) && (g_capture_previous >= g_capture_threshold); break;
+		case CAPTURE_TRIGGER_CHANGE:  fire = ((sint16)(value - g_capture_previous) > g_capture_threshold) ||
+				((sint16)(g_capture_previous - value) > g_capture_threshold); break;
+		default:                      fire = FALSE; break;
+		}
+		fire = fire || g_capture_softwareTrigger;
+	}
+	g_capture_previous = value;
+
+	if(fire)
+	{
+		/* the trigger sample is the one just recorded */
+		g_capture_triggerHead = head;
+		g_capture_state = (g_capture_remaining == 0) ? CAPTURE_FROZEN : CAPTURE_TRIGGERED;
+	}
+}
+
+#endif /* CAPTURE_H_ */
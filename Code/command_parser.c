@@ -0,0 +1,233 @@
+/**********************************************************************************
+ * [FILE NAME]: command_parser.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the command parser of the UART.
+ *
+ ***********************************************************************************/
+
+#include"command_parser.h"
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	COMMAND_WAIT_LETTER, COMMAND_WAIT_NUMBER, COMMAND_NUMBER, COMMAND_SKIP_LINE
+
+}CommandParser_State;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static const CommandParser_EntryType *g_commandTable_Ptr = NULL_PTR;
+static uint8 g_commandTableSize = 0;
+static CommandParser_HandlerType g_commandHandler = NULL_PTR;
+
+static CommandParser_State g_commandState = COMMAND_WAIT_LETTER;
+static uint8 g_commandLetter = 0;
+static bool g_commandNegative = FALSE;
+static uint8 g_commandDigits = 0;
+static sint32 g_commandValue = 0;
+
+/* Acknowledgment waiting for room in the TX buffer */
+static uint8 g_commandAck[COMMAND_PARSER_ACK_SIZE];
+static uint8 g_commandAckSize = 0;
+
+static uint16 g_commandErrors = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static void CommandParser_acknowledge(bool ok, uint8 letter)
+{
+	uint8 *ack_Ptr = g_commandAck;
+
+	if(ok)
+	{
+		*ack_Ptr++ = 'O';
+		*ack_Ptr++ = 'K';
+	}
+	else
+	{
+		*ack_Ptr++ = 'E';
+		*ack_Ptr++ = 'R';
+		*ack_Ptr++ = 'R';
+		g_commandErrors++;
+	}
+	*ack_Ptr++ = ' ';
+	*ack_Ptr++ = (letter != 0) ? letter : '?';
+	*ack_Ptr++ = '\r';
+	*ack_Ptr++ = '\n';
+
+	g_commandAckSize = (uint8)(ack_Ptr - g_commandAck);
+	if(UART_send(g_commandAck, g_commandAckSize))
+	{
+		g_commandAckSize = 0;
+	}
+}
+
+/*
+ * Description: end of a command, look it up and run its handler
+ */
+static void CommandParser_execute(void)
+{
+	uint8 i;
+	sint16 value;
+
+	if(g_commandNegative)
+	{
+		g_commandValue = -g_commandValue;
+	}
+	value = (sint16)g_commandValue;
+
+	for(i = 0; i < g_commandTableSize; i++)
+	{
+		if(g_commandTable_Ptr[i].letter == g_commandLetter)
+		{
+			CommandParser_acknowledge( (value >= g_commandTable_Ptr[i].min) && (value <= g_commandTable_Ptr[i].max) &&
+					g_commandHandler(g_commandLetter, value), g_commandLetter );
+			return;
+		}
+	}
+
+	CommandParser_acknowledge(FALSE, g_commandLetter);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void CommandParser_init(const CommandParser_EntryType * Table_Ptr, uint8 size, CommandParser_HandlerType handler)
+{
+	g_commandTable_Ptr = Table_Ptr;
+	g_commandTableSize = size;
+	g_commandHandler = handler;
+	g_commandState = COMMAND_WAIT_LETTER;
+	g_commandAckSize = 0;
+	g_commandErrors = 0;
+}
+
+void CommandParser_poll(void)
+{
+	uint8 count = 0;
+	uint8 data;
+
+	/* the commands wait in the RX buffer until their acknowledgment can be sent */
+	if(g_commandAckSize != 0)
+	{
+		if(!UART_send(g_commandAck, g_commandAckSize))
+		{
+			return;
+		}
+		g_commandAckSize = 0;
+	}
+
+	while( (count < COMMAND_PARSER_MAX_BYTES_PER_POLL) && (g_commandAckSize == 0) && UART_receiveByte(&data) )
+	{
+		CommandParser_feed(data);
+		count++;
+	}
+}
+
+/***************************************************************************************************
+ * [Function Name]: CommandParser_feed
+ *
+ * [Description]:  Function to parse one byte of a command
+ *                 - Letter, spaces, optional '-', digits, CR or LF
+ *                 - The value is accumulated digit by digit, no line buffer
+ *                 - An invalid byte makes the rest of the line ignored and
+ *                   the command is rejected at its end
+ *                 - Empty lines (LF of CR LF) are ignored
+ *
+ * [Args]:         data
+ *
+ * [In]            data: -Received byte
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void CommandParser_feed(uint8 data)
+{
+	bool end = (data == '\r') || (data == '\n');
+
+	switch(g_commandState)
+	{
+	case COMMAND_WAIT_LETTER:
+		if( (data >= 'a') && (data <= 'z') )
+		{
+			data -= 'a' - 'A';
+		}
+		if( (data >= 'A') && (data <= 'Z') )
+		{
+			g_commandLetter = data;
+			g_commandNegative = FALSE;
+			g_commandDigits = 0;
+			g_commandValue = 0;
+			g_commandState = COMMAND_WAIT_NUMBER;
+		}
+		else if(!end && (data != ' '))
+		{
+			g_commandLetter = 0;
+			g_commandState = COMMAND_SKIP_LINE;
+		}
+		break;
+
+	case COMMAND_WAIT_NUMBER:
+		if(data == ' ')
+		{
+			break;
+		}
+		if( (data == '-') && !g_commandNegative )
+		{
+			g_commandNegative = TRUE;
+			break;
+		}
+		/* first digit */
+		/* fall through */
+	case COMMAND_NUMBER:
+		if( (data >= '0') && (data <= '9') && (g_commandDigits < COMMAND_PARSER_MAX_DIGITS) )
+		{
+			g_commandValue = g_commandValue * 10 + (data - '0');
+			g_commandDigits++;
+			g_commandState = COMMAND_NUMBER;
+		}
+		else if(end && (g_commandState == COMMAND_NUMBER) && (g_commandValue <= 32767))
+		{
+			CommandParser_execute();
+			g_commandState = COMMAND_WAIT_LETTER;
+		}
+		else if(end)
+		{
+			CommandParser_acknowledge(FALSE, g_commandLetter);
+			g_commandState = COMMAND_WAIT_LETTER;
+		}
+		else
+		{
+			g_commandState = COMMAND_SKIP_LINE;
+		}
+		break;
+
+	case COMMAND_SKIP_LINE:
+	default:
+		if(end)
+		{
+			CommandParser_acknowledge(FALSE, g_commandLetter);
+			g_commandState = COMMAND_WAIT_LETTER;
+		}
+		break;
+	}
+
+}/*End of CommandParser_feed*/
+
+uint16 CommandParser_getErrors(void)
+{
+	return g_commandErrors;
+}
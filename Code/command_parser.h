@@ -0,0 +1,89 @@
+/**********************************************************************************
+ * [FILE NAME]: command_parser.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                command parser of the UART. A command is one letter and a
+ *                signed decimal number ended by CR or LF:
+ *
+ *                S512\r\n    S -12\n    M1\r
+ *
+ *                The bytes go through a state machine one at a time, the number
+ *                is accumulated as its digits arrive, so there is no line buffer
+ *                and every byte costs a bounded number of cycles (the table
+ *                lookup and the handler run once, on the end of the command).
+ *                Every command is acknowledged on the UART:
+ *                "OK <letter>\r\n" or "ERR <letter>\r\n" ('?' if no letter).
+ *                The acknowledgments are ASCII (below 0X80) so they never look
+ *                like the sync byte of the telemetry frames sharing the line.
+ *
+ ***********************************************************************************/
+
+#ifndef COMMAND_PARSER_H_
+#define COMMAND_PARSER_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "uart.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Received bytes parsed by one CommandParser_poll at most*/
+#define COMMAND_PARSER_MAX_BYTES_PER_POLL        8
+
+/*Digits of a number at most, a longer one is an error*/
+#define COMMAND_PARSER_MAX_DIGITS                5
+
+#define COMMAND_PARSER_ACK_SIZE                  8
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint8 letter;       /* upper case, lower case is accepted too */
+	sint16 min;
+	sint16 max;
+
+}CommandParser_EntryType;
+
+/*
+ * Handler of the valid commands, in range of their table entry
+ * Returns FALSE to reject the command (ERR)
+ */
+typedef bool (*CommandParser_HandlerType)(uint8 letter, sint16 value);
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to initialize the parser with the table of the
+ *              commands, the table must stay valid
+ */
+void CommandParser_init(const CommandParser_EntryType * Table_Ptr, uint8 size, CommandParser_HandlerType handler);
+
+/*
+ * Description: Function to parse the received bytes, from the main loop
+ *              At most COMMAND_PARSER_MAX_BYTES_PER_POLL bytes, the parsing
+ *              waits while an acknowledgment doesn't fit in the TX buffer
+ */
+void CommandParser_poll(void);
+
+/*
+ * Description: Function to parse one byte
+ */
+void CommandParser_feed(uint8 data);
+
+/*
+ * Description: Function to get the number of rejected commands
+ */
+uint16 CommandParser_getErrors(void);
+
+#endif /* COMMAND_PARSER_H_ */
@@ -3,12 +3,33 @@
 #ifndef COMMON_MACROS
 #define COMMON_MACROS
 
-/* Set a certain bit in any register */
+/*
+ * Set a certain bit in any register, as a statement: sbi/cbi on the low I/O
+ * registers, "REG = SET_BIT(REG,BIT)" writes twice and keeps them out
+ */
 #define SET_BIT(REG,BIT) (REG|=(1<<BIT))
 
 /* Clear a certain bit in any register */
 #define CLEAR_BIT(REG,BIT) (REG&=(~(1<<BIT)))
 
+/* Set the bits of MASK in any register, one read and one write for all of them */
+#define SET_BITS(REG,MASK) (REG|=(MASK))
+
+/* Clear the bits of MASK in any register, one read and one write for all of them */
+#define CLEAR_BITS(REG,MASK) (REG&=(~(MASK)))
+
+/*
+ * Write VALUE in the field MASK of any register, the other bits kept
+ * One read and one write, MASK and VALUE constants fold at compile time
+ */
+#define WRITE_FIELD(REG,MASK,VALUE) (REG=((REG)&(~(MASK)))|((VALUE)&(MASK)))
+
+/*
+ * Clear a flag of a register cleared by writing 1 to it (TIFR, GIFR)
+ * A plain write: SET_BIT would write back the other pending flags and clear them
+ */
+#define CLEAR_FLAG(REG,BIT) (REG=(1<<BIT))
+
 /* Toggle a certain bit in any register */
 #define TOGGLE_BIT(REG,BIT) (REG^=(1<<BIT))
 
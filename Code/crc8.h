@@ -0,0 +1,57 @@
+/**********************************************************************************
+ * [FILE NAME]: crc8.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: CRC-8 of the frames, polynomial x^8 + x^2 + x + 1 (0X07),
+ *                initial value 0X00, no reflection, no final xor.
+ *                One lookup in a 256 bytes table in flash per byte instead of
+ *                eight shifts, the update is inline for the loops of the callers.
+ *
+ ***********************************************************************************/
+
+#ifndef CRC8_H_
+#define CRC8_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define CRC8_POLYNOMIAL                          0X07
+#define CRC8_INITIAL_VALUE                       0X00
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to get the CRC of a buffer, starting from crc
+ *              (CRC8_INITIAL_VALUE or the CRC of the previous part)
+ */
+uint8 Crc8_compute(const uint8 * Data_Ptr, uint8 length, uint8 crc);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Only for Crc8_update */
+extern const uint8 g_crc8_table[256] PROGMEM;
+
+/*******************************************************************************
+ *                      Inline Functions                                       *
+ *******************************************************************************/
+
+/*
+ * Description: Function to add one byte to the CRC
+ */
+static inline uint8 Crc8_update(uint8 crc, uint8 data)
+{
+	return pgm_read_byte(&g_crc8_table[crc ^ data]);
+}
+
+#endif /* CRC8_H_ */
@@ -0,0 +1,193 @@
+/**********************************************************************************
+ * [FILE NAME]: debounce.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the buttons debouncing by vertical counters.
+ *
+ ***********************************************************************************/
+
+#include"debounce.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Bit i of g_counter0/g_counter1 is the 2-bit counter of input i */
+static uint8 g_counter0 = 0XFF;
+static uint8 g_counter1 = 0XFF;
+
+static volatile uint8 g_state = 0;
+static volatile uint8 g_pressed = 0;
+static volatile uint8 g_released = 0;
+static volatile uint8 g_longPressed = 0;
+
+static uint8 g_holdTicks[8];
+static volatile bool g_wakeMasked = FALSE;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: read the event bits in mask and clear them in one critical section
+ */
+static uint8 Debounce_takeEvents(volatile uint8 *events_Ptr, uint8 mask)
+{
+	uint8 events;
+	uint8 sreg = SREG;
+
+	cli();
+	events = *events_Ptr & mask;
+	*events_Ptr &= ~mask;
+	SREG = sreg;
+
+	return events;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void Debounce_init(void)
+{
+	uint8 i;
+
+	g_counter0 = 0XFF;
+	g_counter1 = 0XFF;
+	g_state = 0;
+	g_pressed = 0;
+	g_released = 0;
+	g_longPressed = 0;
+	g_wakeMasked = FALSE;
+
+	for(i = 0; i < 8; i++)
+	{
+		g_holdTicks[i] = 0;
+	}
+}
+
+/***************************************************************************************************
+ * [Function Name]: Debounce_tick
+ *
+ * [Description]:  Function to sample the inputs, must be called every DEBOUNCE_TICK_MS
+ *                 - Every input differing from its debounced state counts one
+ *                   sample, the counter restarts if the input agrees again
+ *                 - After 4 differing samples the debounced state toggles and
+ *                   a press or release event is latched
+ *                 - Inputs held for DEBOUNCE_LONG_PRESS_TICKS latch a long press
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Debounce_tick(void)
+{
+	uint8 sample;
+	uint8 changed;
+	uint8 state;
+	uint8 i;
+
+#if (DEBOUNCE_ACTIVE_LEVEL == LOW)
+	sample = ~DEBOUNCE_INPUT_PIN_REGISTER & DEBOUNCE_INPUTS_MASK;
+#else
+	sample = DEBOUNCE_INPUT_PIN_REGISTER & DEBOUNCE_INPUTS_MASK;
+#endif
+
+	state = g_state;
+
+	/*Vertical counter: decrement where the sample differs, reset elsewhere*/
+	changed = state ^ sample;
+	g_counter0 = ~(g_counter0 & changed);
+	g_counter1 = g_counter0 ^ (g_counter1 & changed);
+
+	/*Counter rolled over: accept the new level*/
+	changed &= g_counter0 & g_counter1;
+	state ^= changed;
+
+	g_state = state;
+	g_pressed |= state & changed;
+	g_released |= (~state) & changed;
+
+	/*Long press, only the held inputs are visited*/
+	if(state != 0)
+	{
+		for(i = 0; i < 8; i++)
+		{
+			if(BIT_IS_CLEAR(state, i))
+			{
+				g_holdTicks[i] = 0;
+			}
+			else if(g_holdTicks[i] < DEBOUNCE_LONG_PRESS_TICKS)
+			{
+				g_holdTicks[i]++;
+				if(g_holdTicks[i] == DEBOUNCE_LONG_PRESS_TICKS)
+				{
+					g_longPressed |= (1<<i);
+				}
+			}
+		}
+	}
+	else
+	{
+		for(i = 0; i < 8; i++)
+		{
+			g_holdTicks[i] = 0;
+		}
+	}
+
+	/*Inputs released and no change counting: the edge interrupt can wake again*/
+	if( g_wakeMasked && (state == 0) && (sample == 0) )
+	{
+		g_wakeMasked = FALSE;
+		External_Interrupt_enable(DEBOUNCE_WAKE_INTERRUPT);
+	}
+
+}/*End of Debounce_tick*/
+
+/***************************************************************************************************
+ * [Function Name]: Debounce_wakeCallback
+ *
+ * [Description]:  Call back of the external interrupt of the buttons
+ *                 Masks the interrupt so the bounces don't interrupt again
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Debounce_wakeCallback(void)
+{
+	External_Interrupt_disable(DEBOUNCE_WAKE_INTERRUPT);
+	g_wakeMasked = TRUE;
+
+}/*End of Debounce_wakeCallback*/
+
+uint8 Debounce_getPressed(uint8 mask)
+{
+	return Debounce_takeEvents(&g_pressed, mask);
+}
+
+uint8 Debounce_getReleased(uint8 mask)
+{
+	return Debounce_takeEvents(&g_released, mask);
+}
+
+uint8 Debounce_getLongPressed(uint8 mask)
+{
+	return Debounce_takeEvents(&g_longPressed, mask);
+}
+
+uint8 Debounce_getState(void)
+{
+	return g_state;
+}
@@ -0,0 +1,91 @@
+/**********************************************************************************
+ * [FILE NAME]: debounce.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                buttons debouncing.
+ *                Up to 8 inputs of one port are sampled every timer tick, a
+ *                2-bit vertical counter per input accepts a new level after
+ *                4 equal samples, then press, release and long press events
+ *                are latched until the application reads them.
+ *
+ ***********************************************************************************/
+
+#ifndef DEBOUNCE_H_
+#define DEBOUNCE_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "external_interrupts.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define DEBOUNCE_INPUT_PIN_REGISTER              PIND
+
+/*
+ * Inputs debounced on DEBOUNCE_INPUT_PIN_REGISTER, button of the direction on INT1
+ * In the encoder mode INT1 is the channel B of the encoder, not a button
+ */
+#if (EXTERNAL_INTERRUPT_ENCODER_MODE == DISABLE)
+#define DEBOUNCE_INPUTS_MASK                     (1<<INTERRUPT1_PIN)
+#else
+#define DEBOUNCE_INPUTS_MASK                     0
+#endif
+
+/*Buttons connected to ground with pull up resistance: pressed = LOW*/
+#define DEBOUNCE_ACTIVE_LEVEL                    LOW
+
+/*Period of Debounce_tick, 4 samples are needed to change a level*/
+#define DEBOUNCE_TICK_MS                         4
+#define DEBOUNCE_LONG_PRESS_MS                   1000
+#define DEBOUNCE_LONG_PRESS_TICKS                (DEBOUNCE_LONG_PRESS_MS / DEBOUNCE_TICK_MS)
+
+#if (DEBOUNCE_LONG_PRESS_TICKS > 255)
+#error "Long press must be shorter than 255 debounce ticks"
+#endif
+
+/*External interrupt waking the debouncing, masked until the inputs are stable*/
+#define DEBOUNCE_WAKE_INTERRUPT                  INTERRUPT1
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to initialize the debouncing, all inputs released
+ */
+void Debounce_init(void);
+
+/*
+ * Description: Function to sample the inputs, must be called every
+ *              DEBOUNCE_TICK_MS (timer call back)
+ */
+void Debounce_tick(void);
+
+/*
+ * Description: Call back of the external interrupt of the buttons
+ *              Masks the interrupt so the bounces don't interrupt again,
+ *              Debounce_tick unmasks it when the inputs are released and stable
+ */
+void Debounce_wakeCallback(void);
+
+/*
+ * Description: Functions to read and clear the events of the inputs in mask
+ *              Each physical press gives exactly one press event
+ */
+uint8 Debounce_getPressed(uint8 mask);
+uint8 Debounce_getReleased(uint8 mask);
+uint8 Debounce_getLongPressed(uint8 mask);
+
+/*
+ * Description: Function to read the debounced level of the inputs (1 = pressed)
+ */
+uint8 Debounce_getState(void);
+
+#endif /* DEBOUNCE_H_ */
@@ -0,0 +1,64 @@
+/**********************************************************************************
+ * [FILE NAME]: duty_curve.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the transfer curve between the potentiometer
+ *                and the PWM duty.
+ *
+ ***********************************************************************************/
+
+#include"duty_curve.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+#if (DUTY_CURVE_LINEARIZATION != DISABLE)
+static const uint8 g_dutyCurve_table[DUTY_CURVE_SEGMENTS + 1] PROGMEM =
+{
+		DUTY_CURVE_ENTRY(0),  DUTY_CURVE_ENTRY(1),  DUTY_CURVE_ENTRY(2),  DUTY_CURVE_ENTRY(3),
+		DUTY_CURVE_ENTRY(4),  DUTY_CURVE_ENTRY(5),  DUTY_CURVE_ENTRY(6),  DUTY_CURVE_ENTRY(7),
+		DUTY_CURVE_ENTRY(8),  DUTY_CURVE_ENTRY(9),  DUTY_CURVE_ENTRY(10), DUTY_CURVE_ENTRY(11),
+		DUTY_CURVE_ENTRY(12), DUTY_CURVE_ENTRY(13), DUTY_CURVE_ENTRY(14), DUTY_CURVE_ENTRY(15),
+		DUTY_CURVE_ENTRY(16)
+};
+#endif
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: DutyCurve_map
+ *
+ * [Description]:  Function to map a 10-bit ADC value to a Timer0/Timer2 compare value
+ *                 - The upper 4 bits select the segment of the table
+ *                 - The lower 6 bits interpolate between its two points
+ *
+ * [Args]:         adc_value
+ *
+ * [In]            adc_value: -Value read from the ADC (0:1023)
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Compare value of the PWM
+ ***************************************************************************************************/
+uint8 DutyCurve_map(uint16 adc_value)
+{
+#if (DUTY_CURVE_LINEARIZATION != DISABLE)
+	uint8 index = (uint8)(adc_value >> DUTY_CURVE_SEGMENT_SHIFT) & (DUTY_CURVE_SEGMENTS - 1);
+	uint8 fraction = (uint8)adc_value & DUTY_CURVE_FRACTION_MASK;
+	uint8 start = pgm_read_byte(&g_dutyCurve_table[index]);
+	uint8 end = pgm_read_byte(&g_dutyCurve_table[index + 1]);
+
+	/*The curve is increasing so end >= start*/
+	return start + (uint8)( ((uint16)(uint8)(end - start) * fraction) >> DUTY_CURVE_SEGMENT_SHIFT );
+#else
+	/*Timer0 is 8-bit so the 10-bit value is divided over 4*/
+	return (uint8)(adc_value >> 2);
+#endif
+
+}/*End of DutyCurve_map*/
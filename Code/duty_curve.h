@@ -0,0 +1,84 @@
+/**********************************************************************************
+ * [FILE NAME]: duty_curve.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of the transfer curve between the potentiometer (ADC)
+ *                and the PWM duty.
+ *                The curve is a flash table of 17 points generated at compile
+ *                time from the dead zone, gamma and max limit below, the
+ *                mapping interpolates linearly between two points.
+ *
+ ***********************************************************************************/
+
+#ifndef DUTY_CURVE_H_
+#define DUTY_CURVE_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define ENABLE                                   TRUE
+#define DISABLE                                  FALSE
+
+#define DUTY_CURVE_LINEARIZATION                 ENABLE
+
+/*Compare value where the motor starts moving*/
+#define DUTY_CURVE_DEAD_ZONE                     40
+/*Compare value of the pot at its end*/
+#define DUTY_CURVE_MAX_LIMIT                     250
+/*Gamma multiplied by 10, from 0 to 40 (0.0 to 4.0)*/
+#define DUTY_CURVE_GAMMA_X10                     18
+
+/*10-bit ADC input: 16 segments of 64 ADC counts*/
+#define DUTY_CURVE_SEGMENTS                      16
+#define DUTY_CURVE_SEGMENT_SHIFT                 6
+#define DUTY_CURVE_FRACTION_MASK                 0X3F
+
+#if (DUTY_CURVE_DEAD_ZONE > DUTY_CURVE_MAX_LIMIT) || (DUTY_CURVE_MAX_LIMIT > 255)
+#error "Duty curve needs DEAD_ZONE <= MAX_LIMIT <= 255"
+#endif
+
+#if (DUTY_CURVE_GAMMA_X10 < 0) || (DUTY_CURVE_GAMMA_X10 > 40)
+#error "Duty curve gamma must be from 0.0 to 4.0"
+#endif
+
+/*
+ * Table generator, evaluated by the compiler only.
+ * x^gamma is approximated between the integer powers around gamma:
+ * x^(n+f) ~ (1-f)*x^n + f*x^(n+1)
+ */
+#define DUTY_CURVE_GAMMA_INTEGER     (DUTY_CURVE_GAMMA_X10 / 10)
+#define DUTY_CURVE_GAMMA_FRACTION    ((DUTY_CURVE_GAMMA_X10 % 10) / 10.0)
+
+#define DUTY_CURVE_INTEGER_POWER(x,n) \
+	( ((n) == 0) ? 1.0 : ((n) == 1) ? (x) : ((n) == 2) ? (x)*(x) : \
+	  ((n) == 3) ? (x)*(x)*(x) : ((n) == 4) ? (x)*(x)*(x)*(x) : (x)*(x)*(x)*(x)*(x) )
+
+#define DUTY_CURVE_POWER(x) \
+	( (1.0 - DUTY_CURVE_GAMMA_FRACTION) * DUTY_CURVE_INTEGER_POWER((x), DUTY_CURVE_GAMMA_INTEGER) + \
+	  DUTY_CURVE_GAMMA_FRACTION * DUTY_CURVE_INTEGER_POWER((x), DUTY_CURVE_GAMMA_INTEGER + 1) )
+
+/*Point k of the table, point 0 keeps the motor off*/
+#define DUTY_CURVE_ENTRY(k) \
+	( ((k) == 0) ? 0 : (uint8)( DUTY_CURVE_DEAD_ZONE + \
+	  (DUTY_CURVE_MAX_LIMIT - DUTY_CURVE_DEAD_ZONE) * \
+	  DUTY_CURVE_POWER((k) / (double)DUTY_CURVE_SEGMENTS) + 0.5 ) )
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to map a 10-bit ADC value to a Timer0/Timer2 compare value
+ *              two flash reads and one 8x8 multiplication
+ */
+uint8 DutyCurve_map(uint16 adc_value);
+
+#endif /* DUTY_CURVE_H_ */
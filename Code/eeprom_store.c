@@ -0,0 +1,235 @@
+/**********************************************************************************
+ * [FILE NAME]: eeprom_store.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the persistent store in the EEPROM.
+ *
+ ***********************************************************************************/
+
+#include <string.h>
+#include"eeprom_store.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define EEPROM_STORE_SLOT_ADDRESS(slot)          (EEPROM_STORE_BASE_ADDRESS + (uint16)(slot) * EEPROM_STORE_SLOT_SIZE)
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Record being saved, written by the main loop only while no save is running */
+static uint8 g_eepromStoreRecord[EEPROM_STORE_SLOT_SIZE];
+static volatile uint8 g_eepromStoreLength = 0;
+static volatile uint8 g_eepromStoreIndex = 0;
+static volatile uint16 g_eepromStoreAddress = EEPROM_STORE_BASE_ADDRESS;
+static volatile bool g_eepromStoreBusy = FALSE;
+static volatile uint32 g_eepromStoreWrites = 0;
+
+/* Slot and sequence number of the next save */
+static uint8 g_eepromStoreSlot = 0;
+static uint16 g_eepromStoreSequence = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: read one byte, EEWE is clear (no save running or from EE_RDY_vect)
+ */
+static uint8 EepromStore_readByte(uint16 address)
+{
+	EEAR = address;
+	SET_BIT(EECR, EERE);
+	return EEDR;
+}
+
+/*******************************************************************************
+ *                      Interrupt Service Routines                             *
+ *******************************************************************************/
+
+/*
+ * EEPROM ready: the previous byte is written, start the next one
+ * The bytes already holding their value are skipped, the record ends with
+ * its CRC so a cut save never looks valid
+ */
+ISR(EE_RDY_vect)
+{
+	ISR_INSTR_ENTRY(ISR_ID_EE_RDY);
+
+	uint8 index = g_eepromStoreIndex;
+	uint16 address = g_eepromStoreAddress;
+
+	while( (index < g_eepromStoreLength) &&
+			(EepromStore_readByte(address + index) == g_eepromStoreRecord[index]) )
+	{
+		index++;
+	}
+
+	if(index < g_eepromStoreLength)
+	{
+		EEAR = address + index;
+		EEDR = g_eepromStoreRecord[index];
+		/* EEWE within 4 cycles of EEMWE, the interrupts are already disabled */
+		SET_BIT(EECR, EEMWE);
+		SET_BIT(EECR, EEWE);
+		g_eepromStoreIndex = index + 1;
+		g_eepromStoreWrites++;
+	}
+	else
+	{
+		/* the last byte is written, the record is valid */
+		CLEAR_BIT(EECR, EERIE);
+		g_eepromStoreIndex = index;
+		g_eepromStoreBusy = FALSE;
+	}
+
+	ISR_INSTR_EXIT(ISR_ID_EE_RDY);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: EepromStore_load
+ *
+ * [Description]:  Function to load the latest valid record
+ *                 - Every slot is read once, its CRC checked against its bytes
+ *                 - The sequence numbers are compared with a 16-bit wrap, the
+ *                   slots always hold the last EEPROM_STORE_SLOTS saves
+ *                 - The next save goes to the slot after the latest one
+ *
+ * [Args]:         Payload_Ptr, size, version
+ *
+ * [In]            size: -Bytes of the payload, up to EEPROM_STORE_MAX_PAYLOAD
+ *                 version: -Version of the payload, a record of another
+ *                           version or size is ignored
+ *
+ * [Out]           Payload_Ptr: Pointer to the payload, untouched if no record
+ *
+ * [Returns]:      TRUE if a valid record is loaded, FALSE otherwise
+ ***************************************************************************************************/
+bool EepromStore_load(void * Payload_Ptr, uint8 size, uint8 version)
+{
+	uint8 slot;
+	uint8 i;
+	uint8 length = size + EEPROM_STORE_HEADER_SIZE;
+	uint16 address;
+	uint16 sequence;
+	bool found = FALSE;
+
+	if(g_eepromStoreBusy || (size > EEPROM_STORE_MAX_PAYLOAD))
+	{
+		return FALSE;
+	}
+
+	/* the record buffer is free while no save is running */
+	for(slot = 0; slot < EEPROM_STORE_SLOTS; slot++)
+	{
+		address = EEPROM_STORE_SLOT_ADDRESS(slot);
+		if( (EepromStore_readByte(address) != version) ||
+				(EepromStore_readByte(address + 3) != size) )
+		{
+			continue;
+		}
+
+		for(i = 0; i <= length; i++)
+		{
+			g_eepromStoreRecord[i] = EepromStore_readByte(address + i);
+		}
+		if(Crc8_compute(g_eepromStoreRecord, length, CRC8_INITIAL_VALUE) != g_eepromStoreRecord[length])
+		{
+			continue;
+		}
+
+		sequence = g_eepromStoreRecord[1] | ((uint16)g_eepromStoreRecord[2] << 8);
+		if( !found || ((sint16)(sequence - g_eepromStoreSequence) > 0) )
+		{
+			found = TRUE;
+			g_eepromStoreSequence = sequence;
+			g_eepromStoreSlot = slot;
+			memcpy(Payload_Ptr, &g_eepromStoreRecord[EEPROM_STORE_HEADER_SIZE], size);
+		}
+	}
+
+	if(found)
+	{
+		g_eepromStoreSlot = (g_eepromStoreSlot + 1) % EEPROM_STORE_SLOTS;
+		g_eepromStoreSequence++;
+	}
+
+	return found;
+
+}/*End of EepromStore_load*/
+
+/***************************************************************************************************
+ * [Function Name]: EepromStore_save
+ *
+ * [Description]:  Function to start the save of a record
+ *                 - The record is built in RAM: header, payload and CRC
+ *                 - EERIE is set, EE_RDY_vect writes it in the next slot
+ *                 The payload can change as soon as the function returns
+ *
+ * [Args]:         Payload_Ptr, size, version
+ *
+ * [In]            Payload_Ptr: Pointer to the payload
+ *                 size: -Bytes of the payload, up to EEPROM_STORE_MAX_PAYLOAD
+ *                 version: -Version of the payload, 0X01 to 0XFE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if a save is still running or the size is too big,
+ *                 TRUE otherwise
+ ***************************************************************************************************/
+bool EepromStore_save(const void * Payload_Ptr, uint8 size, uint8 version)
+{
+	uint8 length = size + EEPROM_STORE_HEADER_SIZE;
+
+	if(g_eepromStoreBusy || (size > EEPROM_STORE_MAX_PAYLOAD))
+	{
+		return FALSE;
+	}
+
+	g_eepromStoreRecord[0] = version;
+	g_eepromStoreRecord[1] = (uint8)g_eepromStoreSequence;
+	g_eepromStoreRecord[2] = (uint8)(g_eepromStoreSequence >> 8);
+	g_eepromStoreRecord[3] = size;
+	memcpy(&g_eepromStoreRecord[EEPROM_STORE_HEADER_SIZE], Payload_Ptr, size);
+	g_eepromStoreRecord[length] = Crc8_compute(g_eepromStoreRecord, length, CRC8_INITIAL_VALUE);
+
+	g_eepromStoreLength = length + 1;
+	g_eepromStoreIndex = 0;
+	g_eepromStoreAddress = EEPROM_STORE_SLOT_ADDRESS(g_eepromStoreSlot);
+	g_eepromStoreBusy = TRUE;
+
+	g_eepromStoreSlot = (g_eepromStoreSlot + 1) % EEPROM_STORE_SLOTS;
+	g_eepromStoreSequence++;
+
+	/* EE_RDY is a level, it fires at once if the EEPROM is ready */
+	SET_BIT(EECR, EERIE);
+
+	return TRUE;
+
+}/*End of EepromStore_save*/
+
+bool EepromStore_isBusy(void)
+{
+	return g_eepromStoreBusy;
+}
+
+uint32 EepromStore_getWrites(void)
+{
+	uint32 writes;
+	uint8 sreg = SREG;
+
+	cli();
+	writes = g_eepromStoreWrites;
+	SREG = sreg;
+
+	return writes;
+}
@@ -0,0 +1,79 @@
+/**********************************************************************************
+ * [FILE NAME]: eeprom_store.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                persistent store in the EEPROM, one record of the application
+ *                (settings, gains, last direction) saved in the background:
+ *                - EepromStore_save copies the record in RAM and returns at
+ *                  once, EE_RDY_vect writes it one byte per interrupt, so the
+ *                  8.5 ms of every byte never block the control loop
+ *                - The EEPROM is cut in slots, every save goes to the slot
+ *                  after the last one, the wear is spread on all of them
+ *                - Every record has a version, a sequence number and a CRC-8,
+ *                  EepromStore_load scans the slots once at start and takes
+ *                  the valid one with the highest sequence number
+ *                A save cut by a reset leaves a bad CRC in its slot, the load
+ *                takes the previous record which is still whole in its own.
+ *
+ ***********************************************************************************/
+
+#ifndef EEPROM_STORE_H_
+#define EEPROM_STORE_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "isr_instrumentation.h"
+#include "crc8.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Slots of the store, EEPROM bytes used = EEPROM_STORE_SLOTS * EEPROM_STORE_SLOT_SIZE*/
+#define EEPROM_STORE_BASE_ADDRESS                0X0000
+#define EEPROM_STORE_SLOTS                       16
+#define EEPROM_STORE_SLOT_SIZE                   32
+
+/*Record: version, sequence (2 bytes), size, payload, CRC-8 of all the bytes before*/
+#define EEPROM_STORE_HEADER_SIZE                 4
+#define EEPROM_STORE_MAX_PAYLOAD                 (EEPROM_STORE_SLOT_SIZE - EEPROM_STORE_HEADER_SIZE - 1)
+
+#if ((EEPROM_STORE_BASE_ADDRESS + EEPROM_STORE_SLOTS * EEPROM_STORE_SLOT_SIZE) > 512)
+#error "EEPROM store must fit in the 512 bytes of the EEPROM"
+#endif
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to load the latest valid record of this version and
+ *              size, once at start before any save (sets the next slot)
+ *              version: 0X01 to 0XFE (0X00 and 0XFF are blank EEPROM)
+ *              Returns FALSE if none, the payload is then untouched
+ */
+bool EepromStore_load(void * Payload_Ptr, uint8 size, uint8 version);
+
+/*
+ * Description: Function to start the save of a record in the background
+ *              Returns FALSE if a save is still running or the size is too big
+ */
+bool EepromStore_save(const void * Payload_Ptr, uint8 size, uint8 version);
+
+/*
+ * Description: Function to know if a save is still running
+ */
+bool EepromStore_isBusy(void);
+
+/*
+ * Description: Function to get the number of bytes written in the EEPROM,
+ *              the bytes of a record already holding their value are skipped
+ */
+uint32 EepromStore_getWrites(void);
+
+#endif /* EEPROM_STORE_H_ */
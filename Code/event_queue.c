@@ -0,0 +1,118 @@
+/**********************************************************************************
+ * [FILE NAME]: event_queue.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the lock free event queue between the
+ *                interrupts and the main loop.
+ *
+ ***********************************************************************************/
+
+#include"event_queue.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+Event_RecordType g_eventQueue_events[EVENT_QUEUE_SIZE];
+
+/*
+ * Free running indexes, the record of an index is (index & EVENT_QUEUE_MASK)
+ * and the number of events waiting is (head - tail)
+ */
+volatile uint8 g_eventQueue_head = 0;
+volatile uint8 g_eventQueue_tail = 0;
+
+volatile uint8 g_eventQueue_highWaterMark = 0;
+volatile uint16 g_eventQueue_overflows = 0;
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void EventQueue_init(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	g_eventQueue_head = 0;
+	g_eventQueue_tail = 0;
+	g_eventQueue_highWaterMark = 0;
+	g_eventQueue_overflows = 0;
+
+	/*The time stamps count Timer1: started as cycle counter unless already running*/
+	if( (TIMER1_CONTROL_REGIRSTER_B & (~TIMER1_CLOCK_MASK_CLEAR)) == 0 )
+	{
+		Timer_startCycleCounter();
+	}
+	SREG = sreg;
+}
+
+bool EventQueue_postFromMain(uint8 type, uint16 payload)
+{
+	bool posted;
+	uint8 sreg = SREG;
+
+	cli();
+	posted = EventQueue_post(type, payload);
+	SREG = sreg;
+
+	return posted;
+}
+
+/***************************************************************************************************
+ * [Function Name]: EventQueue_get
+ *
+ * [Description]:  Function to take the oldest event, from the main loop only
+ *                 - The record is copied first then the tail is released
+ *                 - The ISRs never write the tail so no lock is needed
+ *
+ * [Args]:         Event_Ptr
+ *
+ * [In]            NONE
+ *
+ * [Out]           Event_Ptr: Pointer to the record receiving the event
+ *
+ * [Returns]:      FALSE if the queue is empty, TRUE otherwise
+ ***************************************************************************************************/
+bool EventQueue_get(Event_RecordType * Event_Ptr)
+{
+	uint8 tail = g_eventQueue_tail;
+
+	if(tail == g_eventQueue_head)
+	{
+		return FALSE;
+	}
+
+	*Event_Ptr = g_eventQueue_events[tail & EVENT_QUEUE_MASK];
+
+	EVENT_QUEUE_BARRIER();
+	g_eventQueue_tail = tail + 1;
+
+	return TRUE;
+
+}/*End of EventQueue_get*/
+
+uint8 EventQueue_getCount(void)
+{
+	return (uint8)(g_eventQueue_head - g_eventQueue_tail);
+}
+
+uint8 EventQueue_getHighWaterMark(void)
+{
+	return g_eventQueue_highWaterMark;
+}
+
+uint16 EventQueue_getOverflows(void)
+{
+	uint16 overflows;
+	uint8 sreg = SREG;
+
+	cli();
+	overflows = g_eventQueue_overflows;
+	SREG = sreg;
+
+	return overflows;
+}
@@ -0,0 +1,176 @@
+/**********************************************************************************
+ * [FILE NAME]: event_queue.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                event queue between the interrupts and the main loop.
+ *                Lock free single producer / single consumer ring buffer:
+ *                - Producer: the ISRs, they don't nest on the AVR so all of
+ *                  them together are one producer, only the head is written
+ *                - Consumer: the main loop, only the tail is written
+ *                The indexes are single bytes so their writes are atomic and
+ *                no interrupt has to be disabled on the fast path.
+ *                The posts of the drivers (EXTERNAL_INTERRUPT_POST_EVENTS,
+ *                TIMER_POST_EVENTS, ADC_POST_EVENTS) are disabled by default,
+ *                enable them with a consumer draining the queue.
+ *
+ ***********************************************************************************/
+
+#ifndef EVENT_QUEUE_H_
+#define EVENT_QUEUE_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "timers.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Number of records, power of two from 2 to 128*/
+#define EVENT_QUEUE_SIZE                         16
+#define EVENT_QUEUE_MASK                         (EVENT_QUEUE_SIZE - 1)
+
+#if (EVENT_QUEUE_SIZE < 2) || (EVENT_QUEUE_SIZE > 128) || (EVENT_QUEUE_SIZE & EVENT_QUEUE_MASK)
+#error "Event queue size must be a power of two from 2 to 128"
+#endif
+
+/*
+ * Time stamp of the records, Timer1 running as cycle counter, EventQueue_init
+ * starts it if Timer1 is stopped, in the ticks of its own clock otherwise
+ */
+#define EVENT_QUEUE_TIMESTAMP()                  (TIMER_CYCLE_COUNTER_REGISTER)
+
+/*Stop the compiler moving the record writes after the publication of the head*/
+#define EVENT_QUEUE_BARRIER()                    __asm__ __volatile__("" ::: "memory")
+
+/*ADC payload: result in bits 9:0, channel in bits 15:13*/
+#define EVENT_ADC_CHANNEL_SHIFT                  13
+#define EVENT_ADC_RESULT_MASK                    0X03FF
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	EVENT_NONE,
+	EVENT_EXTERNAL_INTERRUPT0, EVENT_EXTERNAL_INTERRUPT1, EVENT_EXTERNAL_INTERRUPT2,
+	EVENT_TIMER0, EVENT_TIMER1, EVENT_TIMER2,
+	EVENT_ADC_COMPLETE,
+	EVENT_APPLICATION
+
+}Event_Type;
+
+typedef struct
+{
+	uint8  type;        /* Event_Type */
+	uint16 payload;     /* depends on the type */
+	uint16 timestamp;   /* EVENT_QUEUE_TIMESTAMP() when posted */
+
+}Event_RecordType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to empty the queue and reset its statistics, starts
+ *              Timer1 as cycle counter for the time stamps if it is stopped
+ */
+void EventQueue_init(void);
+
+/*
+ * Description: Function to post an event from the main loop, interrupts are
+ *              disabled while posting as the main loop is not the producer
+ */
+bool EventQueue_postFromMain(uint8 type, uint16 payload);
+
+/*
+ * Description: Function to take the oldest event, from the main loop only
+ *              Returns FALSE if the queue is empty
+ */
+bool EventQueue_get(Event_RecordType * Event_Ptr);
+
+/*
+ * Description: Function to get the number of events waiting
+ */
+uint8 EventQueue_getCount(void);
+
+/*
+ * Description: Function to get the maximum number of events waiting at once
+ */
+uint8 EventQueue_getHighWaterMark(void);
+
+/*
+ * Description: Function to get the number of events lost because the queue was full
+ */
+uint16 EventQueue_getOverflows(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Only for EventQueue_post, to be inlined in the ISRs */
+extern Event_RecordType g_eventQueue_events[EVENT_QUEUE_SIZE];
+extern volatile uint8 g_eventQueue_head;
+extern volatile uint8 g_eventQueue_tail;
+extern volatile uint8 g_eventQueue_highWaterMark;
+extern volatile uint16 g_eventQueue_overflows;
+
+/*******************************************************************************
+ *                      Inline Functions                                       *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: EventQueue_post
+ *
+ * [Description]:  Function to post an event, from interrupt context only
+ *                 - The record is written first then the head is published
+ *                 - The main loop never writes the head so no lock is needed
+ *                 Inline so the posting ISRs don't pay a function call
+ *
+ * [Args]:         type, payload
+ *
+ * [In]            type:    -Event_Type of the event
+ *
+ *                 payload: -Data of the event
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the queue is full (overflow counted), TRUE otherwise
+ ***************************************************************************************************/
+static inline bool EventQueue_post(uint8 type, uint16 payload)
+{
+	uint8 head = g_eventQueue_head;
+	uint8 used = (uint8)(head - g_eventQueue_tail);
+	Event_RecordType *event_Ptr;
+
+	if(used >= EVENT_QUEUE_SIZE)
+	{
+		g_eventQueue_overflows++;
+		return FALSE;
+	}
+
+	event_Ptr = &g_eventQueue_events[head & EVENT_QUEUE_MASK];
+	event_Ptr->type = type;
+	event_Ptr->payload = payload;
+	event_Ptr->timestamp = EVENT_QUEUE_TIMESTAMP();
+
+	EVENT_QUEUE_BARRIER();
+	g_eventQueue_head = head + 1;
+
+	used++;
+	if(used > g_eventQueue_highWaterMark)
+	{
+		g_eventQueue_highWaterMark = used;
+	}
+
+	return TRUE;
+}
+
+#endif /* EVENT_QUEUE_H_ */
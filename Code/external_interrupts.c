@@ -11,12 +11,45 @@
 
 
 #include"external_interrupts.h"
+#include"event_queue.h"
+#include"isr_instrumentation.h"
+#include"isr_bindings.h"
+#include"shared_state.h"
 
 
-/* Global variables to hold the address of the call back function in the application */
+/*
+ * Global variables to hold the address of the call back function in the application
+ * Only for the interrupts without a handler bound at build time (isr_bindings.h)
+ */
+#ifndef INTERRUPT0_ISR_HANDLER
 static volatile void (*g_INT0_callBackPtr)(void) = NULL_PTR;
+#endif
+#ifndef INTERRUPT1_ISR_HANDLER
 static volatile void (*g_INT1_callBackPtr)(void) = NULL_PTR;
+#endif
+#ifndef INTERRUPT2_ISR_HANDLER
 static volatile void (*g_INT2_callBackPtr)(void) = NULL_PTR;
+#endif
+
+#if (EXTERNAL_INTERRUPT_ENCODER_MODE != DISABLE)
+/*
+ * Step of the encoder for every (previous AB, current AB) transition
+ * A leading B (00 -> 01 -> 11 -> 10) counts up
+ */
+static const sint8 g_encoder_table[16] =
+{
+		 0, +1, -1, ENCODER_ILLEGAL_TRANSITION,
+		-1,  0, ENCODER_ILLEGAL_TRANSITION, +1,
+		+1, ENCODER_ILLEGAL_TRANSITION,  0, -1,
+		ENCODER_ILLEGAL_TRANSITION, -1, +1,  0
+};
+
+static volatile uint8 g_encoder_state = 0;
+static volatile sint32 g_encoder_position = 0;
+static volatile uint16 g_encoder_errors = 0;
+static SharedState_SequenceType g_encoder_sequence = 0; /* publications of position and errors */
+static sint32 g_encoder_lastPosition = 0;
+#endif
 
 /*******************************************************************************
  *                       Interrupt Service Routines                            *
@@ -25,6 +58,45 @@ static volatile void (*g_INT2_callBackPtr)(void) = NULL_PTR;
 
 
 
+#if (EXTERNAL_INTERRUPT_ENCODER_MODE != DISABLE)
+
+/**************************************************************************
+ *                     Interrupt0/Interrupt1 Encoder                      *
+ * ************************************************************************/
+
+/*
+ * Both channels share the same decoding, INT1 vector jumps to INT0 one
+ * The cycles of an edge, from the edge to reti, are the benchmark
+ * isr_encoder_edge (Tools/benchmark.sh with the encoder mode), the highest
+ * rate of edges is F_CPU divided by them
+ */
+ISR(INT0_vect)
+{
+	ISR_INSTR_ENTRY(ISR_ID_INT0);
+
+	uint8 state = (uint8)(g_encoder_state << 2) |
+			((ENCODER_PIN_REGISTER >> ENCODER_A_PIN) & ENCODER_AB_MASK);
+	sint8 step = g_encoder_table[state & ENCODER_STATE_MASK];
+
+	g_encoder_state = state;
+
+	if(step == ENCODER_ILLEGAL_TRANSITION)
+	{
+		g_encoder_errors++;
+	}
+	else
+	{
+		g_encoder_position += step;
+	}
+	SHARED_STATE_PUBLISH(g_encoder_sequence);
+
+	ISR_INSTR_EXIT(ISR_ID_INT0);
+}
+
+ISR(INT1_vect, ISR_ALIASOF(INT0_vect));
+
+#else
+
 /**************************************************************************
  *                            Interrupt0                                  *
  * ************************************************************************/
@@ -32,11 +104,24 @@ static volatile void (*g_INT2_callBackPtr)(void) = NULL_PTR;
 
 ISR(INT0_vect)
 {
+	ISR_INSTR_ENTRY(ISR_ID_INT0);
+
+#if (EXTERNAL_INTERRUPT_POST_EVENTS != DISABLE)
+	/* The application handles the edge from the main loop */
+	EventQueue_post(EVENT_EXTERNAL_INTERRUPT0, INTERRUPT0_PIN_REGISTER);
+#endif
+#if defined(INTERRUPT0_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	INTERRUPT0_ISR_HANDLER();
+#elif (EXTERNAL_INTERRUPT_POST_EVENTS == DISABLE)
 	if(g_INT0_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_INT0_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
+#endif
+
+	ISR_INSTR_EXIT(ISR_ID_INT0);
 }
 
 
@@ -46,24 +131,52 @@ ISR(INT0_vect)
 
 ISR(INT1_vect)
 {
+	ISR_INSTR_ENTRY(ISR_ID_INT1);
+
+#if (EXTERNAL_INTERRUPT_POST_EVENTS != DISABLE)
+	/* The application handles the edge from the main loop */
+	EventQueue_post(EVENT_EXTERNAL_INTERRUPT1, INTERRUPT1_PIN_REGISTER);
+#endif
+#if defined(INTERRUPT1_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	INTERRUPT1_ISR_HANDLER();
+#elif (EXTERNAL_INTERRUPT_POST_EVENTS == DISABLE)
 	if(g_INT1_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_INT1_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
+#endif
+
+	ISR_INSTR_EXIT(ISR_ID_INT1);
 }
 
+#endif /*EXTERNAL_INTERRUPT_ENCODER_MODE*/
+
 
 /**************************************************************************
  *                            Interrupt2                                  *
  * ************************************************************************/
 ISR(INT2_vect)
 {
+	ISR_INSTR_ENTRY(ISR_ID_INT2);
+
+#if (EXTERNAL_INTERRUPT_POST_EVENTS != DISABLE)
+	/* The application handles the edge from the main loop */
+	EventQueue_post(EVENT_EXTERNAL_INTERRUPT2, INTERRUPT2_PIN_REGISTER);
+#endif
+#if defined(INTERRUPT2_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	INTERRUPT2_ISR_HANDLER();
+#elif (EXTERNAL_INTERRUPT_POST_EVENTS == DISABLE)
 	if(g_INT2_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_INT2_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
+#endif
+
+	ISR_INSTR_EXIT(ISR_ID_INT2);
 }
 
 
@@ -94,14 +207,14 @@ void External_Interrupt_init(const External_Interrupt_ConfigType* Config_Ptr)
 	case INTERRUPT0:
 
 		/*configure pin of interrupt0 as input pin*/
-		INTERRUPT0_DIRECTION_PORT = CLEAR_BIT(INTERRUPT0_DIRECTION_PORT, INTERRUPT0_PIN);
+		CLEAR_BIT(INTERRUPT0_DIRECTION_PORT, INTERRUPT0_PIN);
 
 		/*static configuration of internal pull up resistance*/
 #if (INTERNAL_PULL_UP_INT0 != DISABLE)
 		{
 
 			/*Activate internal pull up for interrupt 0*/
-			INTERRUPT0_DATA_PORT = SET_BIT(INTERRUPT0_DATA_PORT, INTERRUPT0_PIN);
+			SET_BIT(INTERRUPT0_DATA_PORT, INTERRUPT0_PIN);
 
 		}/*end of INTERNAL_PULL_UP_INT0  */
 #endif
@@ -118,14 +231,14 @@ void External_Interrupt_init(const External_Interrupt_ConfigType* Config_Ptr)
 	case INTERRUPT1:
 
 		/*configure interrupt 1 pin as input pin*/
-		INTERRUPT1_DIRECTION_PORT = CLEAR_BIT(INTERRUPT1_DIRECTION_PORT, INTERRUPT1_PIN);
+		CLEAR_BIT(INTERRUPT1_DIRECTION_PORT, INTERRUPT1_PIN);
 
 		/*static configuration for the internal interrupt resistance*/
 #if (INTERNAL_PULL_UP_INT1 != DISABLE)
 		{
 
 			/*Activate internal pull up for interrupt 0*/
-			INTERRUPT1_DATA_PORT = SET_BIT(INTERRUPT1_DATA_PORT, INTERRUPT1_PIN);
+			SET_BIT(INTERRUPT1_DATA_PORT, INTERRUPT1_PIN);
 
 		}/*end of INTERNAL_PULL_UP_INT0  */
 #endif
@@ -142,14 +255,14 @@ void External_Interrupt_init(const External_Interrupt_ConfigType* Config_Ptr)
 	case INTERRUPT2:
 
 		/*configure interrupt 2 pin as input pin */
-		INTERRUPT2_DIRECTION_PORT = CLEAR_BIT(INTERRUPT2_DIRECTION_PORT, INTERRUPT2_PIN);
+		CLEAR_BIT(INTERRUPT2_DIRECTION_PORT, INTERRUPT2_PIN);
 
 		/*static configuration for interrupt 2 resistance*/
 #if (INTERNAL_PULL_UP_INT2 != DISABLE)
 		{
 
 			/*Activate internal pull up for interrupt 0*/
-			INTERRUPT2_DATA_PORT = SET_BIT(INTERRUPT2_DATA_PORT, INTERRUPT2_PIN);
+			SET_BIT(INTERRUPT2_DATA_PORT, INTERRUPT2_PIN);
 
 		}/*end of INTERNAL_PULL_UP_INT0  */
 #endif
@@ -193,17 +306,23 @@ void Interrupt_setCallBack(void(*a_ptr)(void), Interrupt_ID Interrupt_type )
 	{
 	case INTERRUPT0:
 		/* Save the address of the Call back function in a global variable */
+#ifndef INTERRUPT0_ISR_HANDLER
 		g_INT0_callBackPtr = a_ptr;
+#endif
 		break;
 
 	case INTERRUPT1:
 		/* Save the address of the Call back function in a global variable */
+#ifndef INTERRUPT1_ISR_HANDLER
 		g_INT1_callBackPtr = a_ptr;
+#endif
 		break;
 
 	case INTERRUPT2:
 		/* Save the address of the Call back function in a global variable */
+#ifndef INTERRUPT2_ISR_HANDLER
 		g_INT2_callBackPtr = a_ptr;
+#endif
 		break;
 	} /*End of the switch case*/
 
@@ -261,3 +380,181 @@ void External_Interrupt_Deinit(Interrupt_ID INT_ID)
 	}/*end of switch case*/
 
 }/*End of External_Interrupt_Deinit function*/
+
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_disable
+ *
+ * [Description]:  Function to mask the interrupt without changing its configuration
+ *
+ * [Args]:         INT_ID
+ *
+ * [In]            INT_ID: -Variable from type enum Interrupt_ID
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+
+void External_Interrupt_disable(Interrupt_ID INT_ID)
+{
+
+	switch(INT_ID)
+	{
+
+	case INTERRUPT0:
+		GENERAL_INTERRUPT_CONTROL_REGISTER &= ~(1<<EXTRNAL_INTERRUPT0_ENABL_BIT);
+		break;
+
+	case INTERRUPT1:
+		GENERAL_INTERRUPT_CONTROL_REGISTER &= ~(1<<EXTRNAL_INTERRUPT1_ENABL_BIT);
+		break;
+
+	case INTERRUPT2:
+		GENERAL_INTERRUPT_CONTROL_REGISTER &= ~(1<<EXTRNAL_INTERRUPT2_ENABL_BIT);
+		break;
+
+	}/*end of switch case*/
+
+}/*End of External_Interrupt_disable function*/
+
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_enable
+ *
+ * [Description]:  Function to clear the pending flag then unmask the interrupt
+ *                 edges received while the interrupt was masked are discarded
+ *
+ * [Args]:         INT_ID
+ *
+ * [In]            INT_ID: -Variable from type enum Interrupt_ID
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+
+void External_Interrupt_enable(Interrupt_ID INT_ID)
+{
+
+	switch(INT_ID)
+	{
+
+	case INTERRUPT0:
+		/*flag is cleared by writing one to it*/
+		GENERAL_INTERRUPT_FLAG_REGISTER = (1<<EXTERNAL_INTERRUPT_FLAG_0);
+		GENERAL_INTERRUPT_CONTROL_REGISTER |= (1<<EXTRNAL_INTERRUPT0_ENABL_BIT);
+		break;
+
+	case INTERRUPT1:
+		GENERAL_INTERRUPT_FLAG_REGISTER = (1<<EXTERNAL_INTERRUPT_FLAG_1);
+		GENERAL_INTERRUPT_CONTROL_REGISTER |= (1<<EXTRNAL_INTERRUPT1_ENABL_BIT);
+		break;
+
+	case INTERRUPT2:
+		GENERAL_INTERRUPT_FLAG_REGISTER = (1<<EXTERNAL_INTERRUPT_FLAG_2);
+		GENERAL_INTERRUPT_CONTROL_REGISTER |= (1<<EXTRNAL_INTERRUPT2_ENABL_BIT);
+		break;
+
+	}/*end of switch case*/
+
+}/*End of External_Interrupt_enable function*/
+
+#if (EXTERNAL_INTERRUPT_ENCODER_MODE != DISABLE)
+
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_encoderInit
+ *
+ * [Description]:  Function to Initialize the quadrature encoder mode
+ *                 - INT0 and INT1 on any logical change
+ *                 - Position and errors counters reset to zero
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+
+void External_Interrupt_encoderInit(void)
+{
+	External_Interrupt_ConfigType channel;
+	uint8 sreg = SREG;
+
+	cli();
+
+	channel.INT_control = Any_logical;
+	channel.INT_ID = INTERRUPT0;
+	External_Interrupt_init(&channel);
+	channel.INT_ID = INTERRUPT1;
+	External_Interrupt_init(&channel);
+
+	/*Start from the current level of the channels*/
+	g_encoder_state = (ENCODER_PIN_REGISTER >> ENCODER_A_PIN) & ENCODER_AB_MASK;
+	g_encoder_position = 0;
+	g_encoder_lastPosition = 0;
+	g_encoder_errors = 0;
+
+	/*Discard the edges of the configuration*/
+	GENERAL_INTERRUPT_FLAG_REGISTER = (1<<EXTERNAL_INTERRUPT_FLAG_0) | (1<<EXTERNAL_INTERRUPT_FLAG_1);
+
+	SREG = sreg;
+
+}/*End of External_Interrupt_encoderInit function*/
+
+sint32 External_Interrupt_encoderGetPosition(void)
+{
+	sint32 position;
+
+	/* the interrupts stay enabled, the edges aren't delayed */
+	SHARED_STATE_READ(g_encoder_sequence, position = g_encoder_position);
+
+	return position;
+}
+
+void External_Interrupt_encoderSetPosition(sint32 position)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	g_encoder_position = position;
+	g_encoder_lastPosition = position;
+	SREG = sreg;
+}
+
+uint16 External_Interrupt_encoderGetErrors(void)
+{
+	uint16 errors;
+
+	SHARED_STATE_READ(g_encoder_sequence, errors = g_encoder_errors);
+
+	return errors;
+}
+
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_encoderGetVelocity
+ *
+ * [Description]:  Function to estimate the velocity, must be called every control tick
+ *                 velocity = position delta over one tick
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Counts moved since the previous call
+ ***************************************************************************************************/
+
+sint16 External_Interrupt_encoderGetVelocity(void)
+{
+	sint32 position = External_Interrupt_encoderGetPosition();
+	sint16 velocity = (sint16)(position - g_encoder_lastPosition);
+
+	g_encoder_lastPosition = position;
+
+	return velocity;
+
+}/*End of External_Interrupt_encoderGetVelocity function*/
+
+#endif /*EXTERNAL_INTERRUPT_ENCODER_MODE*/
@@ -64,6 +64,39 @@
 #define INTERRUPT1_PIN                         PD3
 #define INTERRUPT2_PIN                         PB2
 
+#define INTERRUPT0_PIN_REGISTER                PIND
+#define INTERRUPT1_PIN_REGISTER                PIND
+#define INTERRUPT2_PIN_REGISTER                PINB
+
+/*
+ * Post an event (payload = pins of the interrupt port) to the event queue
+ * instead of calling the call back function from the ISR
+ */
+#define EXTERNAL_INTERRUPT_POST_EVENTS         DISABLE
+
+/*
+ * Quadrature encoder mode: channel A on INT0 and channel B on INT1, both
+ * interrupts on any logical change decode the encoder in the ISR, their
+ * call backs are not used in this mode.
+ * On the current board INT0 is shared with E of the LCD and INT1 with the
+ * direction button.
+ * Can be given on the command line, the benchmark of the decoding needs it
+ */
+#ifndef EXTERNAL_INTERRUPT_ENCODER_MODE
+#define EXTERNAL_INTERRUPT_ENCODER_MODE        DISABLE
+#endif
+
+#define ENCODER_PIN_REGISTER                   PIND
+#define ENCODER_A_PIN                          INTERRUPT0_PIN
+#define ENCODER_B_PIN                          INTERRUPT1_PIN
+#define ENCODER_AB_MASK                        0X03
+#define ENCODER_STATE_MASK                     0X0F
+#define ENCODER_ILLEGAL_TRANSITION             2
+
+#if (ENCODER_B_PIN != ENCODER_A_PIN + 1)
+#error "Encoder channels must be adjacent pins of the same port"
+#endif
+
 /*******************************************************************************
  *                         Types Declaration                                   *
  *******************************************************************************/
@@ -149,5 +182,106 @@ void Interrupt_setCallBack(void(*a_ptr)(void), Interrupt_ID Interrupt_type );
  * [Returns]:      NONE
  ***************************************************************************************************/
 void External_Interrupt_Deinit(Interrupt_ID INT_ID);
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_disable
+ *
+ * [Description]:  Function to mask the interrupt without changing its configuration
+ *
+ * [Args]:         INT_ID
+ *
+ * [In]            INT_ID: -Variable from type enum Interrupt_ID
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void External_Interrupt_disable(Interrupt_ID INT_ID);
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_enable
+ *
+ * [Description]:  Function to clear the pending flag then unmask the interrupt
+ *
+ * [Args]:         INT_ID
+ *
+ * [In]            INT_ID: -Variable from type enum Interrupt_ID
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void External_Interrupt_enable(Interrupt_ID INT_ID);
+
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_encoderInit
+ *
+ * [Description]:  Function to Initialize the quadrature encoder mode
+ *                 - INT0 and INT1 on any logical change
+ *                 - Position and errors counters reset to zero
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void External_Interrupt_encoderInit(void);
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_encoderGetPosition
+ *
+ * [Description]:  Function to read the position of the encoder in counts (4 per line)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Position of the encoder
+ ***************************************************************************************************/
+sint32 External_Interrupt_encoderGetPosition(void);
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_encoderSetPosition
+ *
+ * [Description]:  Function to set the position of the encoder
+ *
+ * [Args]:         position
+ *
+ * [In]            position: -New position in counts
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void External_Interrupt_encoderSetPosition(sint32 position);
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_encoderGetErrors
+ *
+ * [Description]:  Function to read the number of illegal transitions (both channels changed)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of illegal transitions
+ ***************************************************************************************************/
+uint16 External_Interrupt_encoderGetErrors(void);
+/***************************************************************************************************
+ * [Function Name]: External_Interrupt_encoderGetVelocity
+ *
+ * [Description]:  Function to estimate the velocity, must be called every control tick
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Counts moved since the previous call
+ ***************************************************************************************************/
+sint16 External_Interrupt_encoderGetVelocity(void);
 
 #endif /* EXTERNAL_INTERRUPTS_H_ */
@@ -0,0 +1,300 @@
+/**********************************************************************************
+ * [FILE NAME]: fixed_point.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the fixed point math.
+ *
+ ***********************************************************************************/
+
+#include"fixed_point.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* round(32768 * sin(k * pi / 256)), the last point is 1 saturated */
+static const q15 g_fixedSine_table[FIXED_SINE_SEGMENTS + 1] PROGMEM =
+{
+		0, 402, 804, 1206, 1608, 2009, 2411, 2811,
+		3212, 3612, 4011, 4410, 4808, 5205, 5602, 5998,
+		6393, 6787, 7180, 7571, 7962, 8351, 8740, 9127,
+		9512, 9896, 10279, 10660, 11039, 11417, 11793, 12167,
+		12540, 12910, 13279, 13646, 14010, 14373, 14733, 15091,
+		15447, 15800, 16151, 16500, 16846, 17190, 17531, 17869,
+		18205, 18538, 18868, 19195, 19520, 19841, 20160, 20475,
+		20788, 21097, 21403, 21706, 22006, 22302, 22595, 22884,
+		23170, 23453, 23732, 24008, 24279, 24548, 24812, 25073,
+		25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020,
+		27246, 27467, 27684, 27897, 28106, 28311, 28511, 28707,
+		28899, 29086, 29269, 29448, 29622, 29792, 29957, 30118,
+		30274, 30425, 30572, 30715, 30853, 30986, 31114, 31238,
+		31357, 31471, 31581, 31686, 31786, 31881, 31972, 32058,
+		32138, 32214, 32286, 32352, 32413, 32470, 32522, 32568,
+		32610, 32647, 32679, 32706, 32729, 32746, 32758, 32766,
+		32767
+};
+
+/* 1/m in UQ1.15 at the middle of the 16 segments of the mantissa m (0.5 to 1) */
+static const uint16 g_fixedReciprocal_seed[16] PROGMEM =
+{
+		63550, 59919, 56680, 53773, 51150, 48771, 46603, 44620,
+		42799, 41121, 39569, 38130, 36792, 35545, 34380, 33288
+};
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: Fixed_mulQ16_16
+ *
+ * [Description]:  Function to multiply two Q16.16 with saturation
+ *                 - Four 16x16 products of the integer and fraction halves
+ *                 - The fraction of the lowest one is dropped, the middle ones
+ *                   are summed by halves so nothing needs 64 bits
+ *
+ * [Args]:         a, b
+ *
+ * [In]            a, b: -Q16.16 values
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      floor(a.b) in Q16.16, FIXED_Q16_16_MAX/MIN on overflow
+ ***************************************************************************************************/
+q16_16 Fixed_mulQ16_16(q16_16 a, q16_16 b)
+{
+	sint16 a_high = (sint16)(a >> 16);
+	sint16 b_high = (sint16)(b >> 16);
+	uint16 a_low = (uint16)a;
+	uint16 b_low = (uint16)b;
+	sint32 cross_a = Fixed_mulSU16(a_high, b_low);
+	sint32 cross_b = Fixed_mulSU16(b_high, a_low);
+	uint32 low;
+	sint32 high;
+
+	/* result = high.2^16 + low */
+	low = (Fixed_mulU16(a_low, b_low) >> 16) + (uint16)cross_a + (uint16)cross_b;
+	high = Fixed_mulS16(a_high, b_high) + (cross_a >> 16) + (cross_b >> 16) + (sint32)(low >> 16);
+
+	if(high > 32767)
+	{
+		return FIXED_Q16_16_MAX;
+	}
+	if(high < -32768)
+	{
+		return FIXED_Q16_16_MIN;
+	}
+	return (q16_16)(((uint32)high << 16) | (uint16)low);
+
+}/*End of Fixed_mulQ16_16*/
+
+/***************************************************************************************************
+ * [Function Name]: Fixed_reciprocalQ16_16
+ *
+ * [Description]:  Function to get 1/x of a Q16.16 without division
+ *                 - |x| is shifted left to a mantissa m of 0.5 to 1
+ *                 - A table gives 1/m to 5 bits, two Newton steps
+ *                   y = y.(2 - m.y) double the good bits each
+ *                 - The shift of m gives the exponent of the result
+ *                 Four 16x16 multiplications instead of the 64-bit division
+ *                 of 2^32 by x
+ *
+ * [Args]:         x
+ *
+ * [In]            x: -Q16.16 value
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      1/x in Q16.16 with 15 significant bits, saturated
+ ***************************************************************************************************/
+q16_16 Fixed_reciprocalQ16_16(q16_16 x)
+{
+	uint32 magnitude = (x < 0) ? (uint32)0 - (uint32)x : (uint32)x;
+	uint8 shift = 0;
+	uint16 mantissa;
+	uint16 estimate;
+	uint16 error;
+	uint32 step;
+	uint8 i;
+
+	if(magnitude == 0)
+	{
+		return FIXED_Q16_16_MAX;
+	}
+
+	/* magnitude = m.2^(32 - shift), by bytes first */
+	while(magnitude < 0X01000000UL)
+	{
+		magnitude <<= 8;
+		shift += 8;
+	}
+	while(magnitude < 0X80000000UL)
+	{
+		magnitude <<= 1;
+		shift++;
+	}
+
+	/* rounded, 0XFFFF above 0XFFFF8000 */
+	mantissa = (magnitude >= 0XFFFF8000UL) ? 0XFFFF : (uint16)((magnitude + 0X8000) >> 16);
+	estimate = pgm_read_word(&g_fixedReciprocal_seed[(mantissa >> 11) & 0X0F]);
+
+	for(i = 0; i < 2; i++)
+	{
+		/* m.y in UQ1.15, close to 1, then 2 - m.y */
+		error = (uint16)(0X10000UL - ((Fixed_mulU16(mantissa, estimate) + 0X8000) >> 16));
+		step = (Fixed_mulU16(estimate, error) + 0X4000) >> 15;
+		/* the steps come from below, only 1/0.5 could reach 2 */
+		estimate = (step > 0XFFFF) ? 0XFFFF : (uint16)step;
+	}
+
+	/* 1/x = (1/m).2^(shift - 16), the estimate is (1/m).2^15 */
+	if(shift >= 15)
+	{
+		shift -= 15;
+		if( (shift > 15) || ((uint32)estimate >= (0X80000000UL >> shift)) )
+		{
+			return (x < 0) ? -FIXED_Q16_16_MAX : FIXED_Q16_16_MAX;
+		}
+		step = (uint32)estimate << shift;
+	}
+	else
+	{
+		shift = 15 - shift;
+		step = ((uint32)estimate + ((uint32)1 << (shift - 1))) >> shift;
+	}
+
+	return (x < 0) ? -(q16_16)step : (q16_16)step;
+
+}/*End of Fixed_reciprocalQ16_16*/
+
+/***************************************************************************************************
+ * [Function Name]: Fixed_sqrtQ16_16
+ *
+ * [Description]:  Function to get the square root of a Q16.16, one bit of the
+ *                 root per step (digit by digit, shifts and subtractions)
+ *                 - The root of x.2^16 has 24 bits, the first pass gives the
+ *                   16 of x, the second the 8 of the remainder shifted by 16
+ *                 - A remainder above 16 bits means the root is at least
+ *                   32768 and its next bit 1, it is done before the shift
+ *
+ * [Args]:         x
+ *
+ * [In]            x: -Q16.16 value
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      sqrt(x) in Q16.16 rounded to the nearest, 0 if x <= 0
+ ***************************************************************************************************/
+q16_16 Fixed_sqrtQ16_16(q16_16 x)
+{
+	uint32 remainder;
+	uint32 root = 0;
+	uint32 bit = 0X40000000UL;
+	uint8 pass;
+
+	if(x <= 0)
+	{
+		return 0;
+	}
+
+	remainder = (uint32)x;
+	while(bit > remainder)
+	{
+		bit >>= 2;
+	}
+
+	for(pass = 0; pass < 2; pass++)
+	{
+		/* root = (root so far).2 bit */
+		while(bit != 0)
+		{
+			if(remainder >= root + bit)
+			{
+				remainder -= root + bit;
+				root = (root >> 1) + bit;
+			}
+			else
+			{
+				root >>= 1;
+			}
+			bit >>= 2;
+		}
+
+		if(pass == 0)
+		{
+			if(remainder > 0XFFFF)
+			{
+				remainder = ((remainder - root) << 16) - 0X4000;
+				root = (root << 15) + 0X4000;
+				bit = (uint32)1 << 12;
+			}
+			else
+			{
+				remainder <<= 16;
+				root <<= 16;
+				bit = (uint32)1 << 14;
+			}
+		}
+	}
+
+	/* the next bit would be 1 */
+	if(remainder > root)
+	{
+		root++;
+	}
+
+	return (q16_16)root;
+
+}/*End of Fixed_sqrtQ16_16*/
+
+/***************************************************************************************************
+ * [Function Name]: Fixed_sinQ15
+ *
+ * [Description]:  Function to get the sine of an angle from the table
+ *                 - The 2 upper bits give the quarter, the second and the
+ *                   fourth read the table backward, the last two negate it
+ *                 - 7 bits select the segment, 7 bits interpolate
+ *
+ * [Args]:         angle
+ *
+ * [In]            angle: -65536 is one turn
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      sin(angle) in Q15
+ ***************************************************************************************************/
+q15 Fixed_sinQ15(uint16 angle)
+{
+	uint16 position = angle & (FIXED_ANGLE_QUARTER - 1);
+	uint8 index;
+	uint8 fraction;
+	q15 start;
+	q15 value;
+
+	if(angle & FIXED_ANGLE_QUARTER)
+	{
+		position = FIXED_ANGLE_QUARTER - position;
+	}
+
+	index = (uint8)(position >> FIXED_SINE_FRACTION_BITS);
+	fraction = (uint8)position & ((1 << FIXED_SINE_FRACTION_BITS) - 1);
+	start = (q15)pgm_read_word(&g_fixedSine_table[index]);
+	value = start;
+	if(fraction != 0)
+	{
+		/* the sine is increasing on the quarter, the difference is positive */
+		value += (q15)(Fixed_mulU16((uint16)((q15)pgm_read_word(&g_fixedSine_table[index + 1]) - start), fraction)
+				>> FIXED_SINE_FRACTION_BITS);
+	}
+
+	return (angle & FIXED_ANGLE_HALF) ? -value : value;
+
+}/*End of Fixed_sinQ15*/
+
+q15 Fixed_cosQ15(uint16 angle)
+{
+	return Fixed_sinQ15(angle + FIXED_ANGLE_QUARTER);
+}
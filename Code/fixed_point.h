@@ -0,0 +1,396 @@
+/**********************************************************************************
+ * [FILE NAME]: fixed_point.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                fixed point math of the control code, no float on the AVR:
+ *                - Q15: sint16, -1 to 1 - 2^-15 (gains, sin/cos)
+ *                - Q7.8: sint16, -128 to 128 - 2^-8 (small physical values)
+ *                - Q16.16: sint32, -32768 to 32768 - 2^-16 (the motion planner)
+ *                The additions and the multiplications saturate instead of
+ *                wrapping, the multiplications round toward minus infinity.
+ *                The 16x16 -> 32 bits products use the multiplier of the
+ *                ATmega16 (MUL, MULS, MULSU, FMUL*) in inline assembly, gcc
+ *                otherwise calls its generic 32x32 bits multiplication. The C
+ *                code of the #else is the reference of the host build, the
+ *                results are the same bit for bit (Tools/fixed_point_check.c).
+ *
+ ***********************************************************************************/
+
+#ifndef FIXED_POINT_H_
+#define FIXED_POINT_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define FIXED_Q15_MAX                            ((q15)0X7FFF)
+#define FIXED_Q15_MIN                            ((q15)-0X8000)
+#define FIXED_Q7_8_ONE                           ((q7_8)0X0100)
+#define FIXED_Q16_16_ONE                         ((q16_16)0X00010000)
+#define FIXED_Q16_16_MAX                         ((q16_16)0X7FFFFFFF)
+#define FIXED_Q16_16_MIN                         ((q16_16)(-0X7FFFFFFF - 1))
+
+/*Constants from a real number, rounded, for the compile time only*/
+#define FIXED_Q15(x)                             ((q15)((x) * 32768.0 + (((x) >= 0) ? 0.5 : -0.5)))
+#define FIXED_Q7_8(x)                            ((q7_8)((x) * 256.0 + (((x) >= 0) ? 0.5 : -0.5)))
+#define FIXED_Q16_16(x)                          ((q16_16)((x) * 65536.0 + (((x) >= 0) ? 0.5 : -0.5)))
+
+/*Angles of Fixed_sinQ15/Fixed_cosQ15: one turn is 65536, the uint16 wraps with it*/
+#define FIXED_ANGLE_QUARTER                      0X4000U
+#define FIXED_ANGLE_HALF                         0X8000U
+
+/*Sine table: points of a quarter of turn, the angle bits below interpolate*/
+#define FIXED_SINE_SEGMENTS                      128
+#define FIXED_SINE_FRACTION_BITS                 7
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef sint16 q15;
+typedef sint16 q7_8;
+typedef sint32 q16_16;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to multiply two Q16.16 with saturation
+ */
+q16_16 Fixed_mulQ16_16(q16_16 a, q16_16 b);
+
+/*
+ * Description: Function to get 1/x of a Q16.16 with 15 significant bits,
+ *              +/-FIXED_Q16_16_MAX for 0 and the values below 2^-15
+ */
+q16_16 Fixed_reciprocalQ16_16(q16_16 x);
+
+/*
+ * Description: Function to get the square root of a Q16.16 rounded to the
+ *              nearest, 0 for the negative values
+ */
+q16_16 Fixed_sqrtQ16_16(q16_16 x);
+
+/*
+ * Description: Functions to get the sine and the cosine in Q15 of an angle,
+ *              65536 is one turn, error under 2 LSB
+ */
+q15 Fixed_sinQ15(uint16 angle);
+q15 Fixed_cosQ15(uint16 angle);
+
+/*******************************************************************************
+ *                      Inline Functions                                       *
+ *******************************************************************************/
+
+/*
+ * Description: Function to saturate a product or a sum to 16 bits
+ */
+static inline sint16 Fixed_saturate16(sint32 value)
+{
+	if(value > 32767)
+	{
+		return 32767;
+	}
+	if(value < -32768)
+	{
+		return -32768;
+	}
+	return (sint16)value;
+}
+
+/*
+ * Description: Function to add two Q15 or two Q7.8 with saturation
+ *              On overflow both have the sign of b, so has the limit
+ */
+static inline sint16 Fixed_add16(sint16 a, sint16 b)
+{
+#ifdef __AVR__
+	__asm__ (
+		"add  %A[a], %A[b]"    "\n\t"
+		"adc  %B[a], %B[b]"    "\n\t"
+		"brvc 1f"              "\n\t"
+		"ldi  %A[a], 0XFF"     "\n\t"
+		"ldi  %B[a], 0X7F"     "\n\t"
+		"sbrs %B[b], 7"        "\n\t"
+		"rjmp 1f"              "\n\t"
+		"ldi  %A[a], 0X00"     "\n\t"
+		"ldi  %B[a], 0X80"     "\n"
+		"1:"
+		: [a] "+&d" (a)
+		: [b] "r" (b)
+	);
+	return a;
+#else
+	return Fixed_saturate16((sint32)a + b);
+#endif
+}
+
+/*
+ * Description: Function to subtract two Q15 or two Q7.8 with saturation
+ *              On overflow the limit has the sign opposite to b
+ */
+static inline sint16 Fixed_sub16(sint16 a, sint16 b)
+{
+#ifdef __AVR__
+	__asm__ (
+		"sub  %A[a], %A[b]"    "\n\t"
+		"sbc  %B[a], %B[b]"    "\n\t"
+		"brvc 1f"              "\n\t"
+		"ldi  %A[a], 0XFF"     "\n\t"
+		"ldi  %B[a], 0X7F"     "\n\t"
+		"sbrc %B[b], 7"        "\n\t"
+		"rjmp 1f"              "\n\t"
+		"ldi  %A[a], 0X00"     "\n\t"
+		"ldi  %B[a], 0X80"     "\n"
+		"1:"
+		: [a] "+&d" (a)
+		: [b] "r" (b)
+	);
+	return a;
+#else
+	return Fixed_saturate16((sint32)a - b);
+#endif
+}
+
+/*
+ * Description: Function to add two Q16.16 with saturation
+ */
+static inline sint32 Fixed_add32(sint32 a, sint32 b)
+{
+#ifdef __AVR__
+	__asm__ (
+		"add  %A[a], %A[b]"    "\n\t"
+		"adc  %B[a], %B[b]"    "\n\t"
+		"adc  %C[a], %C[b]"    "\n\t"
+		"adc  %D[a], %D[b]"    "\n\t"
+		"brvc 1f"              "\n\t"
+		"ldi  %A[a], 0XFF"     "\n\t"
+		"ldi  %B[a], 0XFF"     "\n\t"
+		"ldi  %C[a], 0XFF"     "\n\t"
+		"ldi  %D[a], 0X7F"     "\n\t"
+		"sbrs %D[b], 7"        "\n\t"
+		"rjmp 1f"              "\n\t"
+		"ldi  %A[a], 0X00"     "\n\t"
+		"ldi  %B[a], 0X00"     "\n\t"
+		"ldi  %C[a], 0X00"     "\n\t"
+		"ldi  %D[a], 0X80"     "\n"
+		"1:"
+		: [a] "+&d" (a)
+		: [b] "r" (b)
+	);
+	return a;
+#else
+	sint64 sum = (sint64)a + b;
+
+	return (sum > FIXED_Q16_16_MAX) ? FIXED_Q16_16_MAX : ((sum < FIXED_Q16_16_MIN) ? FIXED_Q16_16_MIN : (sint32)sum);
+#endif
+}
+
+/*
+ * Description: Function to subtract two Q16.16 with saturation
+ */
+static inline sint32 Fixed_sub32(sint32 a, sint32 b)
+{
+#ifdef __AVR__
+	__asm__ (
+		"sub  %A[a], %A[b]"    "\n\t"
+		"sbc  %B[a], %B[b]"    "\n\t"
+		"sbc  %C[a], %C[b]"    "\n\t"
+		"sbc  %D[a], %D[b]"    "\n\t"
+		"brvc 1f"              "\n\t"
+		"ldi  %A[a], 0XFF"     "\n\t"
+		"ldi  %B[a], 0XFF"     "\n\t"
+		"ldi  %C[a], 0XFF"     "\n\t"
+		"ldi  %D[a], 0X7F"     "\n\t"
+		"sbrc %D[b], 7"        "\n\t"
+		"rjmp 1f"              "\n\t"
+		"ldi  %A[a], 0X00"     "\n\t"
+		"ldi  %B[a], 0X00"     "\n\t"
+		"ldi  %C[a], 0X00"     "\n\t"
+		"ldi  %D[a], 0X80"     "\n"
+		"1:"
+		: [a] "+&d" (a)
+		: [b] "r" (b)
+	);
+	return a;
+#else
+	sint64 difference = (sint64)a - b;
+
+	return (difference > FIXED_Q16_16_MAX) ? FIXED_Q16_16_MAX :
+			((difference < FIXED_Q16_16_MIN) ? FIXED_Q16_16_MIN : (sint32)difference);
+#endif
+}
+
+/*
+ * Description: Function to multiply two unsigned 16-bit, 32-bit product
+ */
+static inline uint32 Fixed_mulU16(uint16 a, uint16 b)
+{
+#ifdef __AVR__
+	uint32 product;
+	uint8 zero;
+
+	__asm__ (
+		"clr  %[zero]"         "\n\t"
+		"mul  %A[a], %A[b]"    "\n\t"
+		"movw %A[p], r0"       "\n\t"
+		"mul  %B[a], %B[b]"    "\n\t"
+		"movw %C[p], r0"       "\n\t"
+		"mul  %B[a], %A[b]"    "\n\t"
+		"add  %B[p], r0"       "\n\t"
+		"adc  %C[p], r1"       "\n\t"
+		"adc  %D[p], %[zero]"  "\n\t"
+		"mul  %A[a], %B[b]"    "\n\t"
+		"add  %B[p], r0"       "\n\t"
+		"adc  %C[p], r1"       "\n\t"
+		"adc  %D[p], %[zero]"  "\n\t"
+		"clr  r1"
+		: [p] "=&r" (product), [zero] "=&r" (zero)
+		: [a] "r" (a), [b] "r" (b)
+	);
+	return product;
+#else
+	return (uint32)a * b;
+#endif
+}
+
+/*
+ * Description: Function to multiply two signed 16-bit, 32-bit product
+ *              MULSU sets C to the sign of its product, SBC extends it
+ */
+static inline sint32 Fixed_mulS16(sint16 a, sint16 b)
+{
+#ifdef __AVR__
+	sint32 product;
+	uint8 zero;
+
+	__asm__ (
+		"clr   %[zero]"        "\n\t"
+		"muls  %B[a], %B[b]"   "\n\t"
+		"movw  %C[p], r0"      "\n\t"
+		"mul   %A[a], %A[b]"   "\n\t"
+		"movw  %A[p], r0"      "\n\t"
+		"mulsu %B[a], %A[b]"   "\n\t"
+		"sbc   %D[p], %[zero]" "\n\t"
+		"add   %B[p], r0"      "\n\t"
+		"adc   %C[p], r1"      "\n\t"
+		"adc   %D[p], %[zero]" "\n\t"
+		"mulsu %B[b], %A[a]"   "\n\t"
+		"sbc   %D[p], %[zero]" "\n\t"
+		"add   %B[p], r0"      "\n\t"
+		"adc   %C[p], r1"      "\n\t"
+		"adc   %D[p], %[zero]" "\n\t"
+		"clr   r1"
+		: [p] "=&r" (product), [zero] "=&r" (zero)
+		: [a] "a" (a), [b] "a" (b)
+	);
+	return product;
+#else
+	return (sint32)a * b;
+#endif
+}
+
+/*
+ * Description: Function to multiply a signed and an unsigned 16-bit, 32-bit
+ *              product, the halves of the Q16.16 multiplication
+ */
+static inline sint32 Fixed_mulSU16(sint16 a, uint16 b)
+{
+#ifdef __AVR__
+	sint32 product;
+	uint8 zero;
+
+	__asm__ (
+		"clr   %[zero]"        "\n\t"
+		"mulsu %B[a], %B[b]"   "\n\t"
+		"movw  %C[p], r0"      "\n\t"
+		"mul   %A[a], %A[b]"   "\n\t"
+		"movw  %A[p], r0"      "\n\t"
+		"mul   %A[a], %B[b]"   "\n\t"
+		"add   %B[p], r0"      "\n\t"
+		"adc   %C[p], r1"      "\n\t"
+		"adc   %D[p], %[zero]" "\n\t"
+		"mulsu %B[a], %A[b]"   "\n\t"
+		"sbc   %D[p], %[zero]" "\n\t"
+		"add   %B[p], r0"      "\n\t"
+		"adc   %C[p], r1"      "\n\t"
+		"adc   %D[p], %[zero]" "\n\t"
+		"clr   r1"
+		: [p] "=&r" (product), [zero] "=&r" (zero)
+		: [a] "a" (a), [b] "a" (b)
+	);
+	return product;
+#else
+	return (sint32)a * b;
+#endif
+}
+
+/*
+ * Description: Function to multiply two Q15, Q31 product (2.a.b)
+ *              The FMUL* shift their product left, the bit out of the low
+ *              bytes one goes to C. -1 x -1 wraps to -1
+ */
+static inline sint32 Fixed_fmulQ15(q15 a, q15 b)
+{
+#ifdef __AVR__
+	sint32 product;
+	uint8 zero;
+
+	__asm__ (
+		"clr    %[zero]"        "\n\t"
+		"fmuls  %B[a], %B[b]"   "\n\t"
+		"movw   %C[p], r0"      "\n\t"
+		"fmul   %A[a], %A[b]"   "\n\t"
+		"adc    %C[p], %[zero]" "\n\t"
+		"movw   %A[p], r0"      "\n\t"
+		"fmulsu %B[a], %A[b]"   "\n\t"
+		"sbc    %D[p], %[zero]" "\n\t"
+		"add    %B[p], r0"      "\n\t"
+		"adc    %C[p], r1"      "\n\t"
+		"adc    %D[p], %[zero]" "\n\t"
+		"fmulsu %B[b], %A[a]"   "\n\t"
+		"sbc    %D[p], %[zero]" "\n\t"
+		"add    %B[p], r0"      "\n\t"
+		"adc    %C[p], r1"      "\n\t"
+		"adc    %D[p], %[zero]" "\n\t"
+		"clr    r1"
+		: [p] "=&r" (product), [zero] "=&r" (zero)
+		: [a] "a" (a), [b] "a" (b)
+	);
+	return product;
+#else
+	return (sint32)((uint32)((sint32)a * b) << 1);
+#endif
+}
+
+/*
+ * Description: Function to multiply two Q15 with saturation, the upper half
+ *              of the Q31 product
+ */
+static inline q15 Fixed_mulQ15(q15 a, q15 b)
+{
+	if( (a == FIXED_Q15_MIN) && (b == FIXED_Q15_MIN) )
+	{
+		return FIXED_Q15_MAX;
+	}
+	return (q15)(Fixed_fmulQ15(a, b) >> 16);
+}
+
+/*
+ * Description: Function to multiply two Q7.8 with saturation
+ */
+static inline q7_8 Fixed_mulQ7_8(q7_8 a, q7_8 b)
+{
+	return Fixed_saturate16(Fixed_mulS16(a, b) >> 8);
+}
+
+#endif /* FIXED_POINT_H_ */
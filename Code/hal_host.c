@@ -0,0 +1,1553 @@
+/**********************************************************************************
+ * [FILE NAME]: hal_host.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Simulated register file and peripherals of the ATmega16 for
+ *                the host build of the drivers (-DHOST_SIMULATION).
+ *                A read and a write of the same register can't be told apart
+ *                through a pointer, so the writes are found by comparing the
+ *                register file with its copy at the next access:
+ *                - Writing the value already there has no side effect, which
+ *                  is true for the hardware except the write one to clear
+ *                  flags, those are cleared by the dispatch of their vector
+ *                  or by the next write of another bit of their register
+ *                - The time advances HOST_HAL_CYCLES_PER_ACCESS per access and
+ *                  with the delays, not instruction by instruction
+ *                - UDR is a read (receive) or a write (transmit) at the same
+ *                  address: an access changing it is a write, otherwise it is
+ *                  a read if a received byte is waiting (RXC) and a write of
+ *                  the same value if not
+ *
+ ***********************************************************************************/
+
+#ifdef HOST_SIMULATION
+
+#include <string.h>
+#include "micro_config.h"
+#include "common_macros.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define HOST_HAL_NO_EVENT                0XFFFFFFFFUL
+#define HOST_HAL_NUMBER_OF_TIMERS        3
+#define HOST_HAL_NUMBER_OF_VECTORS       20
+#define HOST_HAL_MAX_NESTED_DISPATCH     64
+#define HOST_HAL_SLEEP_STEP              F_CPU
+
+/* ADC: 13 ADC clocks per conversion, 25 for the first one after enable */
+#define HOST_HAL_ADC_CONVERSION_CLOCKS   13
+#define HOST_HAL_ADC_FIRST_CONVERSION_CLOCKS 25
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	HOST_TIMER_NORMAL, HOST_TIMER_CTC, HOST_TIMER_FAST_PWM, HOST_TIMER_PHASE_CORRECT
+
+}HostHal_TimerKind;
+
+typedef struct
+{
+	uint8 counterAddress;
+	bool wide;                    /* 16-bit counter */
+	uint8 clockAddress;           /* register of CSn2:0 */
+	const uint16 *prescalers;     /* index is CSn2:0, 0 stops the timer */
+	uint8 overflowFlag;           /* mask in TIFR */
+	uint8 numberOfCompares;
+	uint8 compareAddress[2];
+	uint8 compareFlag[2];
+
+}HostHal_TimerConfigType;
+
+typedef struct
+{
+	uint32 prescalerCount;
+	bool countingDown;            /* phase correct modes */
+
+}HostHal_TimerStateType;
+
+typedef struct
+{
+	uint8 enableAddress;
+	uint8 enableMask;
+	uint8 flagAddress;
+	uint8 flagMask;
+	void (*vector)(void);
+
+}HostHal_VectorType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+volatile uint8 g_hostHal_registers[HOST_HAL_REGISTERS_SIZE] __attribute__((aligned(2)));
+static uint8 g_shadow[HOST_HAL_REGISTERS_SIZE];
+static bool g_initialized = FALSE;
+static uint64 g_cycles = 0;
+
+/* Levels driven from outside on the pins of PORTA:PORTD */
+static uint8 g_inputs[4];
+/* Levels of INT0, INT1, INT2 pins at the last update */
+static uint8 g_interruptPins = 0;
+
+static uint16 g_adcInputs[8];
+static HostHal_AdcSourceType g_adcSource = NULL_PTR;
+static bool g_adcBusy = FALSE;
+static bool g_adcFirstConversion = TRUE;
+static uint32 g_adcRemaining = 0;
+
+static HostHal_HookType g_hook = NULL_PTR;
+static uint32 g_hookPeriod = 0;
+static uint32 g_hookRemaining = 0;
+static bool g_hookRunning = FALSE;
+
+/* USART: byte being shifted out on TXD and byte waiting in the TX buffer */
+static bool g_uartShifting = FALSE;
+static uint32 g_uartRemaining = 0;
+static uint8 g_uartShiftData = 0;
+static bool g_uartBufferFull = FALSE;
+static uint8 g_uartBufferData = 0;
+static uint8 g_uartReceived = 0;
+static bool g_udrAccessed = FALSE;
+static bool g_udrReadable = FALSE;
+/* UBRRH and UCSRC share their address */
+static uint8 g_uartBaudHigh = 0;
+static uint8 g_uartControlC = 0;
+static uint8 g_uartLog[HOST_HAL_UART_LOG_SIZE];
+static uint16 g_uartLogHead = 0;
+static uint16 g_uartLogTail = 0;
+
+/* Sleep: set by sleep_cpu, woken once a vector has run */
+static bool g_sleeping = FALSE;
+static bool g_woken = FALSE;
+static uint8 g_vectorDepth = 0;  /* vectors running, nested ones included */
+static uint64 g_wakeCycles = 0;  /* entry of the vector waking the CPU */
+static uint64 g_sleepCycles = 0;
+
+/* EEPROM: kept by HostHal_reset, a write runs while EEWE is set */
+static uint8 g_eeprom[HOST_HAL_EEPROM_SIZE];
+static bool g_eepromErased = FALSE;
+static bool g_eepromWriting = FALSE;
+static uint32 g_eepromRemaining = 0;
+
+static uint8 g_lcdDdram[HOST_HAL_LCD_DDRAM_SIZE];
+static uint8 g_lcdAddress = 0;
+
+static const uint16 g_timer01Prescalers[8] = {0, 1, 8, 64, 256, 1024, 0, 0};
+static const uint16 g_timer2Prescalers[8] = {0, 1, 8, 32, 64, 128, 256, 1024};
+static const uint8 g_adcPrescalers[8] = {2, 2, 4, 8, 16, 32, 64, 128};
+
+static const HostHal_TimerConfigType g_timers[HOST_HAL_NUMBER_OF_TIMERS] =
+{
+		{TCNT0_ADDRESS, FALSE, TCCR0_ADDRESS, g_timer01Prescalers, (1<<TOV0),
+				1, {OCR0_ADDRESS, 0}, {(1<<OCF0), 0}},
+		{TCNT1L_ADDRESS, TRUE, TCCR1B_ADDRESS, g_timer01Prescalers, (1<<TOV1),
+				2, {OCR1AL_ADDRESS, OCR1BL_ADDRESS}, {(1<<OCF1A), (1<<OCF1B)}},
+		{TCNT2_ADDRESS, FALSE, TCCR2_ADDRESS, g_timer2Prescalers, (1<<TOV2),
+				1, {OCR2_ADDRESS, 0}, {(1<<OCF2), 0}}
+};
+
+static HostHal_TimerStateType g_timerStates[HOST_HAL_NUMBER_OF_TIMERS];
+
+/* Vectors in their priority order */
+static const HostHal_VectorType g_vectors[HOST_HAL_NUMBER_OF_VECTORS] =
+{
+		{GICR_ADDRESS, (1<<INT0), GIFR_ADDRESS, (1<<INTF0), INT0_vect},
+		{GICR_ADDRESS, (1<<INT1), GIFR_ADDRESS, (1<<INTF1), INT1_vect},
+		{TIMSK_ADDRESS, (1<<OCIE2), TIFR_ADDRESS, (1<<OCF2), TIMER2_COMP_vect},
+		{TIMSK_ADDRESS, (1<<TOIE2), TIFR_ADDRESS, (1<<TOV2), TIMER2_OVF_vect},
+		{TIMSK_ADDRESS, (1<<TICIE1), TIFR_ADDRESS, (1<<ICF1), TIMER1_CAPT_vect},
+		{TIMSK_ADDRESS, (1<<OCIE1A), TIFR_ADDRESS, (1<<OCF1A), TIMER1_COMPA_vect},
+		{TIMSK_ADDRESS, (1<<OCIE1B), TIFR_ADDRESS, (1<<OCF1B), TIMER1_COMPB_vect},
+		{TIMSK_ADDRESS, (1<<TOIE1), TIFR_ADDRESS, (1<<TOV1), TIMER1_OVF_vect},
+		{TIMSK_ADDRESS, (1<<TOIE0), TIFR_ADDRESS, (1<<TOV0), TIMER0_OVF_vect},
+		{SPCR_ADDRESS, 0, SPSR_ADDRESS, 0, SPI_STC_vect},
+		{UCSRB_ADDRESS, (1<<RXCIE), UCSRA_ADDRESS, (1<<RXC), USART_RXC_vect},
+		{UCSRB_ADDRESS, (1<<UDRIE), UCSRA_ADDRESS, (1<<UDRE), USART_UDRE_vect},
+		{UCSRB_ADDRESS, (1<<TXCIE), UCSRA_ADDRESS, (1<<TXC), USART_TXC_vect},
+		{ADCSRA_ADDRESS, (1<<ADIE), ADCSRA_ADDRESS, (1<<ADIF), ADC_vect},
+		{EECR_ADDRESS, (1<<EERIE), EECR_ADDRESS, 0, EE_RDY_vect},
+		{ACSR_ADDRESS, (1<<ACIE), ACSR_ADDRESS, (1<<ACI), ANA_COMP_vect},
+		{TWCR_ADDRESS, 0, TWCR_ADDRESS, 0, TWI_vect},
+		{GICR_ADDRESS, (1<<INT2), GIFR_ADDRESS, (1<<INTF2), INT2_vect},
+		{TIMSK_ADDRESS, (1<<OCIE0), TIFR_ADDRESS, (1<<OCF0), TIMER0_COMP_vect},
+		{SPMCR_ADDRESS, 0, SPMCR_ADDRESS, 0, SPM_RDY_vect}
+};
+
+/*******************************************************************************
+ *                      Weak Interrupt Vectors                                 *
+ *******************************************************************************/
+
+void __attribute__((weak)) INT0_vect(void) {}
+void __attribute__((weak)) INT1_vect(void) {}
+void __attribute__((weak)) TIMER2_COMP_vect(void) {}
+void __attribute__((weak)) TIMER2_OVF_vect(void) {}
+void __attribute__((weak)) TIMER1_CAPT_vect(void) {}
+void __attribute__((weak)) TIMER1_COMPA_vect(void) {}
+void __attribute__((weak)) TIMER1_COMPB_vect(void) {}
+void __attribute__((weak)) TIMER1_OVF_vect(void) {}
+void __attribute__((weak)) TIMER0_OVF_vect(void) {}
+void __attribute__((weak)) SPI_STC_vect(void) {}
+void __attribute__((weak)) USART_RXC_vect(void) {}
+void __attribute__((weak)) USART_UDRE_vect(void) {}
+void __attribute__((weak)) USART_TXC_vect(void) {}
+void __attribute__((weak)) ADC_vect(void) {}
+void __attribute__((weak)) EE_RDY_vect(void) {}
+void __attribute__((weak)) ANA_COMP_vect(void) {}
+void __attribute__((weak)) TWI_vect(void) {}
+void __attribute__((weak)) INT2_vect(void) {}
+void __attribute__((weak)) TIMER0_COMP_vect(void) {}
+void __attribute__((weak)) SPM_RDY_vect(void) {}
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: write of the model, the register file and its copy together so
+ *              it is not taken for a write of the program
+ */
+static void HostHal_set8(uint8 address, uint8 value)
+{
+	g_hostHal_registers[address] = value;
+	g_shadow[address] = value;
+}
+
+static uint16 HostHal_get16(uint8 address)
+{
+	return (uint16)g_hostHal_registers[address] | ((uint16)g_hostHal_registers[address + 1] << 8);
+}
+
+static void HostHal_set16(uint8 address, uint16 value)
+{
+	HostHal_set8(address, (uint8)value);
+	HostHal_set8(address + 1, (uint8)(value >> 8));
+}
+
+static void HostHal_setFlag(uint8 address, uint8 mask)
+{
+	HostHal_set8(address, g_hostHal_registers[address] | mask);
+}
+
+/*
+ * Description: Level of a pin, driven by the port if output, from outside if input
+ */
+static uint8 HostHal_pinsOf(uint8 port)
+{
+	/* PINx, DDRx, PORTx of port A are the highest addresses */
+	uint8 pinAddress = PINA_ADDRESS - (3 * port);
+	uint8 ddr = g_hostHal_registers[pinAddress + 1];
+
+	return (uint8)((g_inputs[port] & ~ddr) | (g_hostHal_registers[pinAddress + 2] & ddr));
+}
+
+/*
+ * Description: ISCn1:0 of INT0/INT1: 0 low level, 1 any change, 2 falling, 3 rising
+ */
+static bool HostHal_senseMatches(uint8 sense, bool rising)
+{
+	switch(sense)
+	{
+	case 1:  return TRUE;
+	case 3:  return rising;
+	default: return !rising;
+	}
+}
+
+/*
+ * Description: refresh the PINx registers, the edges on INT0 (PD2), INT1 (PD3)
+ *              and INT2 (PB2) set their flags
+ *              The low level mode of INT0/INT1 is taken as the falling edge
+ */
+static void HostHal_updatePins(void)
+{
+	uint8 pins = 0;
+	uint8 changed;
+	uint8 rising;
+	uint8 port;
+
+	for(port = 0; port < 4; port++)
+	{
+		HostHal_set8(PINA_ADDRESS - (3 * port), HostHal_pinsOf(port));
+	}
+
+	if(BIT_IS_SET(HostHal_pinsOf(3), PD2)) pins |= (1<<INTF0);
+	if(BIT_IS_SET(HostHal_pinsOf(3), PD3)) pins |= (1<<INTF1);
+	if(BIT_IS_SET(HostHal_pinsOf(1), PB2)) pins |= (1<<INTF2);
+
+	changed = pins ^ g_interruptPins;
+	rising = changed & pins;
+	g_interruptPins = pins;
+
+	if( BIT_IS_SET(changed, INTF0) && HostHal_senseMatches(g_hostHal_registers[MCUCR_ADDRESS] & 0X03, BIT_IS_SET(rising, INTF0)) )
+	{
+		HostHal_setFlag(GIFR_ADDRESS, (1<<INTF0));
+	}
+	if( BIT_IS_SET(changed, INTF1) && HostHal_senseMatches((g_hostHal_registers[MCUCR_ADDRESS] >> 2) & 0X03, BIT_IS_SET(rising, INTF1)) )
+	{
+		HostHal_setFlag(GIFR_ADDRESS, (1<<INTF1));
+	}
+	/* INT2 is edge only, ISC2 = 0 falling, 1 rising */
+	if( BIT_IS_SET(changed, INTF2) && HostHal_senseMatches(BIT_IS_SET(g_hostHal_registers[MCUCSR_ADDRESS], ISC2) ? 3 : 2, BIT_IS_SET(rising, INTF2)) )
+	{
+		HostHal_setFlag(GIFR_ADDRESS, (1<<INTF2));
+	}
+}
+
+/*
+ * Description: HD44780 instruction or data latched at the falling edge of E
+ */
+static void HostHal_lcdLatch(uint8 rs, uint8 data)
+{
+	uint8 i;
+
+	if(rs)
+	{
+		g_lcdDdram[g_lcdAddress] = data;
+		g_lcdAddress = (g_lcdAddress + 1) & (HOST_HAL_LCD_DDRAM_SIZE - 1);
+	}
+	else if(data & 0X80)
+	{
+		g_lcdAddress = data & (HOST_HAL_LCD_DDRAM_SIZE - 1);
+	}
+	else if(data == 0X01)
+	{
+		for(i = 0; i < HOST_HAL_LCD_DDRAM_SIZE; i++)
+		{
+			g_lcdDdram[i] = ' ';
+		}
+		g_lcdAddress = 0;
+	}
+	else if((data & 0XFE) == 0X02)
+	{
+		g_lcdAddress = 0;
+	}
+}
+
+/*
+ * Description: ADC conversion started by a rising edge of ADSC
+ */
+static void HostHal_adcStart(void)
+{
+	uint8 clocks = g_adcFirstConversion ? HOST_HAL_ADC_FIRST_CONVERSION_CLOCKS : HOST_HAL_ADC_CONVERSION_CLOCKS;
+
+	g_adcFirstConversion = FALSE;
+	g_adcBusy = TRUE;
+	g_adcRemaining = (uint32)clocks * g_adcPrescalers[g_hostHal_registers[ADCSRA_ADDRESS] & 0X07];
+}
+
+static void HostHal_adcComplete(void)
+{
+	uint8 channel = g_hostHal_registers[ADMUX_ADDRESS] & 0X07;
+	uint16 value = (g_adcSource != NULL_PTR) ? g_adcSource(channel) : g_adcInputs[channel];
+
+	if(value > 1023)
+	{
+		value = 1023;
+	}
+	if(BIT_IS_SET(g_hostHal_registers[ADMUX_ADDRESS], ADLAR))
+	{
+		value <<= 6;
+	}
+
+	g_adcBusy = FALSE;
+	HostHal_set16(ADCL_ADDRESS, value);
+	HostHal_set8(ADCSRA_ADDRESS, (g_hostHal_registers[ADCSRA_ADDRESS] & ~(1<<ADSC)) | (1<<ADIF));
+}
+
+/*
+ * Description: cycles of one USART frame from the baud rate and frame format
+ */
+static uint32 HostHal_uartFrameCycles(void)
+{
+	uint16 ubrr = ((uint16)(g_uartBaudHigh & 0X0F) << 8) | g_hostHal_registers[UBRRL_ADDRESS];
+	uint8 size = (g_uartControlC >> UCSZ0) & 0X03;
+	uint8 bits = 1 + 5 + size; /* start bit and 5:8 data bits */
+
+	if(BIT_IS_SET(g_hostHal_registers[UCSRB_ADDRESS], UCSZ2))
+	{
+		bits = 1 + 9;
+	}
+	if(BIT_IS_SET(g_uartControlC, UPM1))
+	{
+		bits++;
+	}
+	bits += BIT_IS_SET(g_uartControlC, USBS) ? 2 : 1;
+
+	return (uint32)bits * (BIT_IS_SET(g_hostHal_registers[UCSRA_ADDRESS], U2X) ? 8 : 16) * (ubrr + 1);
+}
+
+static void HostHal_uartStartShift(uint8 data)
+{
+	g_uartShifting = TRUE;
+	g_uartShiftData = data;
+	g_uartRemaining = HostHal_uartFrameCycles();
+}
+
+/*
+ * Description: write of UDR, to the shift register if idle else to the buffer
+ */
+static void HostHal_uartWrite(uint8 data)
+{
+	if(BIT_IS_CLEAR(g_hostHal_registers[UCSRB_ADDRESS], TXEN))
+	{
+		return;
+	}
+
+	if(!g_uartShifting)
+	{
+		HostHal_uartStartShift(data);
+	}
+	else if(!g_uartBufferFull)
+	{
+		g_uartBufferFull = TRUE;
+		g_uartBufferData = data;
+		HostHal_set8(UCSRA_ADDRESS, g_hostHal_registers[UCSRA_ADDRESS] & ~(1<<UDRE));
+	}
+	/* written while UDRE is clear, lost */
+}
+
+static void HostHal_uartShiftComplete(void)
+{
+	g_uartLog[g_uartLogHead] = g_uartShiftData;
+	g_uartLogHead = (g_uartLogHead + 1) % HOST_HAL_UART_LOG_SIZE;
+	if(g_uartLogHead == g_uartLogTail)
+	{
+		g_uartLogTail = (g_uartLogTail + 1) % HOST_HAL_UART_LOG_SIZE; /* oldest byte lost */
+	}
+
+	if(g_uartBufferFull)
+	{
+		g_uartBufferFull = FALSE;
+		HostHal_uartStartShift(g_uartBufferData);
+		HostHal_setFlag(UCSRA_ADDRESS, (1<<UDRE));
+	}
+	else
+	{
+		g_uartShifting = FALSE;
+		HostHal_setFlag(UCSRA_ADDRESS, (1<<TXC));
+	}
+}
+
+/*
+ * Description: access of UDR found at the next commit, see the file description
+ */
+static void HostHal_uartAccess(void)
+{
+	uint8 value = g_hostHal_registers[UDR_ADDRESS];
+
+	g_udrAccessed = FALSE;
+
+	if( (value != g_shadow[UDR_ADDRESS]) || !g_udrReadable )
+	{
+		HostHal_uartWrite(value);
+	}
+	else
+	{
+		HostHal_set8(UCSRA_ADDRESS, g_hostHal_registers[UCSRA_ADDRESS] &
+				~((1<<RXC) | (1<<FE) | (1<<DOR) | (1<<PE)));
+	}
+
+	/* a read of UDR gives the received byte */
+	HostHal_set8(UDR_ADDRESS, g_uartReceived);
+}
+
+/*
+ * Description: EECR written by the program
+ *              - EERE reads the byte at EEAR in EEDR at once
+ *              - EEWE with EEMWE set writes EEDR at EEAR, EEWE stays set
+ *                during the write, EEMWE is cleared (its 4 cycles are over)
+ *              Both are ignored during a write like the hardware does
+ */
+static void HostHal_eepromControl(uint8 * Value_Ptr)
+{
+	uint16 address = HostHal_get16(EEARL_ADDRESS) & (HOST_HAL_EEPROM_SIZE - 1);
+
+	if(g_eepromWriting)
+	{
+		*Value_Ptr |= (1<<EEWE);
+	}
+	else if(BIT_IS_SET(*Value_Ptr, EEWE) && BIT_IS_SET(*Value_Ptr, EEMWE))
+	{
+		g_eeprom[address] = g_hostHal_registers[EEDR_ADDRESS];
+		g_eepromWriting = TRUE;
+		g_eepromRemaining = HOST_HAL_EEPROM_WRITE_CYCLES;
+		*Value_Ptr &= ~(1<<EEMWE);
+	}
+	else if(BIT_IS_SET(*Value_Ptr, EERE))
+	{
+		HostHal_set8(EEDR_ADDRESS, g_eeprom[address]);
+	}
+
+	/* EEWE without EEMWE doesn't start a write */
+	if(!g_eepromWriting)
+	{
+		*Value_Ptr &= ~(1<<EEWE);
+	}
+	*Value_Ptr &= ~(1<<EERE);
+}
+
+/*
+ * Description: side effects of a write of the program found by HostHal_commit
+ */
+static void HostHal_onWrite(uint8 address, uint8 old, uint8 value)
+{
+	uint8 clearOnOne = 0;
+	uint8 readOnly = 0;
+
+	switch(address)
+	{
+	case TIFR_ADDRESS:
+	case GIFR_ADDRESS:
+		clearOnOne = 0XFF;
+		break;
+	case ACSR_ADDRESS:
+		clearOnOne = (1<<ACI);
+		readOnly = (1<<ACO); /* driven by HostHal_setComparatorOutput */
+		break;
+	case ADCSRA_ADDRESS:
+		clearOnOne = (1<<ADIF);
+		if(BIT_IS_CLEAR(value, ADEN))
+		{
+			g_adcBusy = FALSE;
+			g_adcFirstConversion = TRUE;
+			value &= ~(1<<ADSC);
+		}
+		else if(g_adcBusy)
+		{
+			value |= (1<<ADSC); /* writing 0 to ADSC has no effect */
+		}
+		else if(BIT_IS_SET(value, ADSC))
+		{
+			HostHal_adcStart();
+		}
+		break;
+	case SFIOR_ADDRESS:
+		if(BIT_IS_SET(value, PSR10))
+		{
+			g_timerStates[0].prescalerCount = 0;
+			g_timerStates[1].prescalerCount = 0;
+		}
+		if(BIT_IS_SET(value, PSR2))
+		{
+			g_timerStates[2].prescalerCount = 0;
+		}
+		value &= ~((1<<PSR10) | (1<<PSR2));
+		break;
+	case UCSRA_ADDRESS:
+		clearOnOne = (1<<TXC);
+		readOnly = (1<<RXC) | (1<<UDRE) | (1<<FE) | (1<<DOR) | (1<<PE);
+		break;
+	case UCSRB_ADDRESS:
+		if(BIT_IS_CLEAR(value, RXEN))
+		{
+			HostHal_set8(UCSRA_ADDRESS, g_hostHal_registers[UCSRA_ADDRESS] & ~(1<<RXC));
+		}
+		break;
+	case UCSRC_ADDRESS:
+		if(BIT_IS_SET(value, URSEL))
+		{
+			g_uartControlC = value;
+		}
+		else
+		{
+			g_uartBaudHigh = value;
+		}
+		break;
+	case EECR_ADDRESS:
+		HostHal_eepromControl(&value);
+		break;
+	case TCCR0_ADDRESS:
+		value &= ~(1<<FOC0); /* strobe bits read as zero */
+		break;
+	case TCCR2_ADDRESS:
+		value &= ~(1<<FOC2);
+		break;
+	case TCCR1A_ADDRESS:
+		value &= ~((1<<FOC1A) | (1<<FOC1B));
+		break;
+	default:
+		break;
+	}
+
+	/* write one to clear: written ones clear, written zeros keep the flag */
+	value = (uint8)((value & ~clearOnOne) | (old & clearOnOne & ~value));
+	value = (uint8)((value & ~readOnly) | (old & readOnly));
+	HostHal_set8(address, value);
+
+	if( (address == HOST_HAL_LCD_CTRL_ADDRESS) &&
+			BIT_IS_SET(g_hostHal_registers[HOST_HAL_LCD_CTRL_DIRECTION_ADDRESS], HOST_HAL_LCD_E_PIN) &&
+			BIT_IS_SET(old, HOST_HAL_LCD_E_PIN) && BIT_IS_CLEAR(value, HOST_HAL_LCD_E_PIN) )
+	{
+		HostHal_lcdLatch(BIT_IS_SET(value, HOST_HAL_LCD_RS_PIN), g_hostHal_registers[HOST_HAL_LCD_DATA_ADDRESS]);
+	}
+
+	if( (address >= PIND_ADDRESS) && (address <= PORTA_ADDRESS) )
+	{
+		HostHal_updatePins();
+	}
+}
+
+/*
+ * Description: find the writes of the program since the last access
+ */
+static void HostHal_commit(void)
+{
+	uint8 address;
+	uint8 old;
+
+	if(g_udrAccessed)
+	{
+		HostHal_uartAccess();
+	}
+
+	if(memcmp((const void *)g_hostHal_registers, g_shadow, HOST_HAL_REGISTERS_SIZE) == 0)
+	{
+		return;
+	}
+
+	for(address = 0; address < HOST_HAL_REGISTERS_SIZE; address++)
+	{
+		if(g_hostHal_registers[address] != g_shadow[address])
+		{
+			old = g_shadow[address];
+			g_shadow[address] = g_hostHal_registers[address];
+			HostHal_onWrite(address, old, g_hostHal_registers[address]);
+		}
+	}
+}
+
+/*
+ * Description: wave generation of a timer, its TOP and the largest count
+ */
+static uint8 HostHal_timerMode(uint8 timer, uint16 *top_Ptr, uint16 *max_Ptr)
+{
+	uint8 control;
+	uint8 wgm;
+
+	if(timer != 1)
+	{
+		control = g_hostHal_registers[g_timers[timer].clockAddress];
+		wgm = (BIT_IS_SET(control, WGM00) ? 1 : 0) | (BIT_IS_SET(control, WGM01) ? 2 : 0);
+		*max_Ptr = 0XFF;
+		*top_Ptr = (wgm == 2) ? g_hostHal_registers[g_timers[timer].compareAddress[0]] : 0XFF;
+		return (wgm == 0) ? HOST_TIMER_NORMAL : (wgm == 1) ? HOST_TIMER_PHASE_CORRECT :
+				(wgm == 2) ? HOST_TIMER_CTC : HOST_TIMER_FAST_PWM;
+	}
+
+	wgm = (g_hostHal_registers[TCCR1A_ADDRESS] & 0X03) | ((g_hostHal_registers[TCCR1B_ADDRESS] >> 1) & 0X0C);
+	*max_Ptr = 0XFFFF;
+
+	switch(wgm)
+	{
+	case 1: *top_Ptr = 0X00FF; return HOST_TIMER_PHASE_CORRECT;
+	case 2: *top_Ptr = 0X01FF; return HOST_TIMER_PHASE_CORRECT;
+	case 3: *top_Ptr = 0X03FF; return HOST_TIMER_PHASE_CORRECT;
+	case 4: *top_Ptr = HostHal_get16(OCR1AL_ADDRESS); return HOST_TIMER_CTC;
+	case 5: *top_Ptr = 0X00FF; return HOST_TIMER_FAST_PWM;
+	case 6: *top_Ptr = 0X01FF; return HOST_TIMER_FAST_PWM;
+	case 7: *top_Ptr = 0X03FF; return HOST_TIMER_FAST_PWM;
+	case 8:
+	case 10: *top_Ptr = HostHal_get16(ICR1L_ADDRESS); return HOST_TIMER_PHASE_CORRECT;
+	case 9:
+	case 11: *top_Ptr = HostHal_get16(OCR1AL_ADDRESS); return HOST_TIMER_PHASE_CORRECT;
+	case 12: *top_Ptr = HostHal_get16(ICR1L_ADDRESS); return HOST_TIMER_CTC;
+	case 14: *top_Ptr = HostHal_get16(ICR1L_ADDRESS); return HOST_TIMER_FAST_PWM;
+	case 15: *top_Ptr = HostHal_get16(OCR1AL_ADDRESS); return HOST_TIMER_FAST_PWM;
+	default: *top_Ptr = 0XFFFF; return HOST_TIMER_NORMAL;
+	}
+}
+
+static uint16 HostHal_timerCounter(uint8 timer)
+{
+	const HostHal_TimerConfigType *config_Ptr = &g_timers[timer];
+
+	return config_Ptr->wide ? HostHal_get16(config_Ptr->counterAddress) : g_hostHal_registers[config_Ptr->counterAddress];
+}
+
+static void HostHal_timerSetCounter(uint8 timer, uint16 counter)
+{
+	const HostHal_TimerConfigType *config_Ptr = &g_timers[timer];
+
+	if(config_Ptr->wide)
+	{
+		HostHal_set16(config_Ptr->counterAddress, counter);
+	}
+	else
+	{
+		HostHal_set8(config_Ptr->counterAddress, (uint8)counter);
+	}
+}
+
+static uint16 HostHal_timerCompare(uint8 timer, uint8 channel)
+{
+	const HostHal_TimerConfigType *config_Ptr = &g_timers[timer];
+
+	return config_Ptr->wide ? HostHal_get16(config_Ptr->compareAddress[channel]) :
+			g_hostHal_registers[config_Ptr->compareAddress[channel]];
+}
+
+/*
+ * Description: timer ticks until its next flag, at least one
+ */
+static uint32 HostHal_timerTicksToEvent(uint8 timer)
+{
+	uint16 top;
+	uint16 max;
+	uint8 kind = HostHal_timerMode(timer, &top, &max);
+	uint16 counter = HostHal_timerCounter(timer);
+	uint16 compare;
+	uint32 ticks;
+	uint8 channel;
+
+	if(kind == HOST_TIMER_PHASE_CORRECT)
+	{
+		if(!g_timerStates[timer].countingDown)
+		{
+			ticks = (counter < top) ? (uint32)(top - counter) : 1;
+			for(channel = 0; channel < g_timers[timer].numberOfCompares; channel++)
+			{
+				compare = HostHal_timerCompare(timer, channel);
+				if( (compare > counter) && ((uint32)(compare - counter) < ticks) )
+				{
+					ticks = (uint32)(compare - counter);
+				}
+			}
+		}
+		else
+		{
+			ticks = (counter > 0) ? counter : 1;
+			for(channel = 0; channel < g_timers[timer].numberOfCompares; channel++)
+			{
+				compare = HostHal_timerCompare(timer, channel);
+				if( (compare < counter) && ((uint32)(counter - compare) < ticks) )
+				{
+					ticks = (uint32)(counter - compare);
+				}
+			}
+		}
+		return ticks;
+	}
+
+	if(counter > top)
+	{
+		top = max; /* TOP lowered below the counter, it rolls over at MAX */
+	}
+
+	ticks = (uint32)(top - counter) + 1;
+	for(channel = 0; channel < g_timers[timer].numberOfCompares; channel++)
+	{
+		compare = HostHal_timerCompare(timer, channel);
+		if( (compare > counter) && (compare <= top) && ((uint32)(compare - counter) < ticks) )
+		{
+			ticks = (uint32)(compare - counter);
+		}
+	}
+
+	return ticks;
+}
+
+static uint32 HostHal_timerCyclesToEvent(uint8 timer)
+{
+	uint16 prescaler = g_timers[timer].prescalers[g_hostHal_registers[g_timers[timer].clockAddress] & 0X07];
+
+	if(prescaler == 0)
+	{
+		return HOST_HAL_NO_EVENT;
+	}
+
+	return (HostHal_timerTicksToEvent(timer) - 1) * prescaler + (prescaler - g_timerStates[timer].prescalerCount);
+}
+
+/*
+ * Description: one tick reaching a flag
+ */
+static void HostHal_timerTick(uint8 timer)
+{
+	const HostHal_TimerConfigType *config_Ptr = &g_timers[timer];
+	HostHal_TimerStateType *state_Ptr = &g_timerStates[timer];
+	uint16 top;
+	uint16 max;
+	uint8 kind = HostHal_timerMode(timer, &top, &max);
+	uint16 counter = HostHal_timerCounter(timer);
+	uint8 channel;
+
+	if(kind == HOST_TIMER_PHASE_CORRECT)
+	{
+		if(state_Ptr->countingDown && (counter > 0))
+		{
+			counter--;
+			if(counter == 0)
+			{
+				state_Ptr->countingDown = FALSE;
+				HostHal_setFlag(TIFR_ADDRESS, config_Ptr->overflowFlag);
+			}
+		}
+		else if(counter < top)
+		{
+			counter++;
+			state_Ptr->countingDown = (counter >= top);
+		}
+		else
+		{
+			/* TOP lowered under the counter, turn back */
+			counter--;
+			state_Ptr->countingDown = TRUE;
+		}
+	}
+	else
+	{
+		if(counter > top)
+		{
+			top = max;
+		}
+		if(counter >= top)
+		{
+			counter = 0;
+			if( (kind != HOST_TIMER_CTC) || (top == max) )
+			{
+				HostHal_setFlag(TIFR_ADDRESS, config_Ptr->overflowFlag);
+			}
+		}
+		else
+		{
+			counter++;
+		}
+	}
+
+	HostHal_timerSetCounter(timer, counter);
+
+	for(channel = 0; channel < config_Ptr->numberOfCompares; channel++)
+	{
+		if(counter == HostHal_timerCompare(timer, channel))
+		{
+			HostHal_setFlag(TIFR_ADDRESS, config_Ptr->compareFlag[channel]);
+		}
+	}
+}
+
+/*
+ * Description: cycles of a timer known to reach no flag, the counter moves at
+ *              once without looking for the next event again
+ */
+static void HostHal_timerCount(uint8 timer, uint32 cycles)
+{
+	HostHal_TimerStateType *state_Ptr = &g_timerStates[timer];
+	uint16 prescaler = g_timers[timer].prescalers[g_hostHal_registers[g_timers[timer].clockAddress] & 0X07];
+	uint32 ticks;
+	uint16 top;
+	uint16 max;
+
+	if(prescaler == 0)
+	{
+		return;
+	}
+
+	state_Ptr->prescalerCount += cycles;
+	ticks = state_Ptr->prescalerCount / prescaler;
+	state_Ptr->prescalerCount %= prescaler;
+
+	if(ticks == 0)
+	{
+		return;
+	}
+
+	if( state_Ptr->countingDown && (HostHal_timerMode(timer, &top, &max) == HOST_TIMER_PHASE_CORRECT) )
+	{
+		HostHal_timerSetCounter(timer, HostHal_timerCounter(timer) - (uint16)ticks);
+	}
+	else
+	{
+		HostHal_timerSetCounter(timer, HostHal_timerCounter(timer) + (uint16)ticks);
+	}
+}
+
+static void HostHal_timerAdvance(uint8 timer, uint32 cycles)
+{
+	HostHal_TimerStateType *state_Ptr = &g_timerStates[timer];
+	uint16 prescaler = g_timers[timer].prescalers[g_hostHal_registers[g_timers[timer].clockAddress] & 0X07];
+	uint32 ticks;
+	uint32 toEvent;
+	uint16 top;
+	uint16 max;
+
+	if(prescaler == 0)
+	{
+		return;
+	}
+
+	state_Ptr->prescalerCount += cycles;
+	ticks = state_Ptr->prescalerCount / prescaler;
+	state_Ptr->prescalerCount %= prescaler;
+
+	while(ticks > 0)
+	{
+		toEvent = HostHal_timerTicksToEvent(timer);
+		if(ticks < toEvent)
+		{
+			/* no flag on the way, move the counter at once */
+			if( (HostHal_timerMode(timer, &top, &max) == HOST_TIMER_PHASE_CORRECT) && state_Ptr->countingDown )
+			{
+				HostHal_timerSetCounter(timer, HostHal_timerCounter(timer) - (uint16)ticks);
+			}
+			else
+			{
+				HostHal_timerSetCounter(timer, HostHal_timerCounter(timer) + (uint16)ticks);
+			}
+			break;
+		}
+
+		if(toEvent > 1)
+		{
+			if( (HostHal_timerMode(timer, &top, &max) == HOST_TIMER_PHASE_CORRECT) && state_Ptr->countingDown )
+			{
+				HostHal_timerSetCounter(timer, HostHal_timerCounter(timer) - (uint16)(toEvent - 1));
+			}
+			else
+			{
+				HostHal_timerSetCounter(timer, HostHal_timerCounter(timer) + (uint16)(toEvent - 1));
+			}
+		}
+		HostHal_timerTick(timer);
+		ticks -= toEvent;
+	}
+}
+
+/*
+ * Description: run the highest priority pending vector while the I-bit is set
+ *              The I-bit is cleared during the vector like the hardware does,
+ *              so a vector enabling the interrupts can be interrupted
+ */
+static void HostHal_dispatch(void)
+{
+	uint8 i;
+	uint8 dispatched = 0;
+	const HostHal_VectorType *vector_Ptr;
+
+	while( BIT_IS_SET(g_hostHal_registers[SREG_ADDRESS], SREG_I) && (dispatched < HOST_HAL_MAX_NESTED_DISPATCH) )
+	{
+		vector_Ptr = NULL_PTR;
+		for(i = 0; i < HOST_HAL_NUMBER_OF_VECTORS; i++)
+		{
+			/* EE_RDY has no flag, it is the level of EEWE cleared */
+			if( (g_hostHal_registers[g_vectors[i].enableAddress] & g_vectors[i].enableMask) &&
+					( (g_vectors[i].vector == EE_RDY_vect) ?
+							BIT_IS_CLEAR(g_hostHal_registers[EECR_ADDRESS], EEWE) :
+							(g_hostHal_registers[g_vectors[i].flagAddress] & g_vectors[i].flagMask) ) )
+			{
+				vector_Ptr = &g_vectors[i];
+				break;
+			}
+		}
+		if(vector_Ptr == NULL_PTR)
+		{
+			return;
+		}
+
+		/* The flags of the vectors with a flag are cleared by the hardware */
+		if( (vector_Ptr->flagAddress == TIFR_ADDRESS) || (vector_Ptr->flagAddress == GIFR_ADDRESS) ||
+				(vector_Ptr->flagMask == (1<<ADIF)) || (vector_Ptr->flagMask == (1<<ACI)) ||
+				(vector_Ptr->flagMask == (1<<TXC)) )
+		{
+			HostHal_set8(vector_Ptr->flagAddress, g_hostHal_registers[vector_Ptr->flagAddress] & ~vector_Ptr->flagMask);
+		}
+
+		HostHal_set8(SREG_ADDRESS, g_hostHal_registers[SREG_ADDRESS] & ~(1<<SREG_I));
+		if(g_sleeping && (g_vectorDepth == 0))
+		{
+			g_wakeCycles = g_cycles;
+		}
+		g_vectorDepth++;
+		vector_Ptr->vector();
+		g_vectorDepth--;
+		HostHal_commit();
+		HostHal_set8(SREG_ADDRESS, g_hostHal_registers[SREG_ADDRESS] | (1<<SREG_I)); /* reti */
+		dispatched++;
+
+		/*
+		 * the vector has run, the CPU is back after the sleep instruction
+		 * A vector nested in the one waking the CPU doesn't end its delays
+		 */
+		if(g_sleeping && (g_vectorDepth == 0))
+		{
+			g_sleeping = FALSE;
+			g_woken = TRUE;
+		}
+	}
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: HostHal_reset
+ *
+ * [Description]:  Function to reset the simulated microcontroller
+ *                 - Registers to their reset values
+ *                 - Time to zero, timers and ADC idle
+ *                 - Inputs pulled HIGH, ADC inputs to zero, LCD blank
+ *                 - EEPROM kept, erased at the first reset only
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void HostHal_reset(void)
+{
+	uint8 i;
+
+	for(i = 0; i < HOST_HAL_REGISTERS_SIZE; i++)
+	{
+		HostHal_set8(i, 0);
+	}
+	HostHal_set16(SPL_ADDRESS, RAMEND);
+	HostHal_set8(UCSRA_ADDRESS, (1<<UDRE));
+	HostHal_set8(UCSRC_ADDRESS, (1<<URSEL) | (1<<UCSZ1) | (1<<UCSZ0));
+
+	for(i = 0; i < 4; i++)
+	{
+		g_inputs[i] = 0XFF;
+	}
+	for(i = 0; i < 8; i++)
+	{
+		g_adcInputs[i] = 0;
+	}
+	for(i = 0; i < HOST_HAL_NUMBER_OF_TIMERS; i++)
+	{
+		g_timerStates[i].prescalerCount = 0;
+		g_timerStates[i].countingDown = FALSE;
+	}
+	for(i = 0; i < HOST_HAL_LCD_DDRAM_SIZE; i++)
+	{
+		g_lcdDdram[i] = ' ';
+	}
+
+	g_uartShifting = FALSE;
+	g_uartBufferFull = FALSE;
+	g_uartReceived = 0;
+	g_udrAccessed = FALSE;
+	g_uartBaudHigh = 0;
+	g_uartControlC = (1<<URSEL) | (1<<UCSZ1) | (1<<UCSZ0);
+	g_uartLogHead = 0;
+	g_uartLogTail = 0;
+
+	if(!g_eepromErased)
+	{
+		memset(g_eeprom, 0XFF, HOST_HAL_EEPROM_SIZE);
+		g_eepromErased = TRUE;
+	}
+	g_eepromWriting = FALSE;
+
+	g_sleeping = FALSE;
+	g_woken = FALSE;
+	g_vectorDepth = 0;
+	g_wakeCycles = 0;
+	g_sleepCycles = 0;
+
+	g_lcdAddress = 0;
+	g_adcBusy = FALSE;
+	g_adcFirstConversion = TRUE;
+	g_adcSource = NULL_PTR;
+	g_hook = NULL_PTR;
+	g_cycles = 0;
+	g_initialized = TRUE;
+
+	g_interruptPins = 0;
+	HostHal_updatePins();
+	HostHal_set8(GIFR_ADDRESS, 0);
+
+}/*End of HostHal_reset*/
+
+/***************************************************************************************************
+ * [Function Name]: HostHal_access8
+ *
+ * [Description]:  Function behind every 8-bit register name
+ *                 - Process the writes since the last access
+ *                 - Advance the time of one access (may run interrupts)
+ *
+ * [Args]:         address
+ *
+ * [In]            address: -Data space address of the register
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Pointer to the register in the register file
+ ***************************************************************************************************/
+volatile uint8 * HostHal_access8(uint8 address)
+{
+	if(!g_initialized)
+	{
+		HostHal_reset();
+	}
+
+	HostHal_advance(HOST_HAL_CYCLES_PER_ACCESS);
+
+	if(address == UDR_ADDRESS)
+	{
+		g_udrAccessed = TRUE;
+		g_udrReadable = BIT_IS_SET(g_hostHal_registers[UCSRA_ADDRESS], RXC) ? TRUE : FALSE;
+	}
+
+	return &g_hostHal_registers[address];
+
+}/*End of HostHal_access8*/
+
+HostHal_Register16 * HostHal_access16(uint8 address)
+{
+	HostHal_access8(address);
+
+	return (HostHal_Register16 *)&g_hostHal_registers[address];
+}
+
+/***************************************************************************************************
+ * [Function Name]: HostHal_advance
+ *
+ * [Description]:  Function to advance the simulated time
+ *                 The time goes in steps ending at the next timer flag, ADC
+ *                 completion or periodic hook, so the interrupts run at the
+ *                 right cycle and the long delays cost a few steps only
+ *
+ * [Args]:         cycles
+ *
+ * [In]            cycles: -CPU cycles to advance
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void HostHal_advance(uint32 cycles)
+{
+	uint32 step;
+	uint32 toEvent[HOST_HAL_NUMBER_OF_TIMERS];
+	uint8 timer;
+
+	HostHal_commit();
+	HostHal_dispatch();
+
+	/* a sleep ends once a vector has run, the rest of the time is not slept */
+	while( (cycles > 0) && !g_woken )
+	{
+		step = cycles;
+		for(timer = 0; timer < HOST_HAL_NUMBER_OF_TIMERS; timer++)
+		{
+			toEvent[timer] = HostHal_timerCyclesToEvent(timer);
+			if(toEvent[timer] < step)
+			{
+				step = toEvent[timer];
+			}
+		}
+		if(g_adcBusy && (g_adcRemaining < step))
+		{
+			step = g_adcRemaining;
+		}
+		if(g_uartShifting && (g_uartRemaining < step))
+		{
+			step = g_uartRemaining;
+		}
+		if(g_eepromWriting && (g_eepromRemaining < step))
+		{
+			step = g_eepromRemaining;
+		}
+		if( (g_hook != NULL_PTR) && (g_hookRemaining < step) )
+		{
+			step = g_hookRemaining;
+		}
+
+		g_cycles += step;
+		cycles -= step;
+
+		for(timer = 0; timer < HOST_HAL_NUMBER_OF_TIMERS; timer++)
+		{
+			/* most steps end at the hook or the ADC, with no flag of this timer */
+			if(step < toEvent[timer])
+			{
+				HostHal_timerCount(timer, step);
+			}
+			else
+			{
+				HostHal_timerAdvance(timer, step);
+			}
+		}
+		if(g_adcBusy)
+		{
+			g_adcRemaining -= step;
+			if(g_adcRemaining == 0)
+			{
+				HostHal_adcComplete();
+			}
+		}
+		if(g_uartShifting)
+		{
+			g_uartRemaining -= step;
+			if(g_uartRemaining == 0)
+			{
+				HostHal_uartShiftComplete();
+			}
+		}
+		if(g_eepromWriting)
+		{
+			g_eepromRemaining -= step;
+			if(g_eepromRemaining == 0)
+			{
+				g_eepromWriting = FALSE;
+				HostHal_set8(EECR_ADDRESS, g_hostHal_registers[EECR_ADDRESS] & ~(1<<EEWE));
+			}
+		}
+		if(g_hook != NULL_PTR)
+		{
+			g_hookRemaining -= step;
+			if(g_hookRemaining == 0)
+			{
+				g_hookRemaining = g_hookPeriod;
+				/* the accesses of the vectors run by the model don't run it again */
+				if(!g_hookRunning)
+				{
+					g_hookRunning = TRUE;
+					g_hook();
+					g_hookRunning = FALSE;
+				}
+			}
+		}
+
+		HostHal_dispatch();
+	}
+
+}/*End of HostHal_advance*/
+
+uint64 HostHal_getCycles(void)
+{
+	return g_cycles;
+}
+
+/***************************************************************************************************
+ * [Function Name]: HostHal_sleep
+ *
+ * [Description]:  Function behind sleep_cpu
+ *                 - Nothing without SE, or with the interrupts disabled (no
+ *                   wake up, the end of the program under simavr)
+ *                 - ADC noise reduction starts a conversion of an enabled ADC
+ *                   with its interrupt, the timers keep running in the model
+ *                 - The time advances until a vector has run, the cycles
+ *                   asleep end at the entry of that vector
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void HostHal_sleep(void)
+{
+	uint64 start;
+	uint8 mode;
+
+	HostHal_commit();
+
+	if( BIT_IS_CLEAR(g_hostHal_registers[MCUCR_ADDRESS], SE) ||
+			BIT_IS_CLEAR(g_hostHal_registers[SREG_ADDRESS], SREG_I) )
+	{
+		return;
+	}
+
+	mode = g_hostHal_registers[MCUCR_ADDRESS] & ((1<<SM2) | (1<<SM1) | (1<<SM0));
+	if( (mode == SLEEP_MODE_ADC) && !g_adcBusy &&
+			BIT_IS_SET(g_hostHal_registers[ADCSRA_ADDRESS], ADEN) &&
+			BIT_IS_SET(g_hostHal_registers[ADCSRA_ADDRESS], ADIE) )
+	{
+		HostHal_set8(ADCSRA_ADDRESS, g_hostHal_registers[ADCSRA_ADDRESS] | (1<<ADSC));
+		HostHal_adcStart();
+	}
+
+	start = g_cycles;
+	g_sleeping = TRUE;
+	while(!g_woken)
+	{
+		HostHal_advance(HOST_HAL_SLEEP_STEP);
+	}
+	g_woken = FALSE;
+	g_sleepCycles += g_wakeCycles - start;
+
+}/*End of HostHal_sleep*/
+
+uint64 HostHal_getSleepCycles(void)
+{
+	return g_sleepCycles;
+}
+
+uint8 HostHal_peek8(uint8 address)
+{
+	HostHal_commit();
+	return g_hostHal_registers[address];
+}
+
+uint16 HostHal_peek16(uint8 address)
+{
+	HostHal_commit();
+	return HostHal_get16(address);
+}
+
+void HostHal_poke8(uint8 address, uint8 value)
+{
+	HostHal_commit();
+	HostHal_set8(address, value);
+}
+
+void HostHal_setInputPin(uint8 port, uint8 pin, uint8 level)
+{
+	HostHal_commit();
+
+	if(level)
+	{
+		SET_BIT(g_inputs[port & 0X03], pin);
+	}
+	else
+	{
+		CLEAR_BIT(g_inputs[port & 0X03], pin);
+	}
+
+	HostHal_updatePins();
+	HostHal_dispatch();
+}
+
+void HostHal_setAdcInput(uint8 channel, uint16 value)
+{
+	g_adcInputs[channel & 0X07] = value;
+}
+
+void HostHal_setAdcSource(HostHal_AdcSourceType source)
+{
+	g_adcSource = source;
+}
+
+/***************************************************************************************************
+ * [Function Name]: HostHal_getPwmDuty
+ *
+ * [Description]:  Function to get the average level of a compare output pin
+ *                 - Fast PWM: (OCR + 1) / (TOP + 1), OCR >= TOP always HIGH
+ *                 - Phase correct PWM: OCR / TOP
+ *                 - Inverting mode: the complement
+ *                 - Toggle mode: half of the time, set/clear modes: the level
+ *
+ * [Args]:         timer, channel
+ *
+ * [In]            timer:   -0, 1 or 2
+ *
+ *                 channel: -0 (OC0, OC1A, OC2) or 1 (OC1B)
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      HIGH time in Q16 or HOST_HAL_PWM_DISCONNECTED
+ ***************************************************************************************************/
+uint32 HostHal_getPwmDuty(uint8 timer, uint8 channel)
+{
+	uint16 top;
+	uint16 max;
+	uint8 kind;
+	uint8 com;
+	uint32 compare;
+	uint32 duty;
+
+	HostHal_commit();
+
+	kind = HostHal_timerMode(timer, &top, &max);
+	compare = HostHal_timerCompare(timer, channel);
+
+	if(timer == 1)
+	{
+		com = (g_hostHal_registers[TCCR1A_ADDRESS] >> ((channel == 0) ? COM1A0 : COM1B0)) & 0X03;
+	}
+	else
+	{
+		com = (g_hostHal_registers[g_timers[timer].clockAddress] >> COM00) & 0X03;
+	}
+
+	if(com == 0)
+	{
+		return HOST_HAL_PWM_DISCONNECTED;
+	}
+	if( (kind == HOST_TIMER_NORMAL) || (kind == HOST_TIMER_CTC) || (com == 1) )
+	{
+		return (com == 1) ? (HOST_HAL_PWM_FULL_SCALE / 2) : (com == 3) ? HOST_HAL_PWM_FULL_SCALE : 0;
+	}
+
+	if(compare >= top)
+	{
+		duty = HOST_HAL_PWM_FULL_SCALE;
+	}
+	else if(kind == HOST_TIMER_FAST_PWM)
+	{
+		duty = (uint32)(((uint64)(compare + 1) * HOST_HAL_PWM_FULL_SCALE) / ((uint32)top + 1));
+	}
+	else
+	{
+		duty = (uint32)(((uint64)compare * HOST_HAL_PWM_FULL_SCALE) / top);
+	}
+
+	return (com == 3) ? (HOST_HAL_PWM_FULL_SCALE - duty) : duty;
+
+}/*End of HostHal_getPwmDuty*/
+
+void HostHal_setPeriodicHook(HostHal_HookType hook, uint32 period_cycles)
+{
+	g_hook = (period_cycles != 0) ? hook : NULL_PTR;
+	g_hookPeriod = period_cycles;
+	g_hookRemaining = period_cycles;
+}
+
+void HostHal_captureTimer1(void)
+{
+	HostHal_commit();
+	HostHal_set16(ICR1L_ADDRESS, HostHal_get16(TCNT1L_ADDRESS));
+	HostHal_setFlag(TIFR_ADDRESS, (1<<ICF1));
+	HostHal_dispatch();
+}
+
+void HostHal_setComparatorOutput(uint8 level)
+{
+	uint8 acsr;
+	uint8 edge;
+
+	HostHal_commit();
+
+	acsr = g_hostHal_registers[ACSR_ADDRESS];
+	if( BIT_IS_SET(acsr, ACD) || ((level != 0) == (BIT_IS_SET(acsr, ACO) != 0)) )
+	{
+		return;
+	}
+
+	acsr ^= (1<<ACO);
+	/* ACIS1:0 = 00 toggle, 10 falling edge, 11 rising edge */
+	edge = acsr & ((1<<ACIS1) | (1<<ACIS0));
+	if( (edge == 0) || ((edge == (1<<ACIS1)) && (level == 0)) ||
+			((edge == ((1<<ACIS1) | (1<<ACIS0))) && (level != 0)) )
+	{
+		acsr |= (1<<ACI);
+	}
+	HostHal_set8(ACSR_ADDRESS, acsr);
+
+	/* ACIC: the output is the input capture of Timer1, ICES1 = 1 on its rising edge */
+	if( BIT_IS_SET(acsr, ACIC) &&
+			((level != 0) == (BIT_IS_SET(g_hostHal_registers[TCCR1B_ADDRESS], ICES1) != 0)) )
+	{
+		HostHal_set16(ICR1L_ADDRESS, HostHal_get16(TCNT1L_ADDRESS));
+		HostHal_setFlag(TIFR_ADDRESS, (1<<ICF1));
+	}
+
+	HostHal_dispatch();
+}
+
+uint8 HostHal_getComparatorInput(void)
+{
+	HostHal_commit();
+
+	if( BIT_IS_SET(g_hostHal_registers[SFIOR_ADDRESS], ACME) &&
+			BIT_IS_CLEAR(g_hostHal_registers[ADCSRA_ADDRESS], ADEN) )
+	{
+		return g_hostHal_registers[ADMUX_ADDRESS] & 0X07;
+	}
+
+	return HOST_HAL_COMPARATOR_AIN1;
+}
+
+bool HostHal_uartReceive(uint8 data)
+{
+	HostHal_commit();
+
+	if(BIT_IS_CLEAR(g_hostHal_registers[UCSRB_ADDRESS], RXEN))
+	{
+		return FALSE;
+	}
+	if(BIT_IS_SET(g_hostHal_registers[UCSRA_ADDRESS], RXC))
+	{
+		HostHal_setFlag(UCSRA_ADDRESS, (1<<DOR));
+		return FALSE;
+	}
+
+	g_uartReceived = data;
+	HostHal_set8(UDR_ADDRESS, data);
+	HostHal_setFlag(UCSRA_ADDRESS, (1<<RXC));
+	HostHal_dispatch();
+
+	return TRUE;
+}
+
+uint16 HostHal_getUartTransmitted(uint8 * Buffer_Ptr, uint16 size)
+{
+	uint16 count = 0;
+
+	HostHal_commit();
+
+	while( (count < size) && (g_uartLogTail != g_uartLogHead) )
+	{
+		Buffer_Ptr[count] = g_uartLog[g_uartLogTail];
+		g_uartLogTail = (g_uartLogTail + 1) % HOST_HAL_UART_LOG_SIZE;
+		count++;
+	}
+
+	return count;
+}
+
+uint8 * HostHal_getEeprom(void)
+{
+	if(!g_initialized)
+	{
+		HostHal_reset();
+	}
+
+	return g_eeprom;
+}
+
+void HostHal_getLcdRow(uint8 row, char * Str)
+{
+	static const uint8 rowAddress[4] = {0X00, 0X40, 0X14, 0X54};
+	uint8 i;
+
+	for(i = 0; i < HOST_HAL_LCD_COLUMNS; i++)
+	{
+		Str[i] = (char)g_lcdDdram[(rowAddress[row & 0X03] + i) & (HOST_HAL_LCD_DDRAM_SIZE - 1)];
+	}
+	Str[HOST_HAL_LCD_COLUMNS] = '\0';
+}
+
+char * itoa(int value, char * Str, int radix)
+{
+	char digits[34];
+	unsigned int magnitude = (value < 0 && radix == 10) ? (unsigned int)(-(long)value) : (unsigned int)value;
+	uint8 length = 0;
+	uint8 i = 0;
+
+	do
+	{
+		uint8 digit = magnitude % (unsigned int)radix;
+		digits[length++] = (char)((digit < 10) ? ('0' + digit) : ('a' + digit - 10));
+		magnitude /= (unsigned int)radix;
+	}while(magnitude != 0);
+
+	if(value < 0 && radix == 10)
+	{
+		Str[i++] = '-';
+	}
+	while(length > 0)
+	{
+		Str[i++] = digits[--length];
+	}
+	Str[i] = '\0';
+
+	return Str;
+}
+
+#endif /*HOST_SIMULATION*/
@@ -0,0 +1,602 @@
+/**********************************************************************************
+ * [FILE NAME]: hal_host.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Host backend of the hardware abstraction, included by
+ *                micro_config.h instead of the avr-libc headers when the
+ *                drivers are compiled natively with -DHOST_SIMULATION.
+ *                Every register name of the ATmega16 becomes an access to a
+ *                simulated register file through HostHal_access8/16 (the
+ *                ports are plain memory of the same file), every access
+ *                processes the side effects of the previous writes,
+ *                advances the simulated time and dispatches the interrupts:
+ *                - Timer0/1/2 tick from their clock select and wave mode
+ *                - ADC conversions complete after their real duration
+ *                - External interrupts detect the edges of the input pins
+ *                - LCD (HD44780) latches the data bus at the falling edge of E
+ *                - EEPROM writes take their real 8.5 ms, the content is kept
+ *                  by HostHal_reset like a real power cycle
+ *                The AVR build never includes this file, so costs nothing.
+ *
+ ***********************************************************************************/
+
+#ifndef HAL_HOST_H_
+#define HAL_HOST_H_
+
+#include <stdlib.h>
+#include "std_types.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Simulated CPU cycles spent by every register access*/
+#define HOST_HAL_CYCLES_PER_ACCESS               2
+
+/*Size of the register file, data space addresses 0x00 --> 0x5F*/
+#define HOST_HAL_REGISTERS_SIZE                  0X60
+
+/*LCD wiring, must match lcd.h*/
+#define HOST_HAL_LCD_CTRL_ADDRESS                PORTD_ADDRESS
+#define HOST_HAL_LCD_CTRL_DIRECTION_ADDRESS      DDRD_ADDRESS
+#define HOST_HAL_LCD_DATA_ADDRESS                PORTC_ADDRESS
+#define HOST_HAL_LCD_RS_PIN                      0
+#define HOST_HAL_LCD_E_PIN                       2
+#define HOST_HAL_LCD_DDRAM_SIZE                  0X80
+#define HOST_HAL_LCD_COLUMNS                     16
+
+/*HostHal_getPwmDuty of a compare output disconnected from its pin*/
+#define HOST_HAL_PWM_DISCONNECTED                0XFFFFFFFFUL
+#define HOST_HAL_PWM_FULL_SCALE                  0X10000UL
+
+/*HostHal_getComparatorInput of the AIN1 pin, not an ADC channel*/
+#define HOST_HAL_COMPARATOR_AIN1                 0XFF
+
+/*Bytes sent by the USART kept until HostHal_getUartTransmitted*/
+#define HOST_HAL_UART_LOG_SIZE                   4096
+
+/*EEPROM of the ATmega16 and duration of a byte write (8.5 ms)*/
+#define HOST_HAL_EEPROM_SIZE                     512
+#define HOST_HAL_EEPROM_WRITE_CYCLES             ((uint32)(F_CPU / 1000UL) * 17UL / 2UL)
+
+/*Data space addresses of the I/O registers*/
+#define TWBR_ADDRESS     0X20
+#define TWSR_ADDRESS     0X21
+#define TWAR_ADDRESS     0X22
+#define TWDR_ADDRESS     0X23
+#define ADCL_ADDRESS     0X24
+#define ADCH_ADDRESS     0X25
+#define ADCSRA_ADDRESS   0X26
+#define ADMUX_ADDRESS    0X27
+#define ACSR_ADDRESS     0X28
+#define UBRRL_ADDRESS    0X29
+#define UCSRB_ADDRESS    0X2A
+#define UCSRA_ADDRESS    0X2B
+#define UDR_ADDRESS      0X2C
+#define SPCR_ADDRESS     0X2D
+#define SPSR_ADDRESS     0X2E
+#define SPDR_ADDRESS     0X2F
+#define PIND_ADDRESS     0X30
+#define DDRD_ADDRESS     0X31
+#define PORTD_ADDRESS    0X32
+#define PINC_ADDRESS     0X33
+#define DDRC_ADDRESS     0X34
+#define PORTC_ADDRESS    0X35
+#define PINB_ADDRESS     0X36
+#define DDRB_ADDRESS     0X37
+#define PORTB_ADDRESS    0X38
+#define PINA_ADDRESS     0X39
+#define DDRA_ADDRESS     0X3A
+#define PORTA_ADDRESS    0X3B
+#define EECR_ADDRESS     0X3C
+#define EEDR_ADDRESS     0X3D
+#define EEARL_ADDRESS    0X3E
+#define EEARH_ADDRESS    0X3F
+#define UCSRC_ADDRESS    0X40
+#define WDTCR_ADDRESS    0X41
+#define ASSR_ADDRESS     0X42
+#define OCR2_ADDRESS     0X43
+#define TCNT2_ADDRESS    0X44
+#define TCCR2_ADDRESS    0X45
+#define ICR1L_ADDRESS    0X46
+#define ICR1H_ADDRESS    0X47
+#define OCR1BL_ADDRESS   0X48
+#define OCR1BH_ADDRESS   0X49
+#define OCR1AL_ADDRESS   0X4A
+#define OCR1AH_ADDRESS   0X4B
+#define TCNT1L_ADDRESS   0X4C
+#define TCNT1H_ADDRESS   0X4D
+#define TCCR1B_ADDRESS   0X4E
+#define TCCR1A_ADDRESS   0X4F
+#define SFIOR_ADDRESS    0X50
+#define OSCCAL_ADDRESS   0X51
+#define TCNT0_ADDRESS    0X52
+#define TCCR0_ADDRESS    0X53
+#define MCUCSR_ADDRESS   0X54
+#define MCUCR_ADDRESS    0X55
+#define TWCR_ADDRESS     0X56
+#define SPMCR_ADDRESS    0X57
+#define TIFR_ADDRESS     0X58
+#define TIMSK_ADDRESS    0X59
+#define GIFR_ADDRESS     0X5A
+#define GICR_ADDRESS     0X5B
+#define OCR0_ADDRESS     0X5C
+#define SPL_ADDRESS      0X5D
+#define SPH_ADDRESS      0X5E
+#define SREG_ADDRESS     0X5F
+
+/*
+ * Register names of <avr/io.h>
+ * The ports are plain memory of the register file so their addresses are
+ * constants for the tables of pins, their writes are found at the next
+ * access of another register and the PINx registers are kept up to date
+ */
+#define TWBR     (*HostHal_access8(TWBR_ADDRESS))
+#define TWSR     (*HostHal_access8(TWSR_ADDRESS))
+#define TWAR     (*HostHal_access8(TWAR_ADDRESS))
+#define TWDR     (*HostHal_access8(TWDR_ADDRESS))
+#define ADCL     (*HostHal_access8(ADCL_ADDRESS))
+#define ADCH     (*HostHal_access8(ADCH_ADDRESS))
+#define ADC      (*HostHal_access16(ADCL_ADDRESS))
+#define ADCW     ADC
+#define ADCSRA   (*HostHal_access8(ADCSRA_ADDRESS))
+#define ADCSR    ADCSRA
+#define ADMUX    (*HostHal_access8(ADMUX_ADDRESS))
+#define ACSR     (*HostHal_access8(ACSR_ADDRESS))
+#define UBRRL    (*HostHal_access8(UBRRL_ADDRESS))
+#define UCSRB    (*HostHal_access8(UCSRB_ADDRESS))
+#define UCSRA    (*HostHal_access8(UCSRA_ADDRESS))
+#define UDR      (*HostHal_access8(UDR_ADDRESS))
+#define SPCR     (*HostHal_access8(SPCR_ADDRESS))
+#define SPSR     (*HostHal_access8(SPSR_ADDRESS))
+#define SPDR     (*HostHal_access8(SPDR_ADDRESS))
+#define PIND     (g_hostHal_registers[PIND_ADDRESS])
+#define DDRD     (g_hostHal_registers[DDRD_ADDRESS])
+#define PORTD    (g_hostHal_registers[PORTD_ADDRESS])
+#define PINC     (g_hostHal_registers[PINC_ADDRESS])
+#define DDRC     (g_hostHal_registers[DDRC_ADDRESS])
+#define PORTC    (g_hostHal_registers[PORTC_ADDRESS])
+#define PINB     (g_hostHal_registers[PINB_ADDRESS])
+#define DDRB     (g_hostHal_registers[DDRB_ADDRESS])
+#define PORTB    (g_hostHal_registers[PORTB_ADDRESS])
+#define PINA     (g_hostHal_registers[PINA_ADDRESS])
+#define DDRA     (g_hostHal_registers[DDRA_ADDRESS])
+#define PORTA    (g_hostHal_registers[PORTA_ADDRESS])
+#define EECR     (*HostHal_access8(EECR_ADDRESS))
+#define EEDR     (*HostHal_access8(EEDR_ADDRESS))
+#define EEARL    (*HostHal_access8(EEARL_ADDRESS))
+#define EEARH    (*HostHal_access8(EEARH_ADDRESS))
+#define EEAR     (*HostHal_access16(EEARL_ADDRESS))
+#define UBRRH    (*HostHal_access8(UCSRC_ADDRESS))
+#define UCSRC    (*HostHal_access8(UCSRC_ADDRESS))
+#define WDTCR    (*HostHal_access8(WDTCR_ADDRESS))
+#define ASSR     (*HostHal_access8(ASSR_ADDRESS))
+#define OCR2     (*HostHal_access8(OCR2_ADDRESS))
+#define TCNT2    (*HostHal_access8(TCNT2_ADDRESS))
+#define TCCR2    (*HostHal_access8(TCCR2_ADDRESS))
+#define ICR1L    (*HostHal_access8(ICR1L_ADDRESS))
+#define ICR1H    (*HostHal_access8(ICR1H_ADDRESS))
+#define ICR1     (*HostHal_access16(ICR1L_ADDRESS))
+#define OCR1BL   (*HostHal_access8(OCR1BL_ADDRESS))
+#define OCR1BH   (*HostHal_access8(OCR1BH_ADDRESS))
+#define OCR1B    (*HostHal_access16(OCR1BL_ADDRESS))
+#define OCR1AL   (*HostHal_access8(OCR1AL_ADDRESS))
+#define OCR1AH   (*HostHal_access8(OCR1AH_ADDRESS))
+#define OCR1A    (*HostHal_access16(OCR1AL_ADDRESS))
+#define TCNT1L   (*HostHal_access8(TCNT1L_ADDRESS))
+#define TCNT1H   (*HostHal_access8(TCNT1H_ADDRESS))
+#define TCNT1    (*HostHal_access16(TCNT1L_ADDRESS))
+#define TCCR1B   (*HostHal_access8(TCCR1B_ADDRESS))
+#define TCCR1A   (*HostHal_access8(TCCR1A_ADDRESS))
+#define SFIOR    (*HostHal_access8(SFIOR_ADDRESS))
+#define OSCCAL   (*HostHal_access8(OSCCAL_ADDRESS))
+#define OCDR     OSCCAL
+#define TCNT0    (*HostHal_access8(TCNT0_ADDRESS))
+#define TCCR0    (*HostHal_access8(TCCR0_ADDRESS))
+#define MCUCSR   (*HostHal_access8(MCUCSR_ADDRESS))
+#define MCUCR    (*HostHal_access8(MCUCR_ADDRESS))
+#define TWCR     (*HostHal_access8(TWCR_ADDRESS))
+#define SPMCR    (*HostHal_access8(SPMCR_ADDRESS))
+#define TIFR     (*HostHal_access8(TIFR_ADDRESS))
+#define TIMSK    (*HostHal_access8(TIMSK_ADDRESS))
+#define GIFR     (*HostHal_access8(GIFR_ADDRESS))
+#define GICR     (*HostHal_access8(GICR_ADDRESS))
+#define OCR0     (*HostHal_access8(OCR0_ADDRESS))
+#define SPL      (*HostHal_access8(SPL_ADDRESS))
+#define SPH      (*HostHal_access8(SPH_ADDRESS))
+#define SP       (*HostHal_access16(SPL_ADDRESS))
+#define SREG     (*HostHal_access8(SREG_ADDRESS))
+
+#define RAMEND   0X45F
+#define E2END    0X1FF
+#define SREG_I   7
+
+/*Port pins*/
+#define PA0 0
+#define PA1 1
+#define PA2 2
+#define PA3 3
+#define PA4 4
+#define PA5 5
+#define PA6 6
+#define PA7 7
+#define PB0 0
+#define PB1 1
+#define PB2 2
+#define PB3 3
+#define PB4 4
+#define PB5 5
+#define PB6 6
+#define PB7 7
+#define PC0 0
+#define PC1 1
+#define PC2 2
+#define PC3 3
+#define PC4 4
+#define PC5 5
+#define PC6 6
+#define PC7 7
+#define PD0 0
+#define PD1 1
+#define PD2 2
+#define PD3 3
+#define PD4 4
+#define PD5 5
+#define PD6 6
+#define PD7 7
+
+/*TCCR0*/
+#define FOC0   7
+#define WGM00  6
+#define COM01  5
+#define COM00  4
+#define WGM01  3
+#define CS02   2
+#define CS01   1
+#define CS00   0
+
+/*TCCR2*/
+#define FOC2   7
+#define WGM20  6
+#define COM21  5
+#define COM20  4
+#define WGM21  3
+#define CS22   2
+#define CS21   1
+#define CS20   0
+
+/*TCCR1A*/
+#define COM1A1 7
+#define COM1A0 6
+#define COM1B1 5
+#define COM1B0 4
+#define FOC1A  3
+#define FOC1B  2
+#define WGM11  1
+#define WGM10  0
+
+/*TCCR1B*/
+#define ICNC1  7
+#define ICES1  6
+#define WGM13  4
+#define WGM12  3
+#define CS12   2
+#define CS11   1
+#define CS10   0
+
+/*TIMSK*/
+#define OCIE2  7
+#define TOIE2  6
+#define TICIE1 5
+#define OCIE1A 4
+#define OCIE1B 3
+#define TOIE1  2
+#define OCIE0  1
+#define TOIE0  0
+
+/*TIFR*/
+#define OCF2   7
+#define TOV2   6
+#define ICF1   5
+#define OCF1A  4
+#define OCF1B  3
+#define TOV1   2
+#define OCF0   1
+#define TOV0   0
+
+/*GICR / GIFR*/
+#define INT1   7
+#define INT0   6
+#define INT2   5
+#define IVSEL  1
+#define IVCE   0
+#define INTF1  7
+#define INTF0  6
+#define INTF2  5
+
+/*MCUCR / MCUCSR*/
+#define SM2    7
+#define SE     6
+#define SM1    5
+#define SM0    4
+#define ISC11  3
+#define ISC10  2
+#define ISC01  1
+#define ISC00  0
+#define JTD    7
+#define ISC2   6
+#define JTRF   4
+#define WDRF   3
+#define BORF   2
+#define EXTRF  1
+#define PORF   0
+
+/*ADMUX / ADCSRA*/
+#define REFS1  7
+#define REFS0  6
+#define ADLAR  5
+#define MUX4   4
+#define MUX3   3
+#define MUX2   2
+#define MUX1   1
+#define MUX0   0
+#define ADEN   7
+#define ADSC   6
+#define ADATE  5
+#define ADIF   4
+#define ADIE   3
+#define ADPS2  2
+#define ADPS1  1
+#define ADPS0  0
+
+/*ACSR / SFIOR*/
+#define ACD    7
+#define ACBG   6
+#define ACO    5
+#define ACI    4
+#define ACIE   3
+#define ACIC   2
+#define ACIS1  1
+#define ACIS0  0
+#define ADTS2  7
+#define ADTS1  6
+#define ADTS0  5
+#define ACME   3
+#define PUD    2
+#define PSR2   1
+#define PSR10  0
+
+/*USART*/
+#define RXC    7
+#define TXC    6
+#define UDRE   5
+#define FE     4
+#define DOR    3
+#define PE     2
+#define U2X    1
+#define MPCM   0
+#define RXCIE  7
+#define TXCIE  6
+#define UDRIE  5
+#define RXEN   4
+#define TXEN   3
+#define UCSZ2  2
+#define RXB8   1
+#define TXB8   0
+#define URSEL  7
+#define UMSEL  6
+#define UPM1   5
+#define UPM0   4
+#define USBS   3
+#define UCSZ1  2
+#define UCSZ0  1
+#define UCPOL  0
+
+/*EECR*/
+#define EERIE  3
+#define EEMWE  2
+#define EEWE   1
+#define EERE   0
+
+/*<avr/interrupt.h>*/
+#define ISR(vector, ...)        void vector(void) __VA_ARGS__
+#define ISR_ALIASOF(vector)     __attribute__((alias(#vector)))
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+#define sei()                   (SREG |= (1<<SREG_I))
+#define cli()                   (SREG &= ~(1<<SREG_I))
+
+/*<avr/sleep.h>, the CPU sleeps until a vector has run*/
+#define SLEEP_MODE_IDLE         0
+#define SLEEP_MODE_ADC          (1<<SM0)
+#define set_sleep_mode(mode)    (MCUCR = (MCUCR & ~((1<<SM2) | (1<<SM1) | (1<<SM0))) | (mode))
+#define sleep_enable()          (MCUCR |= (1<<SE))
+#define sleep_disable()         (MCUCR &= ~(1<<SE))
+#define sleep_cpu()             HostHal_sleep()
+
+/*<util/delay.h>, the delays advance the simulated time*/
+#define _delay_ms(ms)           HostHal_advance((uint32)((ms) * (F_CPU / 1000UL)))
+#define _delay_us(us)           HostHal_advance((uint32)((us) * (F_CPU / 1000000UL)))
+
+/*<avr/pgmspace.h>, the flash is the host memory*/
+#define PROGMEM
+#define PSTR(s)                 (s)
+#define pgm_read_byte(address)  (*(const uint8 *)(address))
+#define pgm_read_word(address)  (*(const uint16 *)(address))
+#define pgm_read_dword(address) (*(const uint32 *)(address))
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*16-bit registers are two bytes of the register file*/
+typedef volatile uint16 __attribute__((may_alias)) HostHal_Register16;
+
+/*Value of an ADC channel when its conversion completes*/
+typedef uint16 (*HostHal_AdcSourceType)(uint8 channel);
+
+/*Models running beside the microcontroller (plants), called every period*/
+typedef void (*HostHal_HookType)(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+extern volatile uint8 g_hostHal_registers[HOST_HAL_REGISTERS_SIZE];
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function behind every 8-bit register name
+ */
+volatile uint8 * HostHal_access8(uint8 address);
+
+/*
+ * Description: Function behind every 16-bit register name
+ */
+HostHal_Register16 * HostHal_access16(uint8 address);
+
+/*
+ * Description: Function to reset the registers, the time and the peripherals
+ */
+void HostHal_reset(void);
+
+/*
+ * Description: Function to advance the simulated time, the timers tick, the
+ *              conversions complete and the pending interrupts are dispatched
+ */
+void HostHal_advance(uint32 cycles);
+
+/*
+ * Description: Function to get the simulated cycles since the reset
+ */
+uint64 HostHal_getCycles(void);
+
+/*
+ * Description: Function behind sleep_cpu, advances the time until a vector has
+ *              run (nothing if SE or the I-bit is clear)
+ */
+void HostHal_sleep(void);
+
+/*
+ * Description: Function to get the simulated cycles spent asleep since the reset,
+ *              each sleep up to the entry of the vector waking the CPU
+ */
+uint64 HostHal_getSleepCycles(void);
+
+/*
+ * Description: Functions to read/write a register without any side effect
+ */
+uint8 HostHal_peek8(uint8 address);
+uint16 HostHal_peek16(uint8 address);
+void HostHal_poke8(uint8 address, uint8 value);
+
+/*
+ * Description: Function to drive an input pin from outside, port 0:3 = A:D,
+ *              the edges on INT0/INT1/INT2 set their interrupt flags
+ */
+void HostHal_setInputPin(uint8 port, uint8 pin, uint8 level);
+
+/*
+ * Description: Function to set the analog value (0:1023) of an ADC channel
+ */
+void HostHal_setAdcInput(uint8 channel, uint16 value);
+
+/*
+ * Description: Function to take the ADC values from a model instead
+ */
+void HostHal_setAdcSource(HostHal_AdcSourceType source);
+
+/*
+ * Description: Function to call a model every period_cycles of simulated time,
+ *              NULL_PTR removes it
+ */
+void HostHal_setPeriodicHook(HostHal_HookType hook, uint32 period_cycles);
+
+/*
+ * Description: Function to get the HIGH time of a compare output pin in Q16
+ *              (65536 = always HIGH), timer 0:2 and channel 0:1 (A/B of Timer1)
+ *              Returns HOST_HAL_PWM_DISCONNECTED if the pin is a port pin
+ */
+uint32 HostHal_getPwmDuty(uint8 timer, uint8 channel);
+
+/*
+ * Description: Function to latch TCNT1 in ICR1 as an input capture edge
+ */
+void HostHal_captureTimer1(void);
+
+/*
+ * Description: Function to drive the output of the analog comparator (ACO)
+ *              from a model, its edges set ACI as selected by ACIS1:0
+ *              and capture Timer1 with ACIC as selected by ICES1
+ *              Ignored while the comparator is off (ACD)
+ */
+void HostHal_setComparatorOutput(uint8 level);
+
+/*
+ * Description: Function to get the negative input of the comparator: the
+ *              channel of the ADC multiplexer (ACME set, ADC off) or
+ *              HOST_HAL_COMPARATOR_AIN1
+ */
+uint8 HostHal_getComparatorInput(void);
+
+/*
+ * Description: Function to receive a byte on RXD, at once (the caller sets the pace)
+ *              Returns FALSE if the receiver is off or the byte overruns UDR
+ */
+bool HostHal_uartReceive(uint8 data);
+
+/*
+ * Description: Function to take the bytes sent on TXD since the last call
+ *              Returns the number of bytes copied
+ */
+uint16 HostHal_getUartTransmitted(uint8 * Buffer_Ptr, uint16 size);
+
+/*
+ * Description: Function to get the EEPROM content, erased (0XFF) at start,
+ *              for the tests to read, corrupt or erase it
+ */
+uint8 * HostHal_getEeprom(void);
+
+/*
+ * Description: Function to copy one row of the LCD as a null terminated string
+ */
+void HostHal_getLcdRow(uint8 row, char * Str);
+
+/*
+ * Description: avr-libc itoa, not in the host C library
+ */
+char * itoa(int value, char * Str, int radix);
+
+/*
+ * Interrupt vectors, the drivers define them with ISR() and the missing
+ * ones are weak empty functions of hal_host.c
+ */
+void INT0_vect(void);
+void INT1_vect(void);
+void TIMER2_COMP_vect(void);
+void TIMER2_OVF_vect(void);
+void TIMER1_CAPT_vect(void);
+void TIMER1_COMPA_vect(void);
+void TIMER1_COMPB_vect(void);
+void TIMER1_OVF_vect(void);
+void TIMER0_OVF_vect(void);
+void SPI_STC_vect(void);
+void USART_RXC_vect(void);
+void USART_UDRE_vect(void);
+void USART_TXC_vect(void);
+void ADC_vect(void);
+void EE_RDY_vect(void);
+void ANA_COMP_vect(void);
+void TWI_vect(void);
+void INT2_vect(void);
+void TIMER0_COMP_vect(void);
+void SPM_RDY_vect(void);
+
+#endif /* HAL_HOST_H_ */
@@ -0,0 +1,77 @@
+/**********************************************************************************
+ * [FILE NAME]: isr_bindings.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Handlers of the timer and external interrupt vectors bound
+ *                at build time. A vector with a handler here calls it
+ *                directly: no pointer in RAM, no NULL check, no indirect
+ *                call, and with -flto the handler is inlined in the vector.
+ *                The vectors without a handler here keep the slot set at run
+ *                time by Timer_setCallBack/Interrupt_setCallBack, the calls
+ *                of these functions for a bound vector are ignored.
+ *
+ ***********************************************************************************/
+
+#ifndef ISR_BINDINGS_H_
+#define ISR_BINDINGS_H_
+
+#include "bldc_motor.h"
+#include "external_interrupts.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define ENABLE                                   TRUE
+#define DISABLE                                  FALSE
+
+#define ISR_STATIC_BINDING                       ENABLE
+
+/*
+ * Handlers of the motor controller (main.c), the benchmark firmware and the
+ * host builds (tests and tools linking some of the drivers) bind their own
+ * at run time. Timer1 stays at run time: the profiler and the benchmark
+ * share its overflow, except for the steps of the BLDC driver.
+ * In the encoder mode INT1 is channel B of the encoder, its vector decodes
+ * it and has no handler.
+ */
+#if (ISR_STATIC_BINDING != DISABLE) && !defined(BENCHMARK) && !defined(HOST_SIMULATION)
+
+#define TIMER2_ISR_HANDLER                       App_tick
+#if (EXTERNAL_INTERRUPT_ENCODER_MODE == DISABLE)
+#define INTERRUPT1_ISR_HANDLER                   Debounce_wakeCallback
+#endif
+
+#if (BLDC_MOTOR != DISABLE)
+#define TIMER1_ISR_HANDLER                       Bldc_timerEvent
+#endif
+
+#endif
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+#ifdef TIMER0_ISR_HANDLER
+void TIMER0_ISR_HANDLER(void);
+#endif
+#ifdef TIMER1_ISR_HANDLER
+void TIMER1_ISR_HANDLER(void);
+#endif
+#ifdef TIMER2_ISR_HANDLER
+void TIMER2_ISR_HANDLER(void);
+#endif
+#ifdef INTERRUPT0_ISR_HANDLER
+void INTERRUPT0_ISR_HANDLER(void);
+#endif
+#ifdef INTERRUPT1_ISR_HANDLER
+void INTERRUPT1_ISR_HANDLER(void);
+#endif
+#ifdef INTERRUPT2_ISR_HANDLER
+void INTERRUPT2_ISR_HANDLER(void);
+#endif
+
+#endif /* ISR_BINDINGS_H_ */
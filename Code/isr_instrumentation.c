@@ -0,0 +1,182 @@
+/**********************************************************************************
+ * [FILE NAME]: isr_instrumentation.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the instrumentation of the interrupt service
+ *                routines, empty when ISR_INSTRUMENTATION is disabled.
+ *
+ ***********************************************************************************/
+
+#include"isr_instrumentation.h"
+
+#if (ISR_INSTRUMENTATION != DISABLE)
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static IsrInstr_StatsType g_isrStats[ISR_ID_COUNT];
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: IsrInstr_init
+ *
+ * [Description]:  Function to initialize the instrumentation
+ *                 - Timer1 free running at F_CPU gives the time stamps
+ *                 - Debug pin configured as output LOW
+ *                 - Table cleared
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void IsrInstr_init(void)
+{
+	Timer_startCycleCounter();
+
+#if (ISR_INSTRUMENTATION_DEBUG_PIN != DISABLE)
+	CLEAR_BIT(ISR_INSTRUMENTATION_DEBUG_DATA_PORT, ISR_INSTRUMENTATION_DEBUG_PIN_NUMBER);
+	SET_BIT(ISR_INSTRUMENTATION_DEBUG_DIRECTION_PORT, ISR_INSTRUMENTATION_DEBUG_PIN_NUMBER);
+#endif
+
+	IsrInstr_reset();
+
+}/*End of IsrInstr_init*/
+
+void IsrInstr_reset(void)
+{
+	uint8 id;
+	uint8 sreg = SREG;
+
+	cli();
+	for(id = 0; id < ISR_ID_COUNT; id++)
+	{
+		g_isrStats[id].count = 0;
+		g_isrStats[id].min = 0XFFFF;
+		g_isrStats[id].max = 0;
+		g_isrStats[id].total = 0;
+		g_isrStats[id].latency_min = 0XFFFF;
+		g_isrStats[id].latency_max = 0;
+		g_isrStats[id].latency_count = 0;
+		g_isrStats[id].latency_total = 0;
+	}
+	SREG = sreg;
+}
+
+/***************************************************************************************************
+ * [Function Name]: IsrInstr_record
+ *
+ * [Description]:  Function called by ISR_INSTR_EXIT to update the table
+ *                 Called with interrupts disabled (ISR) or from ADC_readChannel,
+ *                 the update of the ADC wait is protected here
+ *                 A count reaching 0xFFFF is halved with its sum, 0xFFFF runs
+ *                 of 0xFFFF cycles at most fit the 32-bit sum
+ *
+ * [Args]:         id, duration, latency
+ *
+ * [In]            id:       -IsrInstr_ID of the vector
+ *
+ *                 duration: -Cycles between the entry and the exit
+ *
+ *                 latency:  -Cycles between the event and the entry or ISR_INSTR_NO_LATENCY
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void IsrInstr_record(uint8 id, uint16 duration, uint16 latency)
+{
+	IsrInstr_StatsType *stats_Ptr = &g_isrStats[id];
+	uint8 sreg = SREG;
+
+	cli();
+
+	if(stats_Ptr->count == 0XFFFF)
+	{
+		stats_Ptr->count >>= 1;
+		stats_Ptr->total >>= 1;
+	}
+	stats_Ptr->count++;
+	stats_Ptr->total += duration;
+
+	if(duration < stats_Ptr->min)
+	{
+		stats_Ptr->min = duration;
+	}
+	if(duration > stats_Ptr->max)
+	{
+		stats_Ptr->max = duration;
+	}
+
+	if(latency != ISR_INSTR_NO_LATENCY)
+	{
+		if(stats_Ptr->latency_count == 0XFFFF)
+		{
+			stats_Ptr->latency_count >>= 1;
+			stats_Ptr->latency_total >>= 1;
+		}
+		stats_Ptr->latency_count++;
+		stats_Ptr->latency_total += latency;
+
+		if(latency < stats_Ptr->latency_min)
+		{
+			stats_Ptr->latency_min = latency;
+		}
+		if(latency > stats_Ptr->latency_max)
+		{
+			stats_Ptr->latency_max = latency;
+		}
+	}
+
+	SREG = sreg;
+
+}/*End of IsrInstr_record*/
+
+void IsrInstr_getStats(uint8 id, IsrInstr_StatsType * Stats_Ptr)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	*Stats_Ptr = g_isrStats[id];
+	SREG = sreg;
+}
+
+uint16 IsrInstr_getAverage(uint8 id)
+{
+	IsrInstr_StatsType stats;
+
+	IsrInstr_getStats(id, &stats);
+
+	if(stats.count == 0)
+	{
+		return 0;
+	}
+
+	return (uint16)(stats.total / stats.count);
+}
+
+uint16 IsrInstr_getLatencyAverage(uint8 id)
+{
+	IsrInstr_StatsType stats;
+
+	IsrInstr_getStats(id, &stats);
+
+	if(stats.latency_count == 0)
+	{
+		return ISR_INSTR_NO_LATENCY;
+	}
+
+	return (uint16)(stats.latency_total / stats.latency_count);
+}
+
+#endif /*ISR_INSTRUMENTATION*/
@@ -0,0 +1,167 @@
+/**********************************************************************************
+ * [FILE NAME]: isr_instrumentation.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of the instrumentation of the interrupt service routines.
+ *                Every instrumented vector is time stamped at its entry and
+ *                exit with Timer1 running as cycle counter, min/max/average
+ *                duration and latency are kept per vector in a RAM table.
+ *                With ISR_INSTRUMENTATION disabled all the macros are empty
+ *                so the ISRs are exactly the same as without instrumentation.
+ *
+ ***********************************************************************************/
+
+#ifndef ISR_INSTRUMENTATION_H_
+#define ISR_INSTRUMENTATION_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "timers.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define ENABLE                                   TRUE
+#define DISABLE                                  FALSE
+
+#define ISR_INSTRUMENTATION                      DISABLE
+
+/*Pin HIGH while an instrumented vector runs, for the scope*/
+#define ISR_INSTRUMENTATION_DEBUG_PIN            DISABLE
+#define ISR_INSTRUMENTATION_DEBUG_DIRECTION_PORT DDRB
+#define ISR_INSTRUMENTATION_DEBUG_DATA_PORT      PORTB
+#define ISR_INSTRUMENTATION_DEBUG_PIN_NUMBER     PB4
+
+/*Prescalers of the timers to convert their counters to cycles of latency*/
+#define ISR_INSTRUMENTATION_TIMER0_PRESCALER     8
+#define ISR_INSTRUMENTATION_TIMER2_PRESCALER     128
+
+/*The latency of the vector can't be measured (external edge)*/
+#define ISR_INSTR_NO_LATENCY                     0XFFFF
+
+/*
+ * Cycles since the event of the timer vectors, the counters restart from
+ * BOTTOM at the overflow (and at the compare match in CTC mode)
+ */
+#define ISR_INSTR_TIMER0_OVF_LATENCY()   ((uint16)TIMER0_INITIAL_VALUE_REGISTER * ISR_INSTRUMENTATION_TIMER0_PRESCALER)
+#define ISR_INSTR_TIMER0_COMP_LATENCY()  ((uint16)(uint8)(TIMER0_INITIAL_VALUE_REGISTER - TIMER0_OUTPUT_COMPARE_REGISTER) * ISR_INSTRUMENTATION_TIMER0_PRESCALER)
+#define ISR_INSTR_TIMER1_OVF_LATENCY()   ((uint16)TIMER1_INITIAL_VALUE_REGISTER)
+#define ISR_INSTR_TIMER1_COMPA_LATENCY() ((uint16)(TIMER1_INITIAL_VALUE_REGISTER - TIMER1_OUTPUT_COMPARE_REGISTER_A))
+#define ISR_INSTR_TIMER1_COMPB_LATENCY() ((uint16)(TIMER1_INITIAL_VALUE_REGISTER - TIMER1_OUTPUT_COMPARE_REGISTER_B))
+#define ISR_INSTR_TIMER2_OVF_LATENCY()   ((uint16)TIMER2_INITIAL_VALUE_REGISTER * ISR_INSTRUMENTATION_TIMER2_PRESCALER)
+#define ISR_INSTR_TIMER2_COMP_LATENCY()  ((uint16)TIMER2_INITIAL_VALUE_REGISTER * ISR_INSTRUMENTATION_TIMER2_PRESCALER)
+
+#if (ISR_INSTRUMENTATION != DISABLE)
+
+#if (ISR_INSTRUMENTATION_DEBUG_PIN != DISABLE)
+#define ISR_INSTR_PIN_HIGH()   SET_BIT(ISR_INSTRUMENTATION_DEBUG_DATA_PORT, ISR_INSTRUMENTATION_DEBUG_PIN_NUMBER)
+#define ISR_INSTR_PIN_LOW()    CLEAR_BIT(ISR_INSTRUMENTATION_DEBUG_DATA_PORT, ISR_INSTRUMENTATION_DEBUG_PIN_NUMBER)
+#else
+#define ISR_INSTR_PIN_HIGH()
+#define ISR_INSTR_PIN_LOW()
+#endif
+
+/*First statement of the instrumented vector*/
+#define ISR_INSTR_ENTRY_LATENCY(id, latency) \
+	uint16 isr_instr_entry = TIMER_CYCLE_COUNTER_REGISTER; \
+	uint16 isr_instr_latency = (latency); \
+	ISR_INSTR_PIN_HIGH()
+
+#define ISR_INSTR_ENTRY(id)   ISR_INSTR_ENTRY_LATENCY(id, ISR_INSTR_NO_LATENCY)
+
+/*Last statement of the instrumented vector*/
+#define ISR_INSTR_EXIT(id) \
+	do { \
+		ISR_INSTR_PIN_LOW(); \
+		IsrInstr_record((id), (uint16)(TIMER_CYCLE_COUNTER_REGISTER - isr_instr_entry), isr_instr_latency); \
+	} while(0)
+
+#else
+
+#define ISR_INSTR_ENTRY_LATENCY(id, latency)
+#define ISR_INSTR_ENTRY(id)
+#define ISR_INSTR_EXIT(id)
+
+#endif /*ISR_INSTRUMENTATION*/
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	ISR_ID_INT0, ISR_ID_INT1, ISR_ID_INT2,
+	ISR_ID_TIMER0_OVF, ISR_ID_TIMER0_COMP,
+	ISR_ID_TIMER1_OVF, ISR_ID_TIMER1_COMPA, ISR_ID_TIMER1_COMPB,
+	ISR_ID_TIMER2_OVF, ISR_ID_TIMER2_COMP,
+	ISR_ID_ADC, ISR_ID_ANA_COMP,
+	ISR_ID_USART_RXC, ISR_ID_USART_UDRE,
+	ISR_ID_EE_RDY,
+	ISR_ID_ADC_WAIT,
+	ISR_ID_COUNT
+
+}IsrInstr_ID;
+
+/*
+ * count and total are halved together when count reaches 0xFFFF, so is the
+ * pair of the latency: the averages keep following the recent runs
+ */
+typedef struct
+{
+	uint16 count;          /* number of recorded runs, halved at 0xFFFF */
+	uint16 min;            /* cycles */
+	uint16 max;
+	uint32 total;          /* sum of the durations of the counted runs */
+	uint16 latency_min;    /* cycles between the event and the entry */
+	uint16 latency_max;
+	uint16 latency_count;  /* runs with a measured latency, halved at 0xFFFF */
+	uint32 latency_total;  /* sum of their latencies */
+
+}IsrInstr_StatsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+#if (ISR_INSTRUMENTATION != DISABLE)
+
+/*
+ * Description: Function to start Timer1 as cycle counter, configure the debug
+ *              pin and clear the table
+ */
+void IsrInstr_init(void);
+
+/*
+ * Description: Function to clear the table
+ */
+void IsrInstr_reset(void);
+
+/*
+ * Description: Function called by ISR_INSTR_EXIT to update the table
+ */
+void IsrInstr_record(uint8 id, uint16 duration, uint16 latency);
+
+/*
+ * Description: Function to copy the statistics of one vector
+ */
+void IsrInstr_getStats(uint8 id, IsrInstr_StatsType * Stats_Ptr);
+
+/*
+ * Description: Function to get the average duration of one vector in cycles
+ */
+uint16 IsrInstr_getAverage(uint8 id);
+
+/*
+ * Description: Function to get the average latency of one vector in cycles,
+ *              ISR_INSTR_NO_LATENCY if none was measured
+ */
+uint16 IsrInstr_getLatencyAverage(uint8 id);
+
+#endif /*ISR_INSTRUMENTATION*/
+
+#endif /* ISR_INSTRUMENTATION_H_ */
@@ -11,6 +11,7 @@
  *******************************************************************************/
 
 #include "lcd.h"
+#include "profiler.h"
 
 /*******************************************************************************
  *                      Functions Definitions                                  *
@@ -29,6 +30,7 @@ void LCD_init(void)
 
 void LCD_sendCommand(uint8 command)
 {
+	PROFILE_ENTER(PROFILER_ID_LCD_COMMAND);
 	CLEAR_BIT(LCD_CTRL_PORT,RS); /* Instruction Mode RS=0 */
 	CLEAR_BIT(LCD_CTRL_PORT,RW); /* write data to LCD so RW=0 */
 	_delay_ms(1); /* delay for processing Tas = 50ns */
@@ -38,10 +40,12 @@ void LCD_sendCommand(uint8 command)
 	_delay_ms(1); /* delay for processing Tdsw = 100ns */
 	CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0 */
 	_delay_ms(1); /* delay for processing Th = 13ns */
+	PROFILE_EXIT(PROFILER_ID_LCD_COMMAND);
 }
 
 void LCD_displayCharacter(uint8 data)
 {
+	PROFILE_ENTER(PROFILER_ID_LCD_CHARACTER);
 	SET_BIT(LCD_CTRL_PORT,RS); /* Data Mode RS=1 */
 	CLEAR_BIT(LCD_CTRL_PORT,RW); /* write data to LCD so RW=0 */
 	_delay_ms(1); /* delay for processing Tas = 50ns */
@@ -51,16 +55,19 @@ void LCD_displayCharacter(uint8 data)
 	_delay_ms(1); /* delay for processing Tdsw = 100ns */
 	CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0 */
 	_delay_ms(1); /* delay for processing Th = 13ns */	
+	PROFILE_EXIT(PROFILER_ID_LCD_CHARACTER);
 }
 
 void LCD_displayString(const char *Str)
 {
 	uint8 i = 0;
+	PROFILE_ENTER(PROFILER_ID_LCD_STRING);
 	while(Str[i] != '\0')
 	{
 		LCD_displayCharacter(Str[i]);
 		i++;
 	}
+	PROFILE_EXIT(PROFILER_ID_LCD_STRING);
 	/***************** Another Method ***********************
 	while((*Str) != '\0')
 	{
@@ -103,9 +110,13 @@ void LCD_displayStringRowColumn(uint8 row,uint8 col,const char *Str)
 
 void LCD_intgerToString(int data)
 {
-   char buff[16]; /* String to hold the ascii result */
+   char buff[7]; /* String to hold the ascii result, "-32768" with its null */
+   PROFILE_ENTER(PROFILER_ID_LCD_INTEGER);
+   PROFILE_ENTER(PROFILER_ID_ITOA);
    itoa(data,buff,10); /* 10 for decimal */
+   PROFILE_EXIT(PROFILER_ID_ITOA);
    LCD_displayString(buff);
+   PROFILE_EXIT(PROFILER_ID_LCD_INTEGER);
 }
 
 void LCD_clearScreen(void)
@@ -8,6 +8,10 @@
  * [Description]: File to contain the application of Controlling Motor
  ***********************************************************************************/
 #include"app_file.h"
+#include"isr_bindings.h"
+
+/* The benchmark firmware (benchmark.c) has its own main */
+#ifndef BENCHMARK
 
 
 int main(void)
@@ -19,14 +23,13 @@ int main(void)
 	/*******************************************************************************
 	 *                               Initialization                                *
 	 *******************************************************************************/
-	/*Variable to store the value of ADC */
-	uint16 res_value=0;
-
 	External_Interrupt_ConfigType  button;
 	Timer_ConfigType timer;
+	Timer_ConfigType tick;
+	App_SettingsType settings;
 
 	button.INT_ID = INTERRUPT1;
-	button.INT_control = Raising;
+	button.INT_control = Falling; /* button pulls the pin LOW when pressed */
 
 	timer.COM = Clear;
 	timer.timer_ID = Timer0;
@@ -35,7 +38,24 @@ int main(void)
 	timer.timer_InitialValue =0;
 	timer.timer_compare_MatchValue=0;
 
-	Interrupt_setCallBack(buttonFunction, INTERRUPT1);
+	tick.COM = Disconnected;
+	tick.timer_ID = Timer2;
+	tick.timer_clock = SYSTEM_TICK_TIMER_CLOCK;
+	tick.timer_mode = Compare;
+	tick.timer_InitialValue = 0;
+	tick.timer_compare_MatchValue = SYSTEM_TICK_COMPARE_VALUE;
+
+	/*
+	 * The edge of the button only wakes the debouncing, the direction is
+	 * switched from the main loop once per debounced press
+	 * Run-time slots only for the vectors not bound at build time (isr_bindings.h)
+	 */
+#if !defined(INTERRUPT1_ISR_HANDLER) && (EXTERNAL_INTERRUPT_ENCODER_MODE == DISABLE)
+	Interrupt_setCallBack(Debounce_wakeCallback, INTERRUPT1); /* INT1 is the encoder in the encoder mode */
+#endif
+#ifndef TIMER2_ISR_HANDLER
+	Timer_setCallBack(App_tick, Timer2);
+#endif
 
 
 	DC_motor_Init();  /* initialize DC motor driver */
@@ -43,29 +63,43 @@ int main(void)
 	ADC_init(); /* initialize ADC driver */
 	External_Interrupt_init(&button); /* initialize external interrupt driver */
 	Timer_init(&timer);   /* initialize timer driver */
+	Debounce_init(); /* initialize buttons debouncing */
+	Timer_init(&tick);   /* initialize tick of the debouncing */
+	App_init(); /* settings, UART telemetry and commands */
+#if (APP_AUTOTUNE != DISABLE)
+	External_Interrupt_encoderInit(); /* speed of the auto tuning, INT1 is channel B and no button */
+#endif
+#if (ISR_INSTRUMENTATION != DISABLE)
+	IsrInstr_init(); /* Timer1 time stamps of the interrupts */
+#endif
+#if (PROFILER != DISABLE)
+	Profiler_init(); /* Timer1 time stamps of the main loop */
+#endif
 
 	LCD_clearScreen(); /* clear LCD at the beginning */
 	/* display this string "ADC Value = " only once at LCD */
 	LCD_displayString("ADC Value = ");
 
-	DC_motor_on_ClockWise();
+	/* clock wise unless another direction was saved (APP_PERSISTENCE) */
+	App_getSettings(&settings);
+	DC_motor_setDirection(DC_MOTOR_0, (DcMotor_Direction)settings.direction);
 
 	/*configure Resistor pin as input pin to read the value of pot*/
 	CLEAR_BIT(RESISTOR_DIRECTION_REG, RESISTOR_PIN);
+
+#if (APP_RATE_GROUPS != DISABLE)
+	App_startRateGroups(); /* the LCD belongs to the display group from now */
+#endif
 	/*******************************************************************************
 	 *                               Application                                   *
 	 *******************************************************************************/
 	while(1)
 	{
-		LCD_goToRowColumn(0,12); /* display the number every time at this position */
-		res_value = ADC_readChannel(0); /* read channel zero where the potentiometer is connect */
-
-		/*Timer0 is 8-bit mode so we have to devide the value of the
-		 * resistance over 4 to get the range of 0:256*/
-		Timer_changeCompareValue(Timer0, res_value/4, 0);
-		LCD_intgerToString(res_value); /* display the ADC value on LCD screen */
-
+		App_loopIteration();
+		App_idle(); /* sleep until the next interrupt when nothing is pending */
 	}
 
 	return 0;
 }
+
+#endif /*BENCHMARK*/
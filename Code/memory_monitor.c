@@ -0,0 +1,179 @@
+/**********************************************************************************
+ * [FILE NAME]: memory_monitor.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the monitor of the SRAM, the paint at reset and
+ *                the scans of the high-water mark of the stack.
+ *
+ ***********************************************************************************/
+
+#include"memory_monitor.h"
+
+#ifdef __AVR__
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Sections of the linker script of avr-libc */
+extern uint8 __data_start;
+extern uint8 __data_end;
+extern uint8 __bss_start;
+extern uint8 __bss_end;
+extern uint8 __heap_start;
+
+/* Break of malloc, 0 before the first malloc, not linked without malloc */
+extern char *__brkval __attribute__((weak));
+
+static uint8 *g_memoryMonitorScan_Ptr = NULL_PTR;   /* next byte of the pass */
+static uint16 g_memoryMonitorFree = 0;              /* result of the last pass */
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: paint of the RAM above .bss, run by the start up code between
+ *              the set up of the stack pointer (.init2) and the copy of .data
+ *              (.init4). Naked and inlined in the start up code: nothing is
+ *              on the stack yet, it is painted down to RAMEND
+ */
+void MemoryMonitor_paint(void) __attribute__((naked, used, section(".init3")));
+void MemoryMonitor_paint(void)
+{
+	__asm__ __volatile__ (
+		"ldi  r30, lo8(__heap_start)"  "\n\t"
+		"ldi  r31, hi8(__heap_start)"  "\n\t"
+		"ldi  r24, %[paint]"           "\n\t"
+		"ldi  r25, hi8(%[end])"        "\n"
+		"1:"                           "\n\t"
+		"st   Z+, r24"                 "\n\t"
+		"cpi  r30, lo8(%[end])"        "\n\t"
+		"cpc  r31, r25"                "\n\t"
+		"brne 1b"
+		:
+		: [paint] "M" (MEMORY_MONITOR_PAINT), [end] "i" (RAMEND + 1)
+		: "r24", "r25", "r30", "r31", "memory"
+	);
+}
+
+static uint8 * MemoryMonitor_heapEnd(void)
+{
+	if( (&__brkval != NULL_PTR) && (__brkval != NULL_PTR) )
+	{
+		return (uint8 *)__brkval;
+	}
+
+	return &__heap_start;
+}
+
+/***************************************************************************************************
+ * [Function Name]: MemoryMonitor_step
+ *
+ * [Description]:  Function to check the next bytes of the pass
+ *                 - The pass goes up from the end of the heap, the first byte
+ *                   not painted or the stack pointer ends it
+ *                 - Its length is the free RAM, the next pass starts again
+ *                   from the end of the heap
+ *                 The stack can only go deeper, a pass started before it did
+ *                 gives the old mark, the next one gives the new one
+ *
+ * [Args]:         count
+ *
+ * [In]            count: -Bytes to check at most
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE if the pass ended, FALSE otherwise
+ ***************************************************************************************************/
+static bool MemoryMonitor_step(uint16 count)
+{
+	uint8 *bottom_Ptr = MemoryMonitor_heapEnd();
+	uint8 *stack_Ptr = (uint8 *)SP;
+
+	/* first pass, or the heap grew over the pass */
+	if(g_memoryMonitorScan_Ptr < bottom_Ptr)
+	{
+		g_memoryMonitorScan_Ptr = bottom_Ptr;
+	}
+
+	while(count != 0)
+	{
+		if( (g_memoryMonitorScan_Ptr >= stack_Ptr) || (*g_memoryMonitorScan_Ptr != MEMORY_MONITOR_PAINT) )
+		{
+			g_memoryMonitorFree = (uint16)(g_memoryMonitorScan_Ptr - bottom_Ptr);
+			g_memoryMonitorScan_Ptr = bottom_Ptr;
+			return TRUE;
+		}
+		g_memoryMonitorScan_Ptr++;
+		count--;
+	}
+
+	return FALSE;
+
+}/*End of MemoryMonitor_step*/
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void MemoryMonitor_init(void)
+{
+	g_memoryMonitorScan_Ptr = NULL_PTR;
+	(void)MemoryMonitor_step(RAMEND); /* more than the RAM, the pass ends */
+}
+
+void MemoryMonitor_scan(void)
+{
+	(void)MemoryMonitor_step(MEMORY_MONITOR_SCAN_BYTES);
+}
+
+uint16 MemoryMonitor_getFree(void)
+{
+	return g_memoryMonitorFree;
+}
+
+void MemoryMonitor_getUsage(MemoryMonitor_UsageType * Usage_Ptr)
+{
+	uint8 *heapEnd_Ptr = MemoryMonitor_heapEnd();
+
+	Usage_Ptr->data = (uint16)(&__data_end - &__data_start);
+	Usage_Ptr->bss = (uint16)(&__bss_end - &__bss_start);
+	Usage_Ptr->heap = (uint16)(heapEnd_Ptr - &__heap_start);
+	Usage_Ptr->free = g_memoryMonitorFree;
+	/* from the mark to the end of the RAM */
+	Usage_Ptr->stack = (uint16)((uint8 *)(RAMEND + 1) - (heapEnd_Ptr + g_memoryMonitorFree));
+}
+
+#else
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void MemoryMonitor_init(void)
+{
+}
+
+void MemoryMonitor_scan(void)
+{
+}
+
+uint16 MemoryMonitor_getFree(void)
+{
+	return 0;
+}
+
+void MemoryMonitor_getUsage(MemoryMonitor_UsageType * Usage_Ptr)
+{
+	Usage_Ptr->data = 0;
+	Usage_Ptr->bss = 0;
+	Usage_Ptr->heap = 0;
+	Usage_Ptr->stack = 0;
+	Usage_Ptr->free = 0;
+}
+
+#endif /*__AVR__*/
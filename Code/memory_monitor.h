@@ -0,0 +1,89 @@
+/**********************************************************************************
+ * [FILE NAME]: memory_monitor.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                monitor of the 1KB of SRAM:
+ *
+ *                | .data | .bss | heap | free ... | stack |
+ *                0X60                                RAMEND
+ *
+ *                - At reset, before .data and .bss are initialized, the RAM
+ *                  between the end of .bss and RAMEND is painted with
+ *                  MEMORY_MONITOR_PAINT
+ *                - The stack grows down into the paint, the first byte not
+ *                  painted above the heap is its deepest point since the
+ *                  reset (high-water mark), interrupts and local buffers
+ *                  such as the one of itoa included
+ *                - The bytes still painted between the heap and that mark
+ *                  are the free RAM, the headroom for new buffers and queues
+ *                A byte of the stack equal to the paint reads as free, the
+ *                mark can be a few bytes optimistic.
+ *                The host build has no memory map of the AVR, all the sizes
+ *                are 0 there.
+ *
+ ***********************************************************************************/
+
+#ifndef MEMORY_MONITOR_H_
+#define MEMORY_MONITOR_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Value of the RAM never used, unlikely in addresses and small numbers*/
+#define MEMORY_MONITOR_PAINT                     0XC5
+
+/*Bytes checked by one MemoryMonitor_scan, about 5 cycles each*/
+#define MEMORY_MONITOR_SCAN_BYTES                32
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint16 data;        /* initialized variables */
+	uint16 bss;         /* variables cleared at reset */
+	uint16 heap;        /* malloc, 0 while it isn't used */
+	uint16 stack;       /* deepest stack since the reset */
+	uint16 free;        /* never used between the heap and the deepest stack */
+
+}MemoryMonitor_UsageType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to find the high-water mark at once, the whole free
+ *              RAM is scanned
+ */
+void MemoryMonitor_init(void);
+
+/*
+ * Description: Function to go on with the scan of the paint from the main
+ *              loop, MEMORY_MONITOR_SCAN_BYTES at most per call
+ *              The mark is updated once a pass reaches the stack, so it is
+ *              one pass late at most
+ */
+void MemoryMonitor_scan(void);
+
+/*
+ * Description: Function to get the free RAM found by the last pass
+ */
+uint16 MemoryMonitor_getFree(void);
+
+/*
+ * Description: Function to get the sizes of all the sections of the RAM,
+ *              the stack from the last pass
+ */
+void MemoryMonitor_getUsage(MemoryMonitor_UsageType * Usage_Ptr);
+
+#endif /* MEMORY_MONITOR_H_ */
@@ -10,8 +10,15 @@
 #define F_CPU 8000000UL //1MHz Clock frequency
 #endif
 
+#ifdef HOST_SIMULATION
+/*Native build of the drivers against the simulated registers*/
+#include "hal_host.h"
+#else
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
+#include <avr/pgmspace.h>
+#include <avr/sleep.h>
+#endif
 
 #endif /* MICRO_CONFIG_H_ */
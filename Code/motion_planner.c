@@ -0,0 +1,558 @@
+/**********************************************************************************
+ * [FILE NAME]: motion_planner.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the motion planner, trapezoidal and S-curve
+ *                profiles for positioning moves.
+ *
+ *                Every tick: acceleration += jerk, velocity += acceleration,
+ *                position += velocity. The segments are computed with the
+ *                closed form of these sums so the planned distance is exact
+ *                for the generator, the remainder (< one cruise tick) is
+ *                absorbed by snapping to the target at the end of the move.
+ *
+ ***********************************************************************************/
+
+#include"motion_planner.h"
+#include"shared_state.h"
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/* State of the generator during the planning, all in Q16.16 */
+typedef struct
+{
+	sint64 acceleration;
+	sint64 velocity;
+	sint64 position;
+
+}MotionPlanner_StateType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static MotionPlanner_SegmentType g_segments[MOTION_PLANNER_SEGMENTS];
+
+static volatile bool g_busy = FALSE;
+static uint8  g_segmentIndex = 0;
+static uint32 g_ticksLeft = 0;
+static sint32 g_jerk = 0;
+static sint32 g_acceleration = 0;
+static sint32 g_velocity = 0;
+static uint16 g_positionFraction = 0;
+static sint8  g_direction = 1;
+/* Written by the tick, the timer interrupt of the control, read by the main loop */
+static volatile sint32 g_position = 0;
+static SharedState_SequenceType g_positionSequence = 0;
+static sint32 g_target = 0;
+
+static uint32 g_fullScaleVelocity = 1;
+static uint32 g_compareScale = 0;
+static uint16 g_fullScaleCompare = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: advance the planning state by n ticks of constant jerk
+ * a_m = a0 + m*j, v_m = v0 + m*a0 + j*m(m+1)/2, p_n = sum of v_m
+ */
+static void MotionPlanner_advance(MotionPlanner_StateType *state_Ptr, sint64 jerk, uint32 n)
+{
+	sint64 ticks = n;
+	sint64 triangle = ticks * (ticks + 1) / 2;
+	sint64 tetrahedron = triangle * (ticks + 2) / 3;
+
+	state_Ptr->position += ticks * state_Ptr->velocity + state_Ptr->acceleration * triangle + jerk * tetrahedron;
+	state_Ptr->velocity += ticks * state_Ptr->acceleration + jerk * triangle;
+	state_Ptr->acceleration += ticks * jerk;
+}
+
+/*
+ * Description: distance of the acceleration and deceleration phases without cruise
+ */
+static sint64 MotionPlanner_rampsDistance(sint32 jerk, uint32 jerk_ticks, uint32 accel_ticks)
+{
+	MotionPlanner_StateType state = {0, 0, 0};
+
+	MotionPlanner_advance(&state,  jerk, jerk_ticks);
+	MotionPlanner_advance(&state,  0,    accel_ticks);
+	MotionPlanner_advance(&state, -jerk, jerk_ticks);
+	MotionPlanner_advance(&state, -jerk, jerk_ticks);
+	MotionPlanner_advance(&state,  0,    accel_ticks);
+	MotionPlanner_advance(&state,  jerk, jerk_ticks);
+
+	return state.position;
+}
+
+static uint32 MotionPlanner_squareRoot(uint32 value)
+{
+	uint32 root = 0;
+	uint32 bit = 1UL << 30;
+
+	while(bit > value)
+	{
+		bit >>= 2;
+	}
+
+	while(bit != 0)
+	{
+		if(value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return root;
+}
+
+/*
+ * Description: load the next segment having ticks, finish the move after the last one
+ */
+static void MotionPlanner_nextSegment(void)
+{
+	while( (g_segmentIndex < MOTION_PLANNER_SEGMENTS) && (g_segments[g_segmentIndex].ticks == 0) )
+	{
+		g_segmentIndex++;
+	}
+
+	if(g_segmentIndex < MOTION_PLANNER_SEGMENTS)
+	{
+		g_jerk = g_segments[g_segmentIndex].jerk;
+		g_ticksLeft = g_segments[g_segmentIndex].ticks;
+		g_segmentIndex++;
+	}
+	else
+	{
+		/*End of the move, remove the rounding remainder*/
+		g_position = g_target;
+		g_positionFraction = 0;
+		g_acceleration = 0;
+		g_velocity = 0;
+		g_busy = FALSE;
+	}
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_init
+ *
+ * [Description]:  Function to initialize the planner
+ *
+ * [Args]:         full_scale_velocity, full_scale_compare
+ *
+ * [In]            full_scale_velocity: -Velocity in counts/s giving the full PWM duty
+ *
+ *                 full_scale_compare:  -Compare value of the full PWM duty
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void MotionPlanner_init(uint32 full_scale_velocity, uint16 full_scale_compare)
+{
+	/*Full scale velocity in Q8.8 counts/tick*/
+	g_fullScaleVelocity = (full_scale_velocity << 8) / MOTION_PLANNER_TICK_FREQUENCY;
+	if(g_fullScaleVelocity == 0)
+	{
+		g_fullScaleVelocity = 1;
+	}
+
+	g_fullScaleCompare = full_scale_compare;
+	g_compareScale = ((uint32)full_scale_compare << 16) / g_fullScaleVelocity;
+
+	g_busy = FALSE;
+	g_position = 0;
+	g_target = 0;
+	g_velocity = 0;
+	g_acceleration = 0;
+
+}/*End of MotionPlanner_init*/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_startMove
+ *
+ * [Description]:  Function to plan a move from the current position
+ *                 - Convert the limits to Q16.16 per tick units
+ *                 - Choose the jerk/constant acceleration durations reaching the
+ *                   max velocity, shorten them when the move is too short
+ *                 - Fill the remaining distance with the cruise segment
+ *
+ * [Args]:         Move_Ptr
+ *
+ * [In]            Move_Ptr: Pointer to the move parameters
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if a move is still running, TRUE otherwise
+ ***************************************************************************************************/
+bool MotionPlanner_startMove(const MotionPlanner_MoveType * Move_Ptr)
+{
+	const uint64 frequency = MOTION_PLANNER_TICK_FREQUENCY;
+	sint32 velocity;
+	sint32 acceleration;
+	sint32 jerk;
+	uint32 jerk_ticks;
+	uint32 accel_ticks;
+	uint32 cruise_ticks = 0;
+	uint32 low;
+	uint32 high;
+	sint64 distance;
+	sint64 ramps;
+	sint64 peak_velocity;
+	uint8 sreg;
+
+	if(g_busy)
+	{
+		return FALSE;
+	}
+
+	velocity = (sint32)( ((uint64)Move_Ptr->max_velocity << MOTION_PLANNER_FRACTION_BITS) / frequency );
+	acceleration = (sint32)( ((uint64)Move_Ptr->acceleration << MOTION_PLANNER_FRACTION_BITS) / (frequency * frequency) );
+	jerk = (sint32)( ((uint64)Move_Ptr->jerk << MOTION_PLANNER_FRACTION_BITS) / (frequency * frequency * frequency) );
+
+	if(velocity == 0)
+	{
+		velocity = 1;
+	}
+	if(acceleration == 0)
+	{
+		acceleration = 1;
+	}
+
+	if( (Move_Ptr->jerk == 0) || (jerk >= acceleration) )
+	{
+		/*Trapezoid: the acceleration steps in one tick*/
+		jerk = acceleration;
+		jerk_ticks = 1;
+	}
+	else
+	{
+		if(jerk == 0)
+		{
+			jerk = 1;
+		}
+		jerk_ticks = acceleration / jerk;
+	}
+
+	/*Velocity reached at the end of the acceleration = jerk*jerk_ticks*(jerk_ticks+accel_ticks)*/
+	if( ((sint64)jerk * jerk_ticks * jerk_ticks) > velocity )
+	{
+		jerk_ticks = MotionPlanner_squareRoot(velocity / jerk);
+		if(jerk_ticks == 0)
+		{
+			jerk_ticks = 1;
+		}
+		accel_ticks = 0;
+	}
+	else
+	{
+		accel_ticks = (velocity / (jerk * jerk_ticks)) - jerk_ticks;
+	}
+
+	g_direction = (Move_Ptr->target >= g_position) ? 1 : -1;
+	distance = (sint64)(Move_Ptr->target - g_position) * g_direction;
+	distance <<= MOTION_PLANNER_FRACTION_BITS;
+
+	/*Short move: largest constant acceleration part fitting in the distance*/
+	if(MotionPlanner_rampsDistance(jerk, jerk_ticks, accel_ticks) > distance)
+	{
+		low = 0;
+		high = accel_ticks;
+		while(low < high)
+		{
+			uint32 middle = low + (high - low + 1) / 2;
+
+			if(MotionPlanner_rampsDistance(jerk, jerk_ticks, middle) <= distance)
+			{
+				low = middle;
+			}
+			else
+			{
+				high = middle - 1;
+			}
+		}
+		accel_ticks = low;
+	}
+
+	/*Still too long: shorten the jerk parts*/
+	if(MotionPlanner_rampsDistance(jerk, jerk_ticks, accel_ticks) > distance)
+	{
+		low = 0;
+		high = jerk_ticks;
+		while(low < high)
+		{
+			uint32 middle = low + (high - low + 1) / 2;
+
+			if(MotionPlanner_rampsDistance(jerk, middle, 0) <= distance)
+			{
+				low = middle;
+			}
+			else
+			{
+				high = middle - 1;
+			}
+		}
+		jerk_ticks = low;
+	}
+
+	ramps = MotionPlanner_rampsDistance(jerk, jerk_ticks, accel_ticks);
+	peak_velocity = (sint64)jerk * jerk_ticks * (jerk_ticks + accel_ticks);
+
+	if(peak_velocity > 0)
+	{
+		cruise_ticks = (uint32)( (distance - ramps) / peak_velocity );
+	}
+
+	g_segments[0].jerk =  jerk;  g_segments[0].ticks = jerk_ticks;
+	g_segments[1].jerk =  0;     g_segments[1].ticks = accel_ticks;
+	g_segments[2].jerk = -jerk;  g_segments[2].ticks = jerk_ticks;
+	g_segments[3].jerk =  0;     g_segments[3].ticks = cruise_ticks;
+	g_segments[4].jerk = -jerk;  g_segments[4].ticks = jerk_ticks;
+	g_segments[5].jerk =  0;     g_segments[5].ticks = accel_ticks;
+	g_segments[6].jerk =  jerk;  g_segments[6].ticks = jerk_ticks;
+
+	g_target = Move_Ptr->target;
+	g_acceleration = 0;
+	g_velocity = 0;
+	g_positionFraction = 0;
+	g_segmentIndex = 0;
+
+	sreg = SREG;
+	cli(); /* the tick must not run before the first segment is loaded */
+	g_busy = TRUE;
+	MotionPlanner_nextSegment();
+	SREG = sreg;
+
+	return TRUE;
+
+}/*End of MotionPlanner_startMove*/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_tick
+ *
+ * [Description]:  Function to advance the profile by one control tick
+ *                 Additions only, no multiplication or division
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Velocity setpoint in Q16.16 counts/tick (signed)
+ ***************************************************************************************************/
+sint32 MotionPlanner_tick(void)
+{
+	uint32 fraction;
+	sint32 step;
+
+	if(!g_busy)
+	{
+		return 0;
+	}
+
+	g_acceleration += g_jerk;
+	g_velocity += g_acceleration;
+
+	/*position += velocity with the fraction kept apart*/
+	fraction = (uint32)g_positionFraction + (uint16)g_velocity;
+	step = (g_velocity >> MOTION_PLANNER_FRACTION_BITS) + (sint32)(fraction >> MOTION_PLANNER_FRACTION_BITS);
+	g_positionFraction = (uint16)fraction;
+	g_position += (g_direction > 0) ? step : -step;
+
+	g_ticksLeft--;
+	if(g_ticksLeft == 0)
+	{
+		MotionPlanner_nextSegment();
+	}
+	SHARED_STATE_PUBLISH(g_positionSequence);
+
+	return (g_direction > 0) ? g_velocity : -g_velocity;
+
+}/*End of MotionPlanner_tick*/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_velocityToCompare
+ *
+ * [Description]:  Function to convert a velocity setpoint to a PWM compare value
+ *
+ * [Args]:         velocity
+ *
+ * [In]            velocity: -Velocity setpoint in Q16.16 counts/tick
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Compare value between 0 and full_scale_compare
+ ***************************************************************************************************/
+uint16 MotionPlanner_velocityToCompare(sint32 velocity)
+{
+	uint32 magnitude = (velocity < 0) ? -velocity : velocity;
+
+	/*Q8.8 counts/tick*/
+	magnitude >>= 8;
+
+	if(magnitude >= g_fullScaleVelocity)
+	{
+		return g_fullScaleCompare;
+	}
+
+	return (uint16)( (magnitude * g_compareScale) >> 16 );
+
+}/*End of MotionPlanner_velocityToCompare*/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_driveTick
+ *
+ * [Description]:  Function to advance the profile by one tick and write the
+ *                 setpoint to the PWM through Timer_changeCompareValue
+ *
+ * [Args]:         timerID, channel
+ *
+ * [In]            timerID: -Timer generating the PWM of the motor
+ *
+ *                 channel: -Channel of the timer (Timer1 only)
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Velocity setpoint in Q16.16 counts/tick (signed)
+ ***************************************************************************************************/
+sint32 MotionPlanner_driveTick(Timer_Type timerID, Channel_Type channel)
+{
+	sint32 velocity = MotionPlanner_tick();
+
+	Timer_changeCompareValue(timerID, MotionPlanner_velocityToCompare(velocity), channel);
+
+	return velocity;
+
+}/*End of MotionPlanner_driveTick*/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_abort
+ *
+ * [Description]:  Function to stop the profile at once, the next ticks return
+ *                 a zero velocity
+ *                 The 32-bit velocity and acceleration are cleared with the
+ *                 interrupts disabled, MotionPlanner_tick may run from the tick
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void MotionPlanner_abort(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	g_busy = FALSE;
+	g_velocity = 0;
+	g_acceleration = 0;
+	SREG = sreg;
+
+}/*End of MotionPlanner_abort*/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_isBusy
+ *
+ * [Description]:  Function to know if a move is running
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE until the last segment of the move is over
+ ***************************************************************************************************/
+bool MotionPlanner_isBusy(void)
+{
+	return g_busy;
+
+}/*End of MotionPlanner_isBusy*/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_getPosition
+ *
+ * [Description]:  Function to read the position of the profile, consistent
+ *                 with the tick updating it (SHARED_STATE_READ)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Position in counts
+ ***************************************************************************************************/
+sint32 MotionPlanner_getPosition(void)
+{
+	sint32 position;
+
+	SHARED_STATE_READ(g_positionSequence, position = g_position);
+
+	return position;
+
+}/*End of MotionPlanner_getPosition*/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_setPosition
+ *
+ * [Description]:  Function to set the position of the profile, its
+ *                 fraction cleared, with the interrupts disabled
+ *
+ * [Args]:         position
+ *
+ * [In]            position: -New position in counts
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void MotionPlanner_setPosition(sint32 position)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	g_position = position;
+	g_positionFraction = 0;
+	SREG = sreg;
+
+}/*End of MotionPlanner_setPosition*/
+
+/***************************************************************************************************
+ * [Function Name]: MotionPlanner_getSegments
+ *
+ * [Description]:  Function to get the segments of the last move planned
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Pointer to the table of MOTION_PLANNER_SEGMENTS segments
+ ***************************************************************************************************/
+const MotionPlanner_SegmentType * MotionPlanner_getSegments(void)
+{
+	return g_segments;
+
+}/*End of MotionPlanner_getSegments*/
@@ -0,0 +1,114 @@
+/**********************************************************************************
+ * [FILE NAME]: motion_planner.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                motion planner of positioning moves.
+ *                A move (target, max velocity, acceleration, jerk) is planned
+ *                once into 7 segments (S-curve, or trapezoid when jerk = 0),
+ *                then every control tick the velocity setpoint is generated
+ *                with integer additions only.
+ *
+ *                Units: position in counts, velocity/acceleration/jerk of the
+ *                generator in Q16.16 counts per tick (tick^2, tick^3).
+ *
+ ***********************************************************************************/
+
+#ifndef MOTION_PLANNER_H_
+#define MOTION_PLANNER_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "timers.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Frequency of the control tick calling MotionPlanner_tick*/
+#define MOTION_PLANNER_TICK_FREQUENCY            1000UL
+
+#define MOTION_PLANNER_SEGMENTS                  7
+#define MOTION_PLANNER_FRACTION_BITS             16
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	sint32 target;         /* absolute target position in counts */
+	uint32 max_velocity;   /* counts/s */
+	uint32 acceleration;   /* counts/s^2 */
+	uint32 jerk;           /* counts/s^3, 0 for a trapezoidal profile */
+
+}MotionPlanner_MoveType;
+
+typedef struct
+{
+	sint32 jerk;           /* Q16.16 counts/tick^3 added to the acceleration every tick */
+	uint32 ticks;          /* duration of the segment */
+
+}MotionPlanner_SegmentType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to initialize the planner
+ *              full_scale_velocity (counts/s) gives full_scale_compare on the PWM
+ */
+void MotionPlanner_init(uint32 full_scale_velocity, uint16 full_scale_compare);
+
+/*
+ * Description: Function to plan a move from the current position
+ *              All the divisions are done here once per move
+ *              Returns FALSE if a move is still running
+ */
+bool MotionPlanner_startMove(const MotionPlanner_MoveType * Move_Ptr);
+
+/*
+ * Description: Function to advance the profile by one control tick
+ *              Returns the velocity setpoint in Q16.16 counts/tick (signed)
+ */
+sint32 MotionPlanner_tick(void);
+
+/*
+ * Description: Function to convert a velocity setpoint to a PWM compare value
+ */
+uint16 MotionPlanner_velocityToCompare(sint32 velocity);
+
+/*
+ * Description: Function to advance the profile by one tick and write the
+ *              setpoint to the PWM through Timer_changeCompareValue
+ *              Returns the velocity setpoint like MotionPlanner_tick
+ */
+sint32 MotionPlanner_driveTick(Timer_Type timerID, Channel_Type channel);
+
+/*
+ * Description: Function to stop the profile immediately
+ */
+void MotionPlanner_abort(void);
+
+/*
+ * Description: Function to check if a move is running
+ */
+bool MotionPlanner_isBusy(void);
+
+/*
+ * Description: Functions to read/set the position of the profile in counts
+ */
+sint32 MotionPlanner_getPosition(void);
+void MotionPlanner_setPosition(sint32 position);
+
+/*
+ * Description: Function to get the planned segments of the current move
+ */
+const MotionPlanner_SegmentType * MotionPlanner_getSegments(void);
+
+#endif /* MOTION_PLANNER_H_ */
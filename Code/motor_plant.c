@@ -0,0 +1,273 @@
+/**********************************************************************************
+ * [FILE NAME]: motor_plant.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the model of the DC motor, host build only.
+ *
+ ***********************************************************************************/
+
+#ifdef HOST_SIMULATION
+
+#include <math.h>
+#include "motor_plant.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define MOTOR_PLANT_TWO_PI                       6.283185307179586
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	float64 current;
+	float64 speed;
+	float64 angle;
+
+}MotorPlant_VectorType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static const MotorPlant_ConfigType *g_plantConfig_Ptr = NULL_PTR;
+static MotorPlant_VectorType g_plantState;
+static float64 g_plantVoltage = 0;
+static float64 g_plantLoad = 0;
+static sint32 g_encoderCount = 0;
+
+/* A/B levels of the quadrature count modulo 4, A leading B counts up */
+static const uint8 g_encoderPattern[4] = {0X00, 0X01, 0X03, 0X02};
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: voltage across the motor from the IN1/IN2 pins and the PWM
+ *              IN1 = 0, IN2 = 1 clockwise (positive), equal pins brake
+ */
+static float64 MotorPlant_appliedVoltage(void)
+{
+	const DcMotor_ConfigType *motor_Ptr = &g_DcMotor_config[g_plantConfig_Ptr->motor_id];
+	uint8 pins = *(motor_Ptr->dataPort);
+	uint8 in1 = BIT_IS_SET(pins, motor_Ptr->in1Pin) ? 1 : 0;
+	uint8 in2 = BIT_IS_SET(pins, motor_Ptr->in2Pin) ? 1 : 0;
+	static const uint8 timers[4] = {0, 1, 1, 2};
+	static const uint8 channels[4] = {0, 0, 1, 0};
+	uint32 duty;
+
+	if(in1 == in2)
+	{
+		return 0;
+	}
+
+	duty = HostHal_getPwmDuty(timers[motor_Ptr->pwmChannel], channels[motor_Ptr->pwmChannel]);
+	if(duty == HOST_HAL_PWM_DISCONNECTED)
+	{
+		/* enable pin not driven by the timer, the bridge stays off */
+		return 0;
+	}
+
+	return ((in2 != 0) ? 1.0 : -1.0) * g_plantConfig_Ptr->supply_voltage *
+			((float64)duty / HOST_HAL_PWM_FULL_SCALE);
+}
+
+static MotorPlant_VectorType MotorPlant_derivative(const MotorPlant_VectorType *x_Ptr)
+{
+	const MotorPlant_ConfigType *config_Ptr = g_plantConfig_Ptr;
+	MotorPlant_VectorType dx;
+	float64 friction = config_Ptr->coulomb_friction * x_Ptr->speed /
+			(fabs(x_Ptr->speed) + MOTOR_PLANT_FRICTION_SMOOTHING);
+
+	dx.current = (g_plantVoltage - config_Ptr->resistance * x_Ptr->current -
+			config_Ptr->back_emf_constant * x_Ptr->speed) / config_Ptr->inductance;
+	dx.speed = (config_Ptr->torque_constant * x_Ptr->current -
+			config_Ptr->viscous_friction * x_Ptr->speed - friction - g_plantLoad) / config_Ptr->inertia;
+	dx.angle = x_Ptr->speed;
+
+	return dx;
+}
+
+static MotorPlant_VectorType MotorPlant_add(const MotorPlant_VectorType *x_Ptr,
+		const MotorPlant_VectorType *dx_Ptr, float64 h)
+{
+	MotorPlant_VectorType y;
+
+	y.current = x_Ptr->current + h * dx_Ptr->current;
+	y.speed = x_Ptr->speed + h * dx_Ptr->speed;
+	y.angle = x_Ptr->angle + h * dx_Ptr->angle;
+
+	return y;
+}
+
+static uint16 MotorPlant_toAdc(float64 volts)
+{
+	float64 counts = fabs(volts) * (MOTOR_PLANT_ADC_FULL_SCALE + 1) / MOTOR_PLANT_ADC_REFERENCE;
+
+	return (counts >= MOTOR_PLANT_ADC_FULL_SCALE) ? MOTOR_PLANT_ADC_FULL_SCALE : (uint16)counts;
+}
+
+/*
+ * Description: walk the encoder count to the angle, one transition at a time
+ */
+static void MotorPlant_updateEncoder(void)
+{
+	const MotorPlant_ConfigType *config_Ptr = g_plantConfig_Ptr;
+	sint32 target = (sint32)floor(g_plantState.angle * config_Ptr->encoder_lines * 4 / MOTOR_PLANT_TWO_PI);
+	uint8 edges = 0;
+	uint8 old_pattern;
+	uint8 new_pattern;
+
+	while( (g_encoderCount != target) && (edges < MOTOR_PLANT_MAX_EDGES_PER_STEP) )
+	{
+		old_pattern = g_encoderPattern[g_encoderCount & 0X03];
+		g_encoderCount += (target > g_encoderCount) ? 1 : -1;
+		new_pattern = g_encoderPattern[g_encoderCount & 0X03];
+
+		if((old_pattern ^ new_pattern) & 0X01)
+		{
+			HostHal_setInputPin(config_Ptr->encoder_port, config_Ptr->encoder_a_pin, new_pattern & 0X01);
+			if(config_Ptr->encoder_capture && (new_pattern & 0X01))
+			{
+				HostHal_captureTimer1();
+			}
+		}
+		else
+		{
+			HostHal_setInputPin(config_Ptr->encoder_port, config_Ptr->encoder_b_pin, (new_pattern >> 1) & 0X01);
+		}
+		edges++;
+	}
+
+	/* faster than the edges can be sent, the count jumps */
+	g_encoderCount = target;
+}
+
+/*
+ * Description: hook of hal_host
+ */
+static void MotorPlant_hook(void)
+{
+	MotorPlant_step();
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: MotorPlant_init
+ *
+ * [Description]:  Function to initialize the model
+ *                 - Motor at rest, no load
+ *                 - Encoder pins LOW, the model runs every step_time
+ *
+ * [Args]:         Config_Ptr
+ *
+ * [In]            Config_Ptr: Pointer to the Motor Plant Configuration Structure,
+ *                             must stay valid as long as the model runs
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void MotorPlant_init(const MotorPlant_ConfigType * Config_Ptr)
+{
+	g_plantConfig_Ptr = Config_Ptr;
+	g_plantState.current = 0;
+	g_plantState.speed = 0;
+	g_plantState.angle = 0;
+	g_plantVoltage = 0;
+	g_plantLoad = 0;
+	g_encoderCount = 0;
+
+	if(Config_Ptr->encoder_lines != 0)
+	{
+		HostHal_setInputPin(Config_Ptr->encoder_port, Config_Ptr->encoder_a_pin, LOW);
+		HostHal_setInputPin(Config_Ptr->encoder_port, Config_Ptr->encoder_b_pin, LOW);
+	}
+
+	HostHal_setPeriodicHook(MotorPlant_hook, (uint32)(Config_Ptr->step_time * F_CPU + 0.5));
+
+}/*End of MotorPlant_init*/
+
+void MotorPlant_deinit(void)
+{
+	HostHal_setPeriodicHook(NULL_PTR, 0);
+}
+
+/***************************************************************************************************
+ * [Function Name]: MotorPlant_step
+ *
+ * [Description]:  Function to advance the model by one step
+ *                 - Sample the voltage applied by the drivers
+ *                 - One RK4 step of the current, speed and angle
+ *                 - Current and speed to their ADC channels, encoder edges
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void MotorPlant_step(void)
+{
+	const MotorPlant_ConfigType *config_Ptr = g_plantConfig_Ptr;
+	float64 h = config_Ptr->step_time;
+	MotorPlant_VectorType k1, k2, k3, k4, x;
+
+	g_plantVoltage = MotorPlant_appliedVoltage();
+
+	k1 = MotorPlant_derivative(&g_plantState);
+	x = MotorPlant_add(&g_plantState, &k1, h / 2);
+	k2 = MotorPlant_derivative(&x);
+	x = MotorPlant_add(&g_plantState, &k2, h / 2);
+	k3 = MotorPlant_derivative(&x);
+	x = MotorPlant_add(&g_plantState, &k3, h);
+	k4 = MotorPlant_derivative(&x);
+
+	g_plantState.current += h / 6 * (k1.current + 2 * k2.current + 2 * k3.current + k4.current);
+	g_plantState.speed += h / 6 * (k1.speed + 2 * k2.speed + 2 * k3.speed + k4.speed);
+	g_plantState.angle += h / 6 * (k1.angle + 2 * k2.angle + 2 * k3.angle + k4.angle);
+
+	if(config_Ptr->current_adc_channel != MOTOR_PLANT_NOT_CONNECTED)
+	{
+		HostHal_setAdcInput(config_Ptr->current_adc_channel,
+				MotorPlant_toAdc(g_plantState.current * config_Ptr->current_gain));
+	}
+	if(config_Ptr->speed_adc_channel != MOTOR_PLANT_NOT_CONNECTED)
+	{
+		HostHal_setAdcInput(config_Ptr->speed_adc_channel,
+				MotorPlant_toAdc(g_plantState.speed * config_Ptr->speed_gain));
+	}
+	if(config_Ptr->encoder_lines != 0)
+	{
+		MotorPlant_updateEncoder();
+	}
+
+}/*End of MotorPlant_step*/
+
+void MotorPlant_setLoadTorque(float64 torque)
+{
+	g_plantLoad = torque;
+}
+
+void MotorPlant_getState(MotorPlant_StateType * State_Ptr)
+{
+	State_Ptr->current = g_plantState.current;
+	State_Ptr->speed = g_plantState.speed;
+	State_Ptr->angle = g_plantState.angle;
+	State_Ptr->voltage = g_plantVoltage;
+	State_Ptr->encoder_count = g_encoderCount;
+}
+
+#endif /*HOST_SIMULATION*/
@@ -0,0 +1,122 @@
+/**********************************************************************************
+ * [FILE NAME]: motor_plant.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Model of the DC motor for the host build (HOST_SIMULATION),
+ *                closing the loop around the drivers running on hal_host:
+ *                - Inputs: PWM duty of the motor channel and IN1/IN2 pins
+ *                - Electrical: L di/dt = V - R i - Ke w
+ *                - Mechanical: J dw/dt = Kt i - B w - Tc sign(w) - T_load
+ *                - Outputs: current and speed on ADC channels, quadrature
+ *                  encoder edges on the pins and Timer1 input capture
+ *                Fixed step RK4 called by the periodic hook of hal_host.
+ *                The PWM is averaged over its period, fine as long as the
+ *                period is much shorter than L/R.
+ *
+ ***********************************************************************************/
+
+#ifndef MOTOR_PLANT_H_
+#define MOTOR_PLANT_H_
+
+#ifdef HOST_SIMULATION
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "DCmotor.h"
+#include "external_interrupts.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define MOTOR_PLANT_NOT_CONNECTED                0XFF
+
+/*Coulomb friction is smoothed under this speed (rad/s) to keep RK4 stable*/
+#define MOTOR_PLANT_FRICTION_SMOOTHING           0.1
+
+/*Encoder transitions emitted in one step at most*/
+#define MOTOR_PLANT_MAX_EDGES_PER_STEP           64
+
+#define MOTOR_PLANT_ADC_REFERENCE                5.0
+#define MOTOR_PLANT_ADC_FULL_SCALE               1023
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	/* Motor */
+	float64 resistance;           /* ohm */
+	float64 inductance;           /* henry */
+	float64 back_emf_constant;    /* V / (rad/s) */
+	float64 torque_constant;      /* N.m / A */
+	float64 inertia;              /* kg.m^2 */
+	float64 viscous_friction;     /* N.m / (rad/s) */
+	float64 coulomb_friction;     /* N.m */
+	float64 supply_voltage;       /* V of the H-bridge */
+
+	/* Wiring */
+	uint8 motor_id;               /* index in g_DcMotor_config */
+	uint8 current_adc_channel;    /* or MOTOR_PLANT_NOT_CONNECTED */
+	float64 current_gain;         /* V / A of the current sense */
+	uint8 speed_adc_channel;      /* or MOTOR_PLANT_NOT_CONNECTED */
+	float64 speed_gain;           /* V / (rad/s) of the tachometer */
+	uint16 encoder_lines;         /* lines per revolution, 0 without encoder */
+	uint8 encoder_port;           /* 0:3 = PORTA:PORTD */
+	uint8 encoder_a_pin;
+	uint8 encoder_b_pin;
+	bool encoder_capture;         /* rising edges of A captured by Timer1 */
+
+	/* Integration */
+	float64 step_time;            /* seconds */
+
+}MotorPlant_ConfigType;
+
+typedef struct
+{
+	float64 current;              /* A */
+	float64 speed;                /* rad/s */
+	float64 angle;                /* rad */
+	float64 voltage;              /* V applied */
+	sint32 encoder_count;
+
+}MotorPlant_StateType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to reset the motor and run it every step_time of the
+ *              simulated time of hal_host
+ */
+void MotorPlant_init(const MotorPlant_ConfigType * Config_Ptr);
+
+/*
+ * Description: Function to stop running the model
+ */
+void MotorPlant_deinit(void);
+
+/*
+ * Description: Function to advance the model by step_time, called by hal_host
+ *              or directly to run the motor without the microcontroller
+ */
+void MotorPlant_step(void);
+
+/*
+ * Description: Function to set the torque of the load (N.m)
+ */
+void MotorPlant_setLoadTorque(float64 torque);
+
+/*
+ * Description: Function to get the state of the motor
+ */
+void MotorPlant_getState(MotorPlant_StateType * State_Ptr);
+
+#endif /*HOST_SIMULATION*/
+
+#endif /* MOTOR_PLANT_H_ */
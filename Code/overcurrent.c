@@ -0,0 +1,400 @@
+/**********************************************************************************
+ * [FILE NAME]: overcurrent.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the motor overcurrent protection, fast path by
+ *                the analog comparator and slow path by I^2t on the ADC.
+ *
+ ***********************************************************************************/
+
+#include"overcurrent.h"
+#include"isr_instrumentation.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* COM bits of every timer control register to clear on a trip */
+static uint8 g_timer0_comMask = 0;
+static uint8 g_timer1_comMask = 0;
+static uint8 g_timer2_comMask = 0;
+
+/* COM bits configured before the trip to restore them on a retry */
+static uint8 g_timer0_comSaved = 0;
+static uint8 g_timer1_comSaved = 0;
+static uint8 g_timer2_comSaved = 0;
+
+static const Overcurrent_ConfigType *g_config_Ptr = NULL_PTR;
+
+static volatile Overcurrent_State g_state = OVERCURRENT_OK;
+static volatile uint16 g_tripLatency = 0;
+static volatile uint16 g_tripsCount = 0;
+
+static uint32 g_nominalSquare = 0;
+static uint32 g_i2tAccumulator = 0;
+static uint16 g_current = 0;
+static uint16 g_retryTicks = 0;
+static uint16 g_healthyTicks = 0;
+static uint8  g_retries = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: clear the COM bits of the protected channels, the OC pins go
+ * back to their PORT value which is low
+ */
+static inline void Overcurrent_disconnectPwm(void)
+{
+	TIMER0_CONTROL_REGIRSTER   &= ~g_timer0_comMask;
+	TIMER1_CONTROL_REGIRSTER_A &= ~g_timer1_comMask;
+	TIMER2_CONTROL_REGIRSTER   &= ~g_timer2_comMask;
+}
+
+static void Overcurrent_reconnectPwm(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	TIMER0_CONTROL_REGIRSTER   |= g_timer0_comSaved;
+	TIMER1_CONTROL_REGIRSTER_A |= g_timer1_comSaved;
+	TIMER2_CONTROL_REGIRSTER   |= g_timer2_comSaved;
+	SREG = sreg;
+}
+
+static void Overcurrent_enableComparatorInterrupt(void)
+{
+#if (OVERCURRENT_FAST_PATH != DISABLE)
+	/*Clear any pending edge then enable the interrupt*/
+	ANALOG_COMPARATOR_CONTROL_REGISTER |= (1<<ACI);
+	ANALOG_COMPARATOR_CONTROL_REGISTER |= (1<<ACIE);
+#endif
+}
+
+/*******************************************************************************
+ *                       Interrupt Service Routines                            *
+ *******************************************************************************/
+
+#if (OVERCURRENT_FAST_PATH != DISABLE)
+ISR(ANA_COMP_vect)
+{
+	/*Disconnect the PWM first, everything else can wait, the instrumentation too*/
+	Overcurrent_disconnectPwm();
+
+#if (OVERCURRENT_LATENCY_MEASUREMENT != DISABLE)
+	/*ICR1 was captured by the comparator edge*/
+	g_tripLatency = TIMER_CYCLE_COUNTER_REGISTER - INPUT_CAPTURE_REGISRTER1;
+#endif
+
+	ISR_INSTR_ENTRY(ISR_ID_ANA_COMP);
+
+	/*One trip is enough, the slow path re-enables the interrupt on retry*/
+	ANALOG_COMPARATOR_CONTROL_REGISTER &= ~(1<<ACIE);
+
+	g_state = OVERCURRENT_TRIPPED;
+	g_tripsCount++;
+
+	ISR_INSTR_EXIT(ISR_ID_ANA_COMP);
+}
+#endif
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: Overcurrent_init
+ *
+ * [Description]:  Function to initialize the overcurrent protection
+ *                 - Save the COM bits of the protected PWM channels
+ *                 - Configure the analog comparator and its interrupt (fast path)
+ *                 - Reset the I^2t accumulator (slow path)
+ *
+ * [Args]:         Config_Ptr
+ *
+ * [In]            Config_Ptr: Pointer to Overcurrent Configuration Structure
+ *                             must stay valid as long as the protection works
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Overcurrent_init(const Overcurrent_ConfigType * Config_Ptr)
+{
+	g_config_Ptr = Config_Ptr;
+
+	g_timer0_comMask = 0;
+	g_timer1_comMask = 0;
+	g_timer2_comMask = 0;
+
+	if(BIT_IS_SET(Config_Ptr->pwm_channels_mask, DC_MOTOR_PWM_OC0))
+	{
+		g_timer0_comMask |= (uint8)(~TIMER0_COM0_MASK_CLEAR);
+		CLEAR_BIT(OC0_DATA_PORT, OC0_PIN);
+	}
+	if(BIT_IS_SET(Config_Ptr->pwm_channels_mask, DC_MOTOR_PWM_OC1A))
+	{
+		g_timer1_comMask |= (uint8)(~TIMER1_COM1A_MASK_CLEAR);
+		CLEAR_BIT(OC1A_DATA_PORT, OC1A_PIN);
+	}
+	if(BIT_IS_SET(Config_Ptr->pwm_channels_mask, DC_MOTOR_PWM_OC1B))
+	{
+		g_timer1_comMask |= (uint8)(~TIMER1_COM1B_MASK_CLEAR);
+		CLEAR_BIT(OC1B_DATA_PORT, OC1B_PIN);
+	}
+	if(BIT_IS_SET(Config_Ptr->pwm_channels_mask, DC_MOTOR_PWM_OC2))
+	{
+		g_timer2_comMask |= (uint8)(~TIMER2_CLEAR_COMPARE_OUTPUT_MODE_BITS_VALUE);
+		CLEAR_BIT(OC2_DATA_PORT, OC2_PIN);
+	}
+
+	g_timer0_comSaved = TIMER0_CONTROL_REGIRSTER   & g_timer0_comMask;
+	g_timer1_comSaved = TIMER1_CONTROL_REGIRSTER_A & g_timer1_comMask;
+	g_timer2_comSaved = TIMER2_CONTROL_REGIRSTER   & g_timer2_comMask;
+
+	g_nominalSquare = (uint32)(Config_Ptr->nominal_current) * (Config_Ptr->nominal_current);
+	g_i2tAccumulator = 0;
+	g_retries = 0;
+	g_healthyTicks = 0;
+	g_tripsCount = 0;
+	g_state = OVERCURRENT_OK;
+
+#if (OVERCURRENT_FAST_PATH != DISABLE)
+
+	/*configure the comparator inputs as input pins without pull up*/
+#if (OVERCURRENT_USE_BANDGAP_REFERENCE == DISABLE)
+	CLEAR_BIT(ANALOG_COMPARATOR_DIRECTION_PORT, ANALOG_COMPARATOR_AIN0_PIN);
+	CLEAR_BIT(ANALOG_COMPARATOR_DATA_PORT, ANALOG_COMPARATOR_AIN0_PIN);
+#endif
+	CLEAR_BIT(ANALOG_COMPARATOR_DIRECTION_PORT, ANALOG_COMPARATOR_AIN1_PIN);
+	CLEAR_BIT(ANALOG_COMPARATOR_DATA_PORT, ANALOG_COMPARATOR_AIN1_PIN);
+
+	/*AIN1 is the negative input, the ADC multiplexer is not used*/
+	CLEAR_BIT(SFIOR, ACME);
+
+	/* ACSR Register Bits Description:
+	 * ACD     = 0 comparator powered
+	 * ACBG    = 1 bandgap on the positive input (or 0 for AIN0)
+	 * ACIE    = 0 enabled at the end after clearing ACI
+	 * ACIC    = 1 comparator triggers Timer1 input capture
+	 * ACIS1:0 = 10 falling edge with bandgap / 11 rising edge with AIN0
+	 */
+#if (OVERCURRENT_USE_BANDGAP_REFERENCE != DISABLE)
+	ANALOG_COMPARATOR_CONTROL_REGISTER = (1<<ACBG) | (1<<ACIS1);
+#else
+	ANALOG_COMPARATOR_CONTROL_REGISTER = (1<<ACIS1) | (1<<ACIS0);
+#endif
+
+#if (OVERCURRENT_LATENCY_MEASUREMENT != DISABLE)
+	/*Timer1 counts the cycles from the capture to the disconnection*/
+	Timer_startCycleCounter();
+	ANALOG_COMPARATOR_CONTROL_REGISTER |= (1<<ACIC);
+
+	/*Input capture edge has to follow the comparator output edge*/
+#if (OVERCURRENT_USE_BANDGAP_REFERENCE != DISABLE)
+	CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, ICES1);
+#else
+	SET_BIT(TIMER1_CONTROL_REGIRSTER_B, ICES1);
+#endif
+#endif
+
+	Overcurrent_enableComparatorInterrupt();
+
+#endif /*OVERCURRENT_FAST_PATH*/
+
+}/*End of Overcurrent_init*/
+
+/***************************************************************************************************
+ * [Function Name]: Overcurrent_update
+ *
+ * [Description]:  Function of the slow path, must be called every control tick
+ *                 - Sample the current sense channel
+ *                 - Accumulate I^2 - In^2 while above the nominal current and
+ *                   cool down while below it, trip when reaching i2t_limit
+ *                 - After a trip retry up to max_retries then latch the fault
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Overcurrent_update(void)
+{
+	uint32 square;
+
+	if(g_config_Ptr == NULL_PTR)
+	{
+		return;
+	}
+
+#if (OVERCURRENT_SLOW_PATH != DISABLE)
+	g_current = ADC_readChannel(g_config_Ptr->adc_channel);
+	square = (uint32)g_current * g_current;
+
+	if(square > g_nominalSquare)
+	{
+		g_i2tAccumulator += square - g_nominalSquare;
+	}
+	else if( (g_nominalSquare - square) < g_i2tAccumulator )
+	{
+		g_i2tAccumulator -= g_nominalSquare - square;
+	}
+	else
+	{
+		g_i2tAccumulator = 0;
+	}
+#else
+	(void)square;
+#endif
+
+	switch(g_state)
+	{
+	case OVERCURRENT_OK:
+
+#if (OVERCURRENT_SLOW_PATH != DISABLE)
+		if(g_i2tAccumulator >= g_config_Ptr->i2t_limit)
+		{
+			Overcurrent_trip();
+			break;
+		}
+#endif
+
+		if(g_healthyTicks < OVERCURRENT_HEALTHY_TICKS_TO_RESET_RETRIES)
+		{
+			g_healthyTicks++;
+		}
+		else
+		{
+			g_retries = 0;
+		}
+		break;
+
+	case OVERCURRENT_TRIPPED:
+
+		if(g_retries >= g_config_Ptr->max_retries)
+		{
+			g_state = OVERCURRENT_LATCHED;
+		}
+		else if(g_retryTicks < g_config_Ptr->retry_delay_ticks)
+		{
+			g_retryTicks++;
+		}
+		else
+		{
+			/*Retry with half of the thermal budget already used*/
+			g_retries++;
+			g_retryTicks = 0;
+			g_healthyTicks = 0;
+			g_i2tAccumulator = (g_config_Ptr->i2t_limit) / 2;
+			g_state = OVERCURRENT_OK;
+			Overcurrent_reconnectPwm();
+			Overcurrent_enableComparatorInterrupt();
+		}
+		break;
+
+	case OVERCURRENT_LATCHED:
+		/*Only Overcurrent_clearFault can leave this state*/
+		break;
+	}
+
+}/*End of Overcurrent_update*/
+
+/***************************************************************************************************
+ * [Function Name]: Overcurrent_trip
+ *
+ * [Description]:  Function to disconnect the PWM outputs by software
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Overcurrent_trip(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	Overcurrent_disconnectPwm();
+#if (OVERCURRENT_FAST_PATH != DISABLE)
+	ANALOG_COMPARATOR_CONTROL_REGISTER &= ~(1<<ACIE);
+#endif
+	if(g_state == OVERCURRENT_OK)
+	{
+		g_state = OVERCURRENT_TRIPPED;
+		g_tripsCount++;
+	}
+	SREG = sreg;
+
+	g_retryTicks = 0;
+
+}/*End of Overcurrent_trip*/
+
+/***************************************************************************************************
+ * [Function Name]: Overcurrent_clearFault
+ *
+ * [Description]:  Function to clear a latched fault and reconnect the PWM outputs
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Overcurrent_clearFault(void)
+{
+	g_i2tAccumulator = 0;
+	g_retries = 0;
+	g_retryTicks = 0;
+	g_healthyTicks = 0;
+	g_state = OVERCURRENT_OK;
+
+	Overcurrent_reconnectPwm();
+	Overcurrent_enableComparatorInterrupt();
+
+}/*End of Overcurrent_clearFault*/
+
+Overcurrent_State Overcurrent_getState(void)
+{
+	return g_state;
+}
+
+uint16 Overcurrent_getCurrent(void)
+{
+	return g_current;
+}
+
+uint16 Overcurrent_getTripLatency(void)
+{
+	uint16 latency;
+	uint8 sreg = SREG;
+
+	cli();
+	latency = g_tripLatency;
+	SREG = sreg;
+
+	return latency;
+}
+
+uint16 Overcurrent_getTripsCount(void)
+{
+	uint16 count;
+	uint8 sreg = SREG;
+
+	cli();
+	count = g_tripsCount;
+	SREG = sreg;
+
+	return count;
+}
@@ -0,0 +1,146 @@
+/**********************************************************************************
+ * [FILE NAME]: overcurrent.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                motor overcurrent protection.
+ *                - Fast path: the analog comparator interrupt disconnects the
+ *                  PWM outputs (COM bits) without the main loop
+ *                - Slow path: the current sense ADC channel is sampled every
+ *                  control tick for I^2t accumulation and retry/latch policy
+ *
+ *                AIN1 is PB3 which is also OC0, when the fast path is enabled
+ *                the motors must use OC1A, OC1B or OC2 for their PWM.
+ *
+ ***********************************************************************************/
+
+#ifndef OVERCURRENT_H_
+#define OVERCURRENT_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "timers.h"
+#include "adc.h"
+#include "DCmotor.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*
+ * The fast path needs AIN1 (PB3), the OC0 output of the motor of this board:
+ * disabled here, enable it on a board with the PWM on OC1A, OC1B or OC2.
+ * Trip latency from the comparator edge to the write of TCCR0, counted from
+ * the instruction timings, not measured: 2 cycles of synchronization of ACO,
+ * 4 of the interrupt response (up to 4 more to end a multi-cycle
+ * instruction), 3 of the vector jump, about 16 of the prologue and 6 of the
+ * read-modify-write: about 31 cycles, under 4us at 8Mhz, plus the longest
+ * section with the interrupts disabled. OVERCURRENT_LATENCY_MEASUREMENT
+ * measures it on the target, Tools/overcurrent_check.c on the host
+ * The slow path reacts at the next control tick, 4ms
+ */
+#ifndef OVERCURRENT_FAST_PATH
+#define OVERCURRENT_FAST_PATH                     DISABLE
+#endif
+#define OVERCURRENT_SLOW_PATH                     ENABLE
+
+/*
+ * Use the internal 1.23V bandgap as positive comparator input, the current
+ * sense voltage is connected to AIN1 and the trip happens when it goes above
+ * the bandgap (comparator output falls).
+ * If disabled the sense voltage is connected to AIN0 and the trip level to AIN1
+ * (comparator output rises).
+ */
+#define OVERCURRENT_USE_BANDGAP_REFERENCE         ENABLE
+
+/*
+ * The comparator also triggers the Timer1 input capture so ICR1 holds the
+ * cycle of the comparator edge, the ISR reads TCNT1 just after the PWM is
+ * disconnected. Overcurrent_init starts Timer1 as cycle counter
+ * (Timer_startCycleCounter): not with the BLDC driver
+ */
+#define OVERCURRENT_LATENCY_MEASUREMENT           ENABLE
+
+/*Ticks without any trip to forget the previous retries*/
+#define OVERCURRENT_HEALTHY_TICKS_TO_RESET_RETRIES   1000
+
+#define ANALOG_COMPARATOR_CONTROL_REGISTER        ACSR
+#define ANALOG_COMPARATOR_DIRECTION_PORT          DDRB
+#define ANALOG_COMPARATOR_DATA_PORT               PORTB
+#define ANALOG_COMPARATOR_AIN0_PIN                PB2
+#define ANALOG_COMPARATOR_AIN1_PIN                PB3
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	OVERCURRENT_OK, OVERCURRENT_TRIPPED, OVERCURRENT_LATCHED
+
+}Overcurrent_State;
+
+typedef struct
+{
+	uint8  adc_channel;        /* ADC channel of the current sense amplifier */
+	uint16 nominal_current;    /* ADC counts allowed continuously */
+	uint32 i2t_limit;          /* accumulated (I^2 - In^2) before tripping */
+	uint16 retry_delay_ticks;  /* control ticks between a trip and the retry */
+	uint8  max_retries;        /* retries before latching the fault, 0 latch at once */
+	uint8  pwm_channels_mask;  /* (1<<DcMotor_PwmChannel) of the channels to disconnect */
+
+}Overcurrent_ConfigType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to initialize the overcurrent protection
+ *              The timers must be initialized before, the COM bits configured
+ *              at this moment are the ones restored after a retry
+ */
+void Overcurrent_init(const Overcurrent_ConfigType * Config_Ptr);
+
+/*
+ * Description: Function of the slow path, must be called every control tick
+ *              from the same context using the ADC (main loop)
+ */
+void Overcurrent_update(void);
+
+/*
+ * Description: Function to disconnect the PWM outputs by software
+ */
+void Overcurrent_trip(void);
+
+/*
+ * Description: Function to clear a latched fault and reconnect the PWM outputs
+ */
+void Overcurrent_clearFault(void);
+
+/*
+ * Description: Function to get the state of the protection
+ */
+Overcurrent_State Overcurrent_getState(void);
+
+/*
+ * Description: Function to get the last current sample in ADC counts
+ */
+uint16 Overcurrent_getCurrent(void);
+
+/*
+ * Description: Function to get the cycles between the comparator edge and
+ *              the PWM disconnection of the last fast trip
+ */
+uint16 Overcurrent_getTripLatency(void);
+
+/*
+ * Description: Function to get the number of trips since the initialization
+ */
+uint16 Overcurrent_getTripsCount(void);
+
+#endif /* OVERCURRENT_H_ */
@@ -0,0 +1,134 @@
+/**********************************************************************************
+ * [FILE NAME]: power.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the power manager.
+ *
+ ***********************************************************************************/
+
+#include"power.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Written by the tick interrupt, read and cleared with the interrupts disabled */
+volatile uint8 g_power_ticks = 0;
+
+static uint16 g_powerPeriod = 1;
+static uint32 g_powerSleepCounts = 0;
+static uint16 g_powerUtilization = POWER_UTILIZATION_FULL;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: compute the utilization once the window is over, with the
+ *              interrupts disabled
+ */
+static void Power_closeWindow(void)
+{
+	uint8 ticks = g_power_ticks;
+	uint32 window;
+
+	if(ticks < POWER_WINDOW_TICKS)
+	{
+		return;
+	}
+
+	g_power_ticks = 0;
+	window = (uint32)ticks * g_powerPeriod;
+	if(g_powerSleepCounts > window)
+	{
+		g_powerSleepCounts = window;
+	}
+	g_powerUtilization = (uint16)((window - g_powerSleepCounts) * POWER_UTILIZATION_FULL / window);
+	g_powerSleepCounts = 0;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void Power_init(void)
+{
+	uint8 sreg = SREG;
+
+	g_powerPeriod = (uint16)POWER_TIME_TOP + 1;
+	g_powerSleepCounts = 0;
+	g_powerUtilization = POWER_UTILIZATION_FULL;
+
+	cli();
+	g_power_ticks = 0;
+	SREG = sreg;
+}
+
+/***************************************************************************************************
+ * [Function Name]: Power_sleep
+ *
+ * [Description]:  Function to sleep until an interrupt has run
+ *                 - The interrupts are enabled by the instruction before the
+ *                   sleep, so an interrupt pending since the check of the work
+ *                   wakes the CPU at once instead of being lost
+ *                 - The time asleep is added to the window, up to the wake up:
+ *                   woken by the tick, the sleep ends at the compare match
+ *                   (the counter restarts from 0) and its vector is awake
+ *                   time with the rest of the loop until the next sleep.
+ *                   The other vectors waking the CPU (button, ADC, UART,
+ *                   EEPROM) leave no time stamp, their few cycles are counted
+ *                   asleep
+ *                 - The utilization is computed once the window is over, by
+ *                   Power_getUtilization too when the CPU never sleeps
+ *
+ * [Args]:         mode
+ *
+ * [In]            mode: -POWER_IDLE, POWER_ADC_NOISE_REDUCTION (the tick timer
+ *                        stops, its sleeps are counted as time awake)
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Power_sleep(Power_ModeType mode)
+{
+	uint8 ticks = g_power_ticks;
+	uint8 start;
+	uint8 end;
+
+	set_sleep_mode(mode);
+	start = POWER_TIME_COUNTER;
+	sleep_enable();
+	sei();
+	sleep_cpu();
+	sleep_disable();
+	cli();
+	end = POWER_TIME_COUNTER;
+
+	if(ticks != g_power_ticks)
+	{
+		/* woken by the tick, at the compare match */
+		g_powerSleepCounts += (uint16)(g_powerPeriod - start);
+	}
+	else
+	{
+		/* at most one compare match in between, the tick interrupt wakes the CPU */
+		g_powerSleepCounts += (end >= start) ? (uint8)(end - start) : (uint16)(end + g_powerPeriod - start);
+	}
+	Power_closeWindow();
+
+}/*End of Power_sleep*/
+
+uint16 Power_getUtilization(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	Power_closeWindow();
+	SREG = sreg;
+
+	return g_powerUtilization;
+}
@@ -0,0 +1,100 @@
+/**********************************************************************************
+ * [FILE NAME]: power.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                power manager: the CPU sleeps whenever the main loop has no
+ *                work, any interrupt wakes it (tick, button, ADC, UART).
+ *                - Idle: only the CPU stops, the timers, the PWM and the
+ *                  USART run, the wake up costs a few cycles
+ *                - ADC noise reduction: clkI/O stops too, for the ADC
+ *                  samples only as the PWM output holds its level and the
+ *                  tick timer stops during the conversion
+ *                The sleeps are measured on the counter of the system tick,
+ *                every tick wakes the CPU so a sleep is always shorter than
+ *                one period of it, the CPU utilization is the time awake of
+ *                the last POWER_WINDOW_TICKS ticks: from the wake up, the tick
+ *                vector included, to the next sleep.
+ *
+ ***********************************************************************************/
+
+#ifndef POWER_H_
+#define POWER_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Counter and compare value of the system tick, Timer2 in compare mode*/
+#define POWER_TIME_COUNTER                       TCNT2
+#define POWER_TIME_TOP                           OCR2
+
+/*Ticks of one measurement of the utilization, 1s with the 4ms tick*/
+#define POWER_WINDOW_TICKS                       250
+
+/*Utilization of a CPU never sleeping*/
+#define POWER_UTILIZATION_FULL                   1000
+
+/*Sleep of the ADC samples, POWER_IDLE keeps the PWM running*/
+#define POWER_ADC_SLEEP_MODE                     POWER_IDLE
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	POWER_IDLE = SLEEP_MODE_IDLE,
+	POWER_ADC_NOISE_REDUCTION = SLEEP_MODE_ADC
+
+}Power_ModeType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to start the measurement, after the tick timer is set
+ */
+void Power_init(void);
+
+/*
+ * Description: Function to sleep until an interrupt has run
+ *              Called with the interrupts disabled after checking that no work
+ *              is pending, returns with them disabled
+ */
+void Power_sleep(Power_ModeType mode);
+
+/*
+ * Description: Function to get the CPU utilization of the last window,
+ *              per mille of the time awake (POWER_UTILIZATION_FULL at start)
+ */
+uint16 Power_getUtilization(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Only for Power_tick */
+extern volatile uint8 g_power_ticks;
+
+/*******************************************************************************
+ *                      Inline Functions                                       *
+ *******************************************************************************/
+
+/*
+ * Description: Function to count the ticks of the window, from the tick interrupt
+ */
+static inline void Power_tick(void)
+{
+	g_power_ticks++;
+}
+
+#endif /* POWER_H_ */
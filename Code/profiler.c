@@ -0,0 +1,217 @@
+/**********************************************************************************
+ * [FILE NAME]: profiler.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the profiler of the main loop, empty when
+ *                PROFILER is disabled.
+ *
+ ***********************************************************************************/
+
+#include"profiler.h"
+
+#if (PROFILER != DISABLE)
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static Profiler_EventType g_profilerTrace[PROFILER_TRACE_SIZE];
+static volatile uint8 g_profilerHead = 0;
+static volatile uint8 g_profilerCount = 0;
+static volatile bool g_profilerRunning = FALSE;
+static volatile uint8 g_profilerOverflows = 0;
+static uint8 g_profilerDumpIndex = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static void Profiler_overflow(void)
+{
+	g_profilerOverflows++;
+}
+
+static uint8 * Profiler_putHex(uint8 * Line_Ptr, uint32 value, uint8 digits)
+{
+	uint8 digit;
+
+	while(digits != 0)
+	{
+		digits--;
+		digit = (uint8)(value >> (4 * digits)) & 0X0F;
+		*Line_Ptr++ = (digit < 10) ? ('0' + digit) : ('A' + digit - 10);
+	}
+
+	return Line_Ptr;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void Profiler_init(void)
+{
+	uint8 sreg = SREG;
+
+	Timer_setCallBack(Profiler_overflow, Timer1);
+	Timer_startCycleCounter();
+
+	cli();
+	g_profilerOverflows = 0;
+	TIMSK |= (1<<TOIE1);
+	SREG = sreg;
+
+	Profiler_start();
+}
+
+void Profiler_start(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	g_profilerHead = 0;
+	g_profilerCount = 0;
+	g_profilerDumpIndex = 0;
+	g_profilerRunning = TRUE;
+	SREG = sreg;
+}
+
+void Profiler_stop(void)
+{
+	g_profilerRunning = FALSE;
+}
+
+/***************************************************************************************************
+ * [Function Name]: Profiler_record
+ *
+ * [Description]:  Function called by the markers to write one in the ring
+ *                 - The time stamp is read first, the rest of the marker is
+ *                   counted in the code before an entry and after an exit
+ *                 - An overflow not served yet is in the flag while the
+ *                   counter is low, the interrupts are disabled
+ *
+ * [Args]:         marker
+ *
+ * [In]            marker: -Profiler_ID, | PROFILER_EXIT_FLAG for an exit
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Profiler_record(uint8 marker)
+{
+	uint8 sreg = SREG;
+	uint16 low;
+	uint8 high;
+	Profiler_EventType *event_Ptr;
+
+	cli();
+	low = TIMER_CYCLE_COUNTER_REGISTER;
+	high = g_profilerOverflows;
+	if( BIT_IS_SET(TIFR, TOV1) && (low < 0X8000) )
+	{
+		high++;
+	}
+
+	if(g_profilerRunning)
+	{
+		event_Ptr = &g_profilerTrace[g_profilerHead];
+		event_Ptr->marker = marker;
+		event_Ptr->time_high = high;
+		event_Ptr->time_low = low;
+		g_profilerHead = (g_profilerHead + 1) & PROFILER_TRACE_MASK;
+		if(g_profilerCount < PROFILER_TRACE_SIZE)
+		{
+			g_profilerCount++;
+		}
+	}
+	SREG = sreg;
+
+}/*End of Profiler_record*/
+
+bool Profiler_isFull(void)
+{
+	return (g_profilerCount == PROFILER_TRACE_SIZE);
+}
+
+uint8 Profiler_getCount(void)
+{
+	return g_profilerCount;
+}
+
+bool Profiler_getEvent(uint8 index, Profiler_EventType * Event_Ptr)
+{
+	uint8 sreg = SREG;
+	bool found = FALSE;
+
+	cli();
+	if(index < g_profilerCount)
+	{
+		/* the oldest marker is count markers before the head */
+		*Event_Ptr = g_profilerTrace[(uint8)(g_profilerHead - g_profilerCount + index) & PROFILER_TRACE_MASK];
+		found = TRUE;
+	}
+	SREG = sreg;
+
+	return found;
+}
+
+/***************************************************************************************************
+ * [Function Name]: Profiler_dumpPoll
+ *
+ * [Description]:  Function to send the stopped ring on the UART
+ *                 - "P<marker: 2 hex digits><time: 6 hex digits>\r\n", the
+ *                   oldest first
+ *                 - As many lines as the TX buffer takes, the next call goes on
+ *                   from the first line left, a pass of the loop can be long
+ *                 ASCII like the dump of the capture, Tools/profile_report.c
+ *                 keeps the lines starting with 'P' only
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE once every marker is sent, FALSE otherwise
+ ***************************************************************************************************/
+bool Profiler_dumpPoll(void)
+{
+	uint8 line[PROFILER_DUMP_LINE_SIZE];
+	uint8 *line_Ptr;
+	Profiler_EventType event;
+
+	if(g_profilerRunning)
+	{
+		return FALSE;
+	}
+
+	while(Profiler_getEvent(g_profilerDumpIndex, &event))
+	{
+		line_Ptr = line;
+		*line_Ptr++ = 'P';
+		line_Ptr = Profiler_putHex(line_Ptr, event.marker, 2);
+		line_Ptr = Profiler_putHex(line_Ptr, ((uint32)event.time_high << 16) | event.time_low, 6);
+		*line_Ptr++ = '\r';
+		*line_Ptr++ = '\n';
+
+		if(!UART_send(line, PROFILER_DUMP_LINE_SIZE))
+		{
+			return FALSE;
+		}
+		g_profilerDumpIndex++;
+	}
+
+	return TRUE;
+
+}/*End of Profiler_dumpPoll*/
+
+bool Profiler_isDumpPending(void)
+{
+	return (!g_profilerRunning) && (g_profilerDumpIndex < g_profilerCount);
+}
+
+#endif /*PROFILER*/
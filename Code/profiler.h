@@ -0,0 +1,147 @@
+/**********************************************************************************
+ * [FILE NAME]: profiler.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                profiler of the main loop. The functions worth watching have
+ *                PROFILE_ENTER/PROFILE_EXIT markers, every marker writes its
+ *                id and a Timer1 time stamp in a RAM ring:
+ *                - Timer1 runs as cycle counter, its overflows extend the time
+ *                  stamps to 24 bits (2s at 8Mhz), the LCD writes take ms
+ *                - The ring keeps the last PROFILER_TRACE_SIZE markers, it is
+ *                  stopped to read or dump it
+ *                - Tools/profile_report.c rebuilds the calls from the dump and
+ *                  gives the flat profile: calls, total and self time
+ *                The interrupts are counted in the function they interrupt.
+ *                With PROFILER disabled the markers are empty, nothing of the
+ *                profiler is left in the firmware.
+ *
+ ***********************************************************************************/
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "timers.h"
+#include "uart.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define ENABLE                                   TRUE
+#define DISABLE                                  FALSE
+
+#define PROFILER                                 DISABLE
+
+/*Markers kept in the ring, 4 bytes of RAM each, power of 2*/
+#define PROFILER_TRACE_SIZE                      64
+#define PROFILER_TRACE_MASK                      (PROFILER_TRACE_SIZE - 1)
+
+/*Marker of an exit, the id of an entry without it*/
+#define PROFILER_EXIT_FLAG                       0X80
+
+/*Dump line: 'P', marker and time stamp in hex, "\r\n"*/
+#define PROFILER_DUMP_LINE_SIZE                  11
+
+#if ((PROFILER_TRACE_SIZE & PROFILER_TRACE_MASK) != 0) || (PROFILER_TRACE_SIZE > 128)
+#error "PROFILER_TRACE_SIZE must be a power of 2 up to 128"
+#endif
+
+#if (PROFILER != DISABLE)
+
+/*First and last statements of the profiled code*/
+#define PROFILE_ENTER(id)    Profiler_record((uint8)(id))
+#define PROFILE_EXIT(id)     Profiler_record((uint8)(id) | PROFILER_EXIT_FLAG)
+
+#else
+
+#define PROFILE_ENTER(id)
+#define PROFILE_EXIT(id)
+
+#endif /*PROFILER*/
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*Must match the names of Tools/profile_report.c*/
+typedef enum
+{
+	PROFILER_ID_LOOP, PROFILER_ID_CONTROL, PROFILER_ID_SAMPLE, PROFILER_ID_UTILIZATION,
+	PROFILER_ID_BUTTON, PROFILER_ID_COMMANDS, PROFILER_ID_TELEMETRY, PROFILER_ID_SLEEP,
+	PROFILER_ID_ADC_READ, PROFILER_ID_TIMER_COMPARE,
+	PROFILER_ID_LCD_COMMAND, PROFILER_ID_LCD_CHARACTER, PROFILER_ID_LCD_STRING,
+	PROFILER_ID_LCD_INTEGER, PROFILER_ID_ITOA,
+	PROFILER_ID_COUNT
+
+}Profiler_ID;
+
+typedef struct
+{
+	uint8 marker;          /* Profiler_ID, | PROFILER_EXIT_FLAG for an exit */
+	uint8 time_high;       /* Timer1 overflows */
+	uint16 time_low;       /* Timer1 counter, cycles */
+
+}Profiler_EventType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+#if (PROFILER != DISABLE)
+
+/*
+ * Description: Function to start Timer1 as cycle counter with its overflow
+ *              interrupt and start the recording, after IsrInstr_init
+ *              Not with the benchmark firmware, it uses the overflows too
+ */
+void Profiler_init(void);
+
+/*
+ * Description: Function to clear the ring and start the recording
+ */
+void Profiler_start(void);
+
+/*
+ * Description: Function to stop the recording, the ring keeps its markers
+ */
+void Profiler_stop(void);
+
+/*
+ * Description: Function called by the markers to write one in the ring
+ */
+void Profiler_record(uint8 marker);
+
+/*
+ * Description: Function to know if the ring is full, the oldest markers are
+ *              overwritten from then on while recording
+ */
+bool Profiler_isFull(void);
+
+/*
+ * Description: Functions to read the ring, index 0 is the oldest marker
+ *              Returns FALSE if index is out of the ring
+ */
+uint8 Profiler_getCount(void);
+bool Profiler_getEvent(uint8 index, Profiler_EventType * Event_Ptr);
+
+/*
+ * Description: Function to send the stopped ring on the UART, the lines the
+ *              TX buffer takes, Returns TRUE once every marker is sent
+ */
+bool Profiler_dumpPoll(void);
+
+/*
+ * Description: Function to check if the stopped ring has lines left to dump
+ */
+bool Profiler_isDumpPending(void);
+
+#endif /*PROFILER*/
+
+#endif /* PROFILER_H_ */
@@ -0,0 +1,208 @@
+/**********************************************************************************
+ * [FILE NAME]: rate_groups.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the rate groups run from the overflow of Timer0.
+ *
+ ***********************************************************************************/
+
+#include"rate_groups.h"
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	RATE_GROUP_IDLE, RATE_GROUP_PENDING, RATE_GROUP_RUNNING
+
+}RateGroups_StateType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static const RateGroups_ConfigType *g_rateGroupsConfig = NULL_PTR;
+
+/* Timer0 periods since the start, the high part of the 24-bit time */
+static volatile uint16 g_rateGroupsTicks = 0;
+
+/* Fastest group running, the nested overflows run the faster ones only */
+static volatile uint8 g_rateGroupsActive = RATE_GROUPS_NONE;
+
+static volatile uint8 g_rateGroupsState[RATE_GROUPS_MAX];
+static uint16 g_rateGroupsCounter[RATE_GROUPS_MAX];
+static uint16 g_rateGroupsRelease[RATE_GROUPS_MAX]; /* period of the last release */
+
+static volatile RateGroups_StatsType g_rateGroupsStats[RATE_GROUPS_MAX];
+static SharedState_SequenceType g_rateGroupsSequence = 0; /* publications of the statistics */
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: time in Timer0 counts with the interrupts disabled, an
+ *              overflow not served yet is in the flag while the counter is low
+ */
+static uint32 RateGroups_now(void)
+{
+	uint8 counts = TIMER0_INITIAL_VALUE_REGISTER;
+	uint16 ticks = g_rateGroupsTicks;
+
+	if( BIT_IS_SET(TIMER0_INTERRUPT_FLAG_REGISTER, TOV0) && (counts < 0X80) )
+	{
+		ticks++;
+	}
+
+	return ((uint32)ticks << 8) | counts;
+}
+
+static void RateGroups_runTasks(const RateGroups_GroupType * Group_Ptr)
+{
+	uint8 task;
+
+	for(task = 0; task < Group_Ptr->tasksCount; task++)
+	{
+		(*Group_Ptr->tasks[task])();
+	}
+}
+
+static void RateGroups_recordTime(uint8 group, uint32 time)
+{
+	uint16 time16 = (time > RATE_GROUPS_TIME_MAX) ? RATE_GROUPS_TIME_MAX : (uint16)time;
+
+	g_rateGroupsStats[group].runs++;
+	if(time16 > g_rateGroupsStats[group].maxTime)
+	{
+		g_rateGroupsStats[group].maxTime = time16;
+	}
+}
+
+/***************************************************************************************************
+ * [Function Name]: RateGroups_baseTick
+ *
+ * [Description]:  Call back of the Timer0 overflow
+ *                 - Run the base group with the interrupts disabled, a period
+ *                   missed meanwhile is its overrun
+ *                 - Release the slower groups whose divider is over
+ *                 - Run the pending groups faster than the one this overflow
+ *                   interrupted, fastest first, with the interrupts enabled
+ *                   The faster groups released during one of them are run by
+ *                   the nested overflows, the slower ones after it here
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void RateGroups_baseTick(void)
+{
+	const RateGroups_GroupType *groups_Ptr = g_rateGroupsConfig->groups;
+	uint8 count = g_rateGroupsConfig->groupsCount;
+	uint8 preempted = g_rateGroupsActive;
+	uint8 group;
+	uint32 start;
+
+	g_rateGroupsTicks++;
+
+	RateGroups_runTasks(&groups_Ptr[0]);
+	RateGroups_recordTime(0, TIMER0_INITIAL_VALUE_REGISTER);
+	if(BIT_IS_SET(TIMER0_INTERRUPT_FLAG_REGISTER, TOV0))
+	{
+		g_rateGroupsStats[0].overruns++;
+	}
+
+	for(group = 1; group < count; group++)
+	{
+		if(++g_rateGroupsCounter[group] >= groups_Ptr[group].divider)
+		{
+			g_rateGroupsCounter[group] = 0;
+			if(g_rateGroupsState[group] != RATE_GROUP_IDLE)
+			{
+				g_rateGroupsStats[group].overruns++;
+			}
+			else
+			{
+				g_rateGroupsState[group] = RATE_GROUP_PENDING;
+				g_rateGroupsRelease[group] = g_rateGroupsTicks;
+			}
+		}
+	}
+	SHARED_STATE_PUBLISH(g_rateGroupsSequence);
+
+	for(group = 1; (group < count) && (group < preempted); group++)
+	{
+		if(g_rateGroupsState[group] != RATE_GROUP_PENDING)
+		{
+			continue;
+		}
+
+		g_rateGroupsState[group] = RATE_GROUP_RUNNING;
+		g_rateGroupsActive = group;
+
+		sei();
+		RateGroups_runTasks(&groups_Ptr[group]);
+		cli();
+
+		/* from the release, the time waiting for the faster groups included */
+		start = (uint32)g_rateGroupsRelease[group] << 8;
+		RateGroups_recordTime(group, (RateGroups_now() - start) & RATE_GROUPS_TIME_MASK);
+		SHARED_STATE_PUBLISH(g_rateGroupsSequence);
+		g_rateGroupsState[group] = RATE_GROUP_IDLE;
+	}
+
+	g_rateGroupsActive = preempted;
+
+}/*End of RateGroups_baseTick*/
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void RateGroups_init(const RateGroups_ConfigType * Config_Ptr)
+{
+	uint8 sreg = SREG;
+	uint8 group;
+
+	cli();
+	g_rateGroupsConfig = Config_Ptr;
+	g_rateGroupsTicks = 0;
+	g_rateGroupsActive = RATE_GROUPS_NONE;
+	for(group = 0; group < RATE_GROUPS_MAX; group++)
+	{
+		g_rateGroupsState[group] = RATE_GROUP_IDLE;
+		g_rateGroupsCounter[group] = 0;
+		g_rateGroupsStats[group].runs = 0;
+		g_rateGroupsStats[group].overruns = 0;
+		g_rateGroupsStats[group].maxTime = 0;
+	}
+
+	Timer_setCallBack(RateGroups_baseTick, Timer0);
+	CLEAR_FLAG(TIMER0_INTERRUPT_FLAG_REGISTER, TOV0);
+	SET_BIT(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_OUTPUT_OVERFLOW_INTERRUPT);
+	SREG = sreg;
+}
+
+void RateGroups_stop(void)
+{
+	CLEAR_BIT(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_OUTPUT_OVERFLOW_INTERRUPT);
+}
+
+bool RateGroups_getStats(uint8 group, RateGroups_StatsType * Stats_Ptr)
+{
+	if( (g_rateGroupsConfig == NULL_PTR) || (group >= g_rateGroupsConfig->groupsCount) )
+	{
+		return FALSE;
+	}
+
+	SHARED_STATE_READ(g_rateGroupsSequence, *Stats_Ptr = g_rateGroupsStats[group]);
+
+	return TRUE;
+}
@@ -0,0 +1,99 @@
+/**********************************************************************************
+ * [FILE NAME]: rate_groups.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                rate groups: tables of tasks run at rates divided from the
+ *                Timer0 overflow, the period of its PWM.
+ *                - The base group (first one) runs in the overflow interrupt
+ *                  with the interrupts disabled, every period
+ *                - The slower groups are released every divider periods and
+ *                  run from the same interrupt with the interrupts enabled,
+ *                  a faster group released meanwhile preempts them in the
+ *                  nested overflow interrupt, a group never preempts itself
+ *                  or a faster one, so at most one interrupt frame per group
+ *                - A group released while still pending or running is an
+ *                  overrun, the release is dropped and counted
+ *                The tasks of the slower groups run like the main loop with
+ *                the interrupts enabled: EventQueue_postFromMain, and the
+ *                data they share with the main loop belongs to one side.
+ *
+ ***********************************************************************************/
+
+#ifndef RATE_GROUPS_H_
+#define RATE_GROUPS_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "timers.h"
+#include "shared_state.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define RATE_GROUPS_MAX                          4
+
+/*No group running, the main loop was interrupted*/
+#define RATE_GROUPS_NONE                         RATE_GROUPS_MAX
+
+/*Time of the statistics: Timer0 counts, 1us with F_CPU_8 at 8Mhz*/
+#define RATE_GROUPS_TIME_MAX                     0XFFFF
+#define RATE_GROUPS_TIME_MASK                    0XFFFFFFUL
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef void (*RateGroups_TaskType)(void);
+
+typedef struct
+{
+	uint16 divider;                     /* Timer0 periods between two releases, 1 for the base group */
+	const RateGroups_TaskType *tasks;   /* run in this order */
+	uint8 tasksCount;
+
+}RateGroups_GroupType;
+
+typedef struct
+{
+	const RateGroups_GroupType *groups; /* fastest first */
+	uint8 groupsCount;                  /* 1 to RATE_GROUPS_MAX */
+
+}RateGroups_ConfigType;
+
+typedef struct
+{
+	uint16 runs;
+	uint16 overruns;    /* base group: a period missed, others: release dropped */
+	uint16 maxTime;     /* base group: end in its period, others: release to end, Timer0 counts */
+
+}RateGroups_StatsType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to start the groups on the overflow of Timer0, which
+ *              must run already (Timer_init), the statistics are cleared
+ *              Config_Ptr must stay valid, the tables are not copied
+ */
+void RateGroups_init(const RateGroups_ConfigType * Config_Ptr);
+
+/*
+ * Description: Function to stop the releases, the groups running finish
+ */
+void RateGroups_stop(void);
+
+/*
+ * Description: Function to read the statistics of a group without masking
+ *              the interrupts, Returns FALSE if the group doesn't exist
+ */
+bool RateGroups_getStats(uint8 group, RateGroups_StatsType * Stats_Ptr);
+
+#endif /* RATE_GROUPS_H_ */
@@ -0,0 +1,68 @@
+/**********************************************************************************
+ * [FILE NAME]: shared_state.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Consistent snapshots of the multi-byte values shared between
+ *                the interrupts and the main loop without disabling the
+ *                interrupts, the 8-bit core reads and writes them one byte at
+ *                a time:
+ *                - Written by an interrupt, read by the main loop: sequence
+ *                  counter, the interrupt increments it after writing, the
+ *                  main loop copies the values again if it changed meanwhile
+ *                - Written by the main loop, read by an interrupt: two slots,
+ *                  the main loop fills the one the interrupt doesn't read then
+ *                  flips the index, one byte written at once
+ *                An interrupt isn't interrupted by the main loop, so it never
+ *                sees a copy in progress and never retries. The values are
+ *                volatile like the counter so their stores keep their order.
+ *                The writers of the main loop keep the interrupts disabled,
+ *                they are rare.
+ *
+ ***********************************************************************************/
+
+#ifndef SHARED_STATE_H_
+#define SHARED_STATE_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/* Writer, in the interrupt: after the last value is written */
+#define SHARED_STATE_PUBLISH(SEQUENCE)           ((SEQUENCE)++)
+
+/*
+ * Reader, in the main loop: run the copy statements until no interrupt
+ * published between the two reads of the counter
+ * A copy is a few cycles, 256 publications can't happen during it
+ */
+#define SHARED_STATE_READ(SEQUENCE, statement) \
+	do \
+	{ \
+		uint8 sharedStateBegin; \
+		do \
+		{ \
+			sharedStateBegin = (SEQUENCE); \
+			statement; \
+		} while(sharedStateBegin != (SEQUENCE)); \
+	} while(0)
+
+/*
+ * Two slots written by the main loop: it writes SHARED_STATE_WRITE_SLOT,
+ * then flips, the interrupt reads the slot of the index
+ */
+#define SHARED_STATE_WRITE_SLOT(INDEX)           ((uint8)((INDEX) ^ 1))
+#define SHARED_STATE_FLIP(INDEX)                 ((INDEX) ^= 1)
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+/*Counter of the publications of an interrupt, or index of two slots*/
+typedef volatile uint8 SharedState_SequenceType;
+
+#endif /* SHARED_STATE_H_ */
@@ -0,0 +1,163 @@
+/**********************************************************************************
+ * [FILE NAME]: telemetry.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the telemetry stream on the USART.
+ *
+ ***********************************************************************************/
+
+#include"telemetry.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static uint8 g_telemetryFields = TELEMETRY_DEFAULT_FIELDS;
+static uint8 g_telemetrySequence = 0;
+static uint16 g_telemetryDropped = 0;
+
+/* Written by the tick interrupt only */
+static volatile uint16 g_telemetryTicks = 0;
+static volatile uint8 g_telemetryPeriod = 0;
+/* Set by the tick interrupt, cleared by the main loop */
+static volatile bool g_telemetryDue = FALSE;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static uint8 * Telemetry_put16(uint8 * Frame_Ptr, uint16 value)
+{
+	Frame_Ptr[0] = (uint8)value;
+	Frame_Ptr[1] = (uint8)(value >> 8);
+
+	return Frame_Ptr + 2;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+void Telemetry_init(uint8 fields)
+{
+	g_telemetryFields = fields & TELEMETRY_FIELDS_ALL;
+	g_telemetrySequence = 0;
+	g_telemetryDropped = 0;
+	g_telemetryDue = FALSE;
+}
+
+void Telemetry_setFields(uint8 fields)
+{
+	g_telemetryFields = fields & TELEMETRY_FIELDS_ALL;
+}
+
+void Telemetry_tick(void)
+{
+	g_telemetryTicks++;
+	g_telemetryPeriod++;
+	if(g_telemetryPeriod >= TELEMETRY_PERIOD_TICKS)
+	{
+		g_telemetryPeriod = 0;
+		g_telemetryDue = TRUE;
+	}
+}
+
+bool Telemetry_isDue(void)
+{
+	if(!g_telemetryDue)
+	{
+		return FALSE;
+	}
+
+	g_telemetryDue = FALSE;
+
+	return TRUE;
+}
+
+/***************************************************************************************************
+ * [Function Name]: Telemetry_send
+ *
+ * [Description]:  Function to frame a sample and queue it in the UART
+ *                 - Header, the selected values, CRC-8 of all but the sync
+ *                 - The whole frame is queued or nothing, never waits for the line
+ *                 - The sequence counts the dropped frames too
+ *
+ * [Args]:         Sample_Ptr
+ *
+ * [In]            Sample_Ptr: Pointer to the values of the sample
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the frame was dropped (TX buffer full), TRUE otherwise
+ ***************************************************************************************************/
+bool Telemetry_send(const Telemetry_SampleType * Sample_Ptr)
+{
+	uint8 frame[TELEMETRY_MAX_FRAME_SIZE];
+	uint8 *frame_Ptr = frame;
+	uint8 fields = g_telemetryFields;
+	uint16 ticks;
+	uint8 sreg = SREG;
+
+	cli();
+	ticks = g_telemetryTicks;
+	SREG = sreg;
+
+	*frame_Ptr++ = TELEMETRY_SYNC;
+	*frame_Ptr++ = g_telemetrySequence;
+	*frame_Ptr++ = fields;
+	frame_Ptr = Telemetry_put16(frame_Ptr, ticks);
+
+	if(fields & TELEMETRY_FIELD_ADC)
+	{
+		frame_Ptr = Telemetry_put16(frame_Ptr, Sample_Ptr->adc);
+	}
+	if(fields & TELEMETRY_FIELD_DUTY)
+	{
+		*frame_Ptr++ = Sample_Ptr->duty;
+	}
+	if(fields & TELEMETRY_FIELD_DIRECTION)
+	{
+		*frame_Ptr++ = Sample_Ptr->direction;
+	}
+	if(fields & TELEMETRY_FIELD_SPEED)
+	{
+		frame_Ptr = Telemetry_put16(frame_Ptr, (uint16)Sample_Ptr->speed);
+	}
+	if(fields & TELEMETRY_FIELD_CURRENT)
+	{
+		frame_Ptr = Telemetry_put16(frame_Ptr, Sample_Ptr->current);
+	}
+	if(fields & TELEMETRY_FIELD_MEMORY)
+	{
+		frame_Ptr = Telemetry_put16(frame_Ptr, Sample_Ptr->stack);
+		frame_Ptr = Telemetry_put16(frame_Ptr, Sample_Ptr->ram_free);
+	}
+	if(fields & TELEMETRY_FIELD_SECTIONS)
+	{
+		frame_Ptr = Telemetry_put16(frame_Ptr, Sample_Ptr->data);
+		frame_Ptr = Telemetry_put16(frame_Ptr, Sample_Ptr->bss);
+		frame_Ptr = Telemetry_put16(frame_Ptr, Sample_Ptr->heap);
+	}
+
+	*frame_Ptr = Crc8_compute(&frame[1], (uint8)(frame_Ptr - &frame[1]), CRC8_INITIAL_VALUE);
+	frame_Ptr++;
+
+	g_telemetrySequence++;
+
+	if(!UART_send(frame, (uint8)(frame_Ptr - frame)))
+	{
+		g_telemetryDropped++;
+		return FALSE;
+	}
+
+	return TRUE;
+
+}/*End of Telemetry_send*/
+
+uint16 Telemetry_getDropped(void)
+{
+	return g_telemetryDropped;
+}
@@ -0,0 +1,119 @@
+/**********************************************************************************
+ * [FILE NAME]: telemetry.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                telemetry stream on the USART, one binary frame per sample:
+ *
+ *                | 0XA5 | sequence | fields | time stamp | values ... | CRC-8 |
+ *                   1        1         1         2          0:8        1
+ *
+ *                - sequence: +1 for every sample, also the dropped ones, so
+ *                  the gaps tell the lost frames
+ *                - fields: TELEMETRY_FIELD_x bits of the values that follow,
+ *                  in the order of the bits, the frame describes itself
+ *                - time stamp: system ticks (4ms) modulo 2^16
+ *                - CRC-8 (crc8.h) of all the bytes between the sync and the CRC
+ *                Multi-byte values are little endian.
+ *                The frame is queued whole in the UART or dropped, the main
+ *                loop never waits for the line (Tools/telemetry_decoder.c
+ *                turns the stream into CSV).
+ *
+ ***********************************************************************************/
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "uart.h"
+#include "crc8.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define TELEMETRY_SYNC                           0XA5
+
+#define TELEMETRY_FIELD_ADC                      (1<<0)   /* uint16, potentiometer */
+#define TELEMETRY_FIELD_DUTY                     (1<<1)   /* uint8,  compare value of the PWM */
+#define TELEMETRY_FIELD_DIRECTION                (1<<2)   /* uint8,  DcMotor_Direction */
+#define TELEMETRY_FIELD_SPEED                    (1<<3)   /* sint16, encoder counts per tick */
+#define TELEMETRY_FIELD_CURRENT                  (1<<4)   /* uint16, ADC counts of the current sense */
+#define TELEMETRY_FIELD_MEMORY                   (1<<5)   /* 2 uint16, deepest stack and free RAM, bytes */
+#define TELEMETRY_FIELD_SECTIONS                 (1<<6)   /* 3 uint16, sizes of .data, .bss and the heap, bytes */
+#define TELEMETRY_FIELDS_ALL                     0X7F
+
+#define TELEMETRY_DEFAULT_FIELDS                 TELEMETRY_FIELDS_ALL
+
+/*One sample every TELEMETRY_PERIOD_TICKS system ticks*/
+#define TELEMETRY_PERIOD_TICKS                   1
+
+#define TELEMETRY_HEADER_SIZE                    5
+#define TELEMETRY_MAX_VALUES_SIZE                18
+#define TELEMETRY_MAX_FRAME_SIZE                 (TELEMETRY_HEADER_SIZE + TELEMETRY_MAX_VALUES_SIZE + 1)
+
+#if (TELEMETRY_MAX_FRAME_SIZE > UART_TX_BUFFER_SIZE)
+#error "A telemetry frame must fit in the UART TX buffer"
+#endif
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint16 adc;
+	uint8 duty;
+	uint8 direction;
+	sint16 speed;
+	uint16 current;
+	uint16 stack;       /* memory_monitor.h */
+	uint16 ram_free;
+	uint16 data;
+	uint16 bss;
+	uint16 heap;
+
+}Telemetry_SampleType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to start the stream with a set of fields, the UART
+ *              must be initialized
+ */
+void Telemetry_init(uint8 fields);
+
+/*
+ * Description: Function to change the fields of the next frames
+ */
+void Telemetry_setFields(uint8 fields);
+
+/*
+ * Description: Function to count the time, called by the system tick interrupt
+ */
+void Telemetry_tick(void);
+
+/*
+ * Description: Function to know if a sample is due, from the main loop
+ *              Returns TRUE once per TELEMETRY_PERIOD_TICKS ticks
+ */
+bool Telemetry_isDue(void);
+
+/*
+ * Description: Function to frame a sample and queue it in the UART
+ *              Returns FALSE if the frame was dropped (TX buffer full)
+ */
+bool Telemetry_send(const Telemetry_SampleType * Sample_Ptr);
+
+/*
+ * Description: Function to get the number of dropped frames
+ */
+uint16 Telemetry_getDropped(void);
+
+#endif /* TELEMETRY_H_ */
@@ -10,11 +10,24 @@
  ***********************************************************************************/
 
 #include"timers.h"
-
-/* Global variables to hold the address of the call back function in the application */
+#include"event_queue.h"
+#include"isr_instrumentation.h"
+#include"profiler.h"
+#include"isr_bindings.h"
+
+/*
+ * Global variables to hold the address of the call back function in the application
+ * Only for the timers without a handler bound at build time (isr_bindings.h)
+ */
+#ifndef TIMER0_ISR_HANDLER
 static volatile void (*g_Timer0_callBackPtr)(void) = NULL_PTR;
+#endif
+#ifndef TIMER1_ISR_HANDLER
 static volatile void (*g_Timer1_callBackPtr)(void) = NULL_PTR;
+#endif
+#ifndef TIMER2_ISR_HANDLER
 static volatile void (*g_Timer2_callBackPtr)(void) = NULL_PTR;
+#endif
 
 /*******************************************************************************
  *                       Interrupt Service Routines                            *
@@ -28,24 +41,52 @@ static volatile void (*g_Timer2_callBackPtr)(void) = NULL_PTR;
  * ************************************************************************/
 ISR(TIMER0_OVF_vect)
 {
+	ISR_INSTR_ENTRY_LATENCY(ISR_ID_TIMER0_OVF, ISR_INSTR_TIMER0_OVF_LATENCY());
+
+	/* Clear the flag of timer0 over flow Interrupt, before the call back which may enable the interrupts */
+	CLEAR_FLAG(TIFR, TOV0);
+
+#if (TIMER_POST_EVENTS != DISABLE)
+	/* The application handles the timer from the main loop */
+	EventQueue_post(EVENT_TIMER0, (1<<TOV0));
+#endif
+#if defined(TIMER0_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	TIMER0_ISR_HANDLER();
+#elif (TIMER_POST_EVENTS == DISABLE)
 	if(g_Timer0_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_Timer0_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
-	/* Clear the flag of timer0 over flow Interrupt*/
-	TIFR = SET_BIT(TIFR, TOV0);
+#endif
+
+	ISR_INSTR_EXIT(ISR_ID_TIMER0_OVF);
 }
 
 ISR(TIMER0_COMP_vect)
 {
+	ISR_INSTR_ENTRY_LATENCY(ISR_ID_TIMER0_COMP, ISR_INSTR_TIMER0_COMP_LATENCY());
+
+	/* Clear the flag of timer0 compare Interrupt, before the call back which may enable the interrupts */
+	CLEAR_FLAG(TIFR, OCF0);
+
+#if (TIMER_POST_EVENTS != DISABLE)
+	/* The application handles the timer from the main loop */
+	EventQueue_post(EVENT_TIMER0, (1<<OCF0));
+#endif
+#if defined(TIMER0_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	TIMER0_ISR_HANDLER();
+#elif (TIMER_POST_EVENTS == DISABLE)
 	if(g_Timer0_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_Timer0_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
-	/* Clear the flag of timer0 compare Interrupt*/
-	TIFR = SET_BIT(TIFR, OCF0);
+#endif
+
+	ISR_INSTR_EXIT(ISR_ID_TIMER0_COMP);
 }
 
 /**************************************************************************
@@ -53,38 +94,77 @@ ISR(TIMER0_COMP_vect)
  * ************************************************************************/
 ISR(TIMER1_OVF_vect)
 {
+	ISR_INSTR_ENTRY_LATENCY(ISR_ID_TIMER1_OVF, ISR_INSTR_TIMER1_OVF_LATENCY());
+
+	/* Clear the flag of timer1 over flow Interrupt, before the call back which may enable the interrupts */
+	CLEAR_FLAG(TIFR, TOV1);
+
+#if (TIMER_POST_EVENTS != DISABLE)
+	/* The application handles the timer from the main loop */
+	EventQueue_post(EVENT_TIMER1, (1<<TOV1));
+#endif
+#if defined(TIMER1_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	TIMER1_ISR_HANDLER();
+#elif (TIMER_POST_EVENTS == DISABLE)
 	if(g_Timer1_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_Timer1_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
-	/* Clear the flag of timer1 over flow Interrupt*/
-	TIFR = SET_BIT(TIFR, TOV1);
+#endif
 
+	ISR_INSTR_EXIT(ISR_ID_TIMER1_OVF);
 }
 
 ISR(TIMER1_COMPA_vect)
 {
+	ISR_INSTR_ENTRY_LATENCY(ISR_ID_TIMER1_COMPA, ISR_INSTR_TIMER1_COMPA_LATENCY());
+
+	/* Clear the flag of timer1 compare Interrupt for channelA, before the call back which may enable the interrupts */
+	CLEAR_FLAG(TIFR, OCF1A);
+
+#if (TIMER_POST_EVENTS != DISABLE)
+	/* The application handles the timer from the main loop */
+	EventQueue_post(EVENT_TIMER1, (1<<OCF1A));
+#endif
+#if defined(TIMER1_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	TIMER1_ISR_HANDLER();
+#elif (TIMER_POST_EVENTS == DISABLE)
 	if(g_Timer1_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_Timer1_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
-	/* Clear the flag of timer1 compare Interrupt for channelA*/
-	TIFR = SET_BIT(TIFR, OCF1A);
+#endif
 
+	ISR_INSTR_EXIT(ISR_ID_TIMER1_COMPA);
 }
 
 ISR(TIMER1_COMPB_vect)
 {
+	ISR_INSTR_ENTRY_LATENCY(ISR_ID_TIMER1_COMPB, ISR_INSTR_TIMER1_COMPB_LATENCY());
+
+	/* Clear the flag of timer1 compare Interrupt for channelB, before the call back which may enable the interrupts */
+	CLEAR_FLAG(TIFR, OCF1B);
+
+#if (TIMER_POST_EVENTS != DISABLE)
+	/* The application handles the timer from the main loop */
+	EventQueue_post(EVENT_TIMER1, (1<<OCF1B));
+#endif
+#if defined(TIMER1_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	TIMER1_ISR_HANDLER();
+#elif (TIMER_POST_EVENTS == DISABLE)
 	if(g_Timer1_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_Timer1_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
-	/* Clear the flag of timer1 compare Interrupt for channelB*/
-	TIFR = SET_BIT(TIFR, OCF1B);
+#endif
 
+	ISR_INSTR_EXIT(ISR_ID_TIMER1_COMPB);
 }
 
 /**************************************************************************
@@ -92,26 +172,52 @@ ISR(TIMER1_COMPB_vect)
  * ************************************************************************/
 ISR(TIMER2_OVF_vect)
 {
-	if(g_Timer0_callBackPtr != NULL_PTR)
+	ISR_INSTR_ENTRY_LATENCY(ISR_ID_TIMER2_OVF, ISR_INSTR_TIMER2_OVF_LATENCY());
+
+	/* Clear the flag of timer2 over flow Interrupt, before the call back which may enable the interrupts */
+	CLEAR_FLAG(TIFR, TOV2);
+
+#if (TIMER_POST_EVENTS != DISABLE)
+	/* The application handles the timer from the main loop */
+	EventQueue_post(EVENT_TIMER2, (1<<TOV2));
+#endif
+#if defined(TIMER2_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	TIMER2_ISR_HANDLER();
+#elif (TIMER_POST_EVENTS == DISABLE)
+	if(g_Timer2_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_Timer2_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
+#endif
 
-	/* Clear the flag of timer2 over flow Interrupt*/
-	TIFR = SET_BIT(TIFR, TOV2);
-
+	ISR_INSTR_EXIT(ISR_ID_TIMER2_OVF);
 }
 
 ISR(TIMER2_COMP_vect)
 {
+	ISR_INSTR_ENTRY_LATENCY(ISR_ID_TIMER2_COMP, ISR_INSTR_TIMER2_COMP_LATENCY());
+
+	/* Clear the flag of timer2 compare Interrupt, before the call back which may enable the interrupts */
+	CLEAR_FLAG(TIFR, OCF2);
+
+#if (TIMER_POST_EVENTS != DISABLE)
+	/* The application handles the timer from the main loop */
+	EventQueue_post(EVENT_TIMER2, (1<<OCF2));
+#endif
+#if defined(TIMER2_ISR_HANDLER)
+	/* Bound at build time (isr_bindings.h), direct call, after the event if posted */
+	TIMER2_ISR_HANDLER();
+#elif (TIMER_POST_EVENTS == DISABLE)
 	if(g_Timer2_callBackPtr != NULL_PTR)
 	{
 		/* Call the Call Back function in the application after the edge is detected */
 		(*g_Timer2_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
 	}
-	/* Clear the flag of timer2 compare Interrupt*/
-	TIFR = SET_BIT(TIFR, OCF2);
+#endif
+
+	ISR_INSTR_EXIT(ISR_ID_TIMER2_COMP);
 }
 /*****************************************************************************************/
 
@@ -140,6 +246,13 @@ ISR(TIMER2_COMP_vect)
 
 void Timer_init(const Timer_ConfigType * Config_Ptr)
 {
+	/*
+	 * Control registers built in these variables, field by field, then written
+	 * once per register: the clock select goes in with the mode, last, so the
+	 * timer starts with its compare value and interrupt already set
+	 */
+	uint8 control = 0;
+	uint8 control_A = 0;
 
 	switch( (Config_Ptr->timer_ID) )
 	{
@@ -148,29 +261,29 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 	 * ************************************************************************/
 	case Timer0:
 
-		/*Clear registers of Timer0 before accessing any of them*/
-		TIMER0_CONTROL_REGIRSTER        &= 0X00;
-		TIMER0_INITIAL_VALUE_REGISTER   &= 0X00;
-		TIMER0_OUTPUT_COMPARE_REGISTER  &= 0X00;
-		TIMER0_INTERRUPT_MASK_REGISTER  &= 0X00;
+		/*Clear registers of Timer0 before accessing any of them, TIMSK: its own bits only*/
+		TIMER0_OUTPUT_COMPARE_REGISTER  = 0X00;
+		CLEAR_BITS(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_INTERRUPTS_MASK);
 
 		/*
 		 * Configure initial value for Timer0 to start count from it
 		 * Anding with 0XFF to make sure the value won't exceed
 		 * 255 as it is 8-bit Timer
 		 */
-
-		TIMER0_CONTROL_REGIRSTER = ( (Config_Ptr->timer_InitialValue) ) & 0XFF;
+		TIMER0_INITIAL_VALUE_REGISTER = ( (Config_Ptr->timer_InitialValue) ) & 0XFF;
 
 		/*
-		 * Configure Clock Pre-scaler value for Timer0 in TCCR0 Register
-		 * Anding with 0XF8 to make sure the first 3-bits in TCCR0 register=0
-		 * ORing with the selected timer clock to include it in the first 3-bits
-		 * and keep the other bits as they are
+		 * Configure Clock Pre-scaler value for Timer0 in the first 3-bits of TCCR0
+		 * Anding with the complement of 0XF8 to make sure the value won't exceed them
 		 */
+		control = (Config_Ptr->timer_clock) & (~TIMER0_CLOCK_MASK_CLEAR);
 
-		TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER  & TIMER0_CLOCK_MASK_CLEAR) | (Config_Ptr->timer_clock);
-
+		/*
+		 * Configure compare output mode of OC0
+		 * Configure COM00 bit in TCCR0 register
+		 * Configure COM01 bit in TCCR0 register
+		 */
+		control |= ((Config_Ptr->COM)<<COM0_SHIFT_VALUE) & (~TIMER0_COM0_MASK_CLEAR);
 
 		switch(Config_Ptr->timer_mode)
 		{
@@ -178,26 +291,13 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 
 			/*
 			 * Configure wave form generation mode to work with normal mode
-			 * Clear WGM00 bit in TCCR0 register
-			 * Clear WGM01 bit in TCCR0 register
-			 */
-			TIMER0_CONTROL_REGIRSTER  = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER , TIMER0_WAVE_FORM_GENERATION_BIT0);
-			TIMER0_CONTROL_REGIRSTER  = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER , TIMER0_WAVE_FORM_GENERATION_BIT1);
-
-			/*
-			 * Configure compare output mode to work with normal port operation
-			 * Decide the mode of OC0 from compare output modes with non PWM
-			 * Configure COM00 bit in TCCR0 register
-			 * Configure COM01 bit in TCCR0 register
-			 */
-			TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER & TIMER0_COM0_MASK_CLEAR ) | ((Config_Ptr->COM)<<COM0_SHIFT_VALUE);
-
-			/*
+			 * WGM00 and WGM01 bits in TCCR0 register stay cleared
+			 *
 			 * Configure FOC0 bit in the TCCR0 register to be active
 			 * As Timer0 is non-PWM
 			 * Make FOC0 to be Active as it is overflow mode
 			 */
-			TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER,TIMER0_FORCE_OUTPUT_COMPARE_BIT);
+			control |= (1<<TIMER0_FORCE_OUTPUT_COMPARE_BIT);
 
 			/*
 			 * Enable Timer0 overflow interrupt
@@ -205,7 +305,7 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 			 *           -TOV0 bit in the TIFR register to be set
 			 * Timer0 overflow mode is ready to work after that
 			 */
-			TIMER0_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_OUTPUT_OVERFLOW_INTERRUPT);
+			SET_BIT(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_OUTPUT_OVERFLOW_INTERRUPT);
 			break;
 
 
@@ -216,29 +316,15 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 			 * the pin where the PWM signal is generated from MC
 			 */
 
-			OC0_DIRECTION_PORT = SET_BIT(OC0_DIRECTION_PORT, OC0_PIN);
+			SET_BIT(OC0_DIRECTION_PORT, OC0_PIN);
 
 			/*
-			 *Clear force output compare bit in Timer/Counter control register
-			 *to work with pulse width modulation
-			 */
-			TIMER0_CONTROL_REGIRSTER = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_FORCE_OUTPUT_COMPARE_BIT);
-
-			/*
-			 * Configure wave form generation mode to work with normal mode
+			 * Configure wave form generation mode to work with PWM phase correct mode
 			 * SET WGM00 bit in TCCR0 register
 			 * Clear WGM01 bit in TCCR0 register
+			 * FOC0 stays cleared to work with pulse width modulation
 			 */
-			TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT0);
-			TIMER0_CONTROL_REGIRSTER = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT1);
-
-			/*
-			 * Configure compare output mode to work with normal port operation
-			 * Decide the mode of OC0 from compare output modes with non PWM
-			 * Configure COM00 bit in TCCR0 register
-			 * Configure COM01 bit in TCCR0 register
-			 */
-			TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER & TIMER0_COM0_MASK_CLEAR ) | ((Config_Ptr->COM)<<COM0_SHIFT_VALUE);
+			control |= (1<<TIMER0_WAVE_FORM_GENERATION_BIT0);
 
 			/*
 			 * Configure Compare match value for Timer0 to start count till reach it
@@ -253,27 +339,15 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 		case Compare:
 
 			/*
-			 * Configure wave form generation mode to work with normal mode
+			 * Configure wave form generation mode to work with CTC mode
 			 * Clear WGM00 bit in TCCR0 register
-			 * Clear WGM01 bit in TCCR0 register
-			 */
-			TIMER0_CONTROL_REGIRSTER = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT0);
-			TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT1);
-
-			/*
-			 * Configure compare output mode to work with normal port operation
-			 * Decide the mode of OC0 from compare output modes with non PWM
-			 * Configure COM00 bit in TCCR0 register
-			 * Configure COM01 bit in TCCR0 register
-			 */
-			TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER & TIMER0_COM0_MASK_CLEAR ) | ((Config_Ptr->COM)<<COM0_SHIFT_VALUE);
-
-			/*
+			 * SET WGM01 bit in TCCR0 register
+			 *
 			 * Configure FOC0 bit in the TCCR0 register to be active
 			 * As Timer0 is non-PWM
 			 * Make FOC0 to be Active as it is compare mode
 			 */
-			TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_FORCE_OUTPUT_COMPARE_BIT);
+			control |= (1<<TIMER0_WAVE_FORM_GENERATION_BIT1) | (1<<TIMER0_FORCE_OUTPUT_COMPARE_BIT);
 
 			/*
 			 * Configure Compare match value for Timer0 to start count from it
@@ -288,7 +362,7 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 			 *           -OCF0 bit in the TIFR register to be set
 			 * Timer0 compare match mode is ready to work after that
 			 */
-			TIMER0_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_OUTPUT_COMPARE_MATCH_INTERRUPT);
+			SET_BIT(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_OUTPUT_COMPARE_MATCH_INTERRUPT);
 
 			break; /*End of compare mode*/
 
@@ -298,29 +372,15 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 			 * the pin where the PWM signal is generated from MC
 			 */
 
-			OC0_DIRECTION_PORT = SET_BIT(OC0_DIRECTION_PORT, OC0_PIN);
-
-			/*
-			 *Clear force output compare bit in Timer/Counter control register
-			 *to work with pulse width modulation
-			 */
-			TIMER0_CONTROL_REGIRSTER = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_FORCE_OUTPUT_COMPARE_BIT);
+			SET_BIT(OC0_DIRECTION_PORT, OC0_PIN);
 
 			/*
-			 * Configure wave form generation mode to work with normal mode
+			 * Configure wave form generation mode to work with Fast PWM mode
 			 * SET WGM00 bit in TCCR0 register
 			 * SET WGM01 bit in TCCR0 register
+			 * FOC0 stays cleared to work with pulse width modulation
 			 */
-			TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT0);
-			TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT1);
-
-			/*
-			 * Configure compare output mode to work with normal port operation
-			 * Decide the mode of OC0 from compare output modes with non PWM
-			 * Configure COM00 bit in TCCR0 register
-			 * Configure COM01 bit in TCCR0 register
-			 */
-			TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER & TIMER0_COM0_MASK_CLEAR ) | ((Config_Ptr->COM)<<COM0_SHIFT_VALUE);
+			control |= TIMER0_WAVE_FORM_GENERATION_MASK;
 
 			/*
 			 * Configure Compare match value for Timer0 to start count till reach it
@@ -333,6 +393,9 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 
 		} /*End of internal switch case for modes for Timer 0*/
 
+		/*The whole TCCR0 in one write*/
+		TIMER0_CONTROL_REGIRSTER = control;
+
 		break; /*End ofTimer0*/
 
 		/**************************************************************************
@@ -340,12 +403,9 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 		 * ************************************************************************/
 		case Timer1:
 
-			/*Clear registers of Timer1 before accessing any of them*/
-			TIMER1_CONTROL_REGIRSTER_A        &= 0X00;
-			TIMER1_CONTROL_REGIRSTER_B        &= 0X00;
-			TIMER1_INITIAL_VALUE_REGISTER     &= 0X00;
-			TIMER1_OUTPUT_COMPARE_REGISTER_A  &= 0X00;
-			TIMER1_INTERRUPT_MASK_REGISTER    &= 0X00;
+			/*Clear registers of Timer1 before accessing any of them, TIMSK: its own bits only*/
+			TIMER1_OUTPUT_COMPARE_REGISTER_A  = 0X00;
+			CLEAR_BITS(TIMER1_INTERRUPT_MASK_REGISTER, TIMER1_INTERRUPTS_MASK);
 
 			/*
 			 * Configure initial value for Timer1 to start count from it
@@ -355,69 +415,40 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 			TIMER1_INITIAL_VALUE_REGISTER = ( (Config_Ptr->timer_InitialValue) ) & 0XFFFF;
 
 			/*
-			 * Configure Clock Pre-scaler value for Timer0 in TCCR1B Register
-			 * Anding with 0XF8 to make sure the first 3-bits in TCCR1B register=0
-			 * ORing with the selected timer clock to include it in the first 3-bits
-			 * and keep the other bits as they are
+			 * Configure Clock Pre-scaler value for Timer1 in the first 3-bits of TCCR1B
+			 * Anding with the complement of 0XF8 to make sure the value won't exceed them
 			 */
-			TIMER1_CONTROL_REGIRSTER_B =  (TIMER1_CONTROL_REGIRSTER_B & TIMER1_CLOCK_MASK_CLEAR) | (Config_Ptr->timer_clock);
+			control = (Config_Ptr->timer_clock) & (~TIMER1_CLOCK_MASK_CLEAR);
 
-			switch( (Config_Ptr->timer_mode) )
+			/*
+			 * Configure compare output mode of the channel with one mode from 4 modes
+			 * Configure COM1A0/COM1A1 or COM1B0/COM1B1 bits in TCCR1A register
+			 */
+			switch((Config_Ptr->compare_register))
 			{
-			case Overflow:
-
-				switch((Config_Ptr->compare_register))
-				{
-
-				case ChannelA:
-					/*
-					 * Configure compare output mode to work with Timer1
-					 * with one mode from 4 modes in TCCR1A
-					 * Configure COM1A0/COM1A1 bits in TCCR1A register
-					 */
-					TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) | ((Config_Ptr->COM)<<COM1A_SHIFT_VALUE);
-
-					/*
-					 * Configure FOC1A bit in the TCCR1 register to be active
-					 * As Timer1 is non-PWM
-					 * Make FOC1A to be Active as it is overflow mode
-					 */
-					TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-
-					break; /*End of Channel A*/
-
-				case ChannelB:
-
-					/*
-					 * Configure compare output mode to work with Timer1
-					 * with one mode from 4 modes in TCCR1A
-					 * Configure COM1B0/COM1B1 bits in TCCR1A register
-					 */
-					TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) | ((Config_Ptr->COM)<<COM1B_SHIFT_VALUE);
-
-					/*
-					 * Configure FOC1B bit in the TCCR1 register to be active
-					 * As Timer1 is non-PWM
-					 * Make FOC1B to be Active as it is overflow mode
-					 */
-					TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
+			case ChannelA:
+				control_A = ((Config_Ptr->COM)<<COM1A_SHIFT_VALUE) & (~TIMER1_COM1A_MASK_CLEAR);
+				break;
 
-					break;/*End of channel B*/
-				}/*End of Channel Type*/
+			case ChannelB:
+				control_A = ((Config_Ptr->COM)<<COM1B_SHIFT_VALUE) & (~TIMER1_COM1B_MASK_CLEAR);
+				break;
+			}/*End of Channel Type*/
 
-				/*
-				 * Configure wave form generation mode to work with normal mode
-				 * Clear WGM10/WMG11 bit in TCCR1A register
-				 */
-				TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-				TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
+			switch( (Config_Ptr->timer_mode) )
+			{
+			case Overflow:
 
 				/*
 				 * Configure wave form generation mode to work with normal mode
-				 * Clear WGM12/WMG13 bit in TCCR1B register
+				 * WGM10/WGM11 bits in TCCR1A and WGM12/WGM13 bits in TCCR1B stay cleared
+				 *
+				 * Configure FOC1A/FOC1B bit in the TCCR1A register to be active
+				 * As Timer1 is non-PWM
+				 * Make it Active as it is overflow mode
 				 */
-				TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-				TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
+				control_A |= (Config_Ptr->compare_register == ChannelA) ?
+						(1<<TIMER1_FORCE_OUTPUT_COMPARE_BIT_A) : (1<<TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
 
 				/*
 				 * Enable Timer1 overflow interrupt
@@ -425,7 +456,7 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 				 *           -TOV1 bit in the TIFR register to be set
 				 * Timer1 overflow mode is ready to work after that
 				 */
-				TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_OVERFLOW_INTERRUPT);
+				SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_OVERFLOW_INTERRUPT);
 
 				break;
 
@@ -435,73 +466,25 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 					 * Configure wave form generation mode to work with PWM_PhaseCorrect TOP in ICR1
 					 * Clear WGM10 bit in TCCR1A register
 					 * Set WGM11 bit in TCCR1A register
-					 */
-					TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-					TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-					/*
-					 * Configure wave form generation mode to work with normal mode
-					 * Set WMG13 bit in TCCR1B register
 					 * Clear WMG12 bit in TCCR1B register
+					 * Set WMG13 bit in TCCR1B register
+					 * FOC1A/FOC1B stay cleared as Timer1 is PWM
 					 */
-					TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-					TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-
-				switch((Config_Ptr->compare_register))
-				{
-
-				case ChannelA:
-
-					/*
-					 * Configure OC1A as Output PIN
-					 * the pin where the PWM signal is generated from MC
-					 */
-					OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-					/*
-					 * Configure FOC1A bit in the TCCR1 register to be active
-					 * As Timer1 is PWM
-					 * Make FOC1A to be Active as it is Fast PWM mode
-					 */
-					TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-
-					/*
-					 * Configure compare output mode to work with Timer1
-					 * with one mode from 4 modes in TCCR1A
-					 * Configure COM1A0/COM1A1 bits in TCCR1A register
-					 */
-					TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) | ((Config_Ptr->COM)<<COM1A_SHIFT_VALUE);
-
-					/*
-					 * Configure Compare match value for Timer1 to start count till reach it
-					 * Anding with 0XFFFF to make sure the value won't exceed
-					 * OXFFFF as it is 16-bit Timer
-					 */
-					INPUT_CAPTURE_REGISRTER1 = ((Config_Ptr->timer_compare_MatchValue)) & 0XFFFF;
-
-					break; /*End of channel A*/
+					control_A |= (1<<TIMER1_WAVE_FORM_GENERATION_BIT11);
+					control |= (1<<TIMER1_WAVE_FORM_GENERATION_BIT13);
 
-				case ChannelB:
 					/*
-					 * Configure OC1A as Output PIN
+					 * Configure OC1A or OC1B as Output PIN
 					 * the pin where the PWM signal is generated from MC
 					 */
-					OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1A_PIN);
-
-					/*
-					 * Configure FOC1A bit in the TCCR1 register to be active
-					 * As Timer1 is PWM
-					 * Make FOC1A to be Active as it is Fast PWM mode
-					 */
-					TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-					/*
-					 * Configure compare output mode to work with Timer1
-					 * with one mode from 4 modes in TCCR1A
-					 * Configure COM1B0/COM1B1 bits in TCCR1A register
-					 */
-					TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) | ((Config_Ptr->COM)<<COM1B_SHIFT_VALUE);
+					if(Config_Ptr->compare_register == ChannelA)
+					{
+						SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
+					}
+					else
+					{
+						SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
+					}
 
 					/*
 					 * Configure Compare match value for Timer1 to start count till reach it
@@ -510,28 +493,17 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 					 */
 					INPUT_CAPTURE_REGISRTER1 = ((Config_Ptr->timer_compare_MatchValue)) & 0XFFFF;
 
-					break; /*End of channel B*/
-
-				}/*End of Switch case Channel Type*/
-
 					break; /*End of PWM_PhaseCorrect*/
 
 				case Compare:
 
 					/*
-					 * Configure wave form generation mode to work with normal mode
+					 * Configure wave form generation mode to work with CTC mode
 					 * Clear WGM10/WMG11 bit in TCCR1A register
-					 */
-					TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-					TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-					/*
-					 * Configure wave form generation mode to work with normal mode
 					 * Clear WMG13 bit in TCCR1B register
 					 * Set WMG12 bit in TCCR1B register
 					 */
-					TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-					TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
+					control |= (1<<TIMER1_WAVE_FORM_GENERATION_BIT12);
 
 					switch(Config_Ptr->compare_register)
 					{
@@ -539,17 +511,12 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 					case ChannelA:
 
 						/*
-						 * Configure FOC1A bit in the TCCR1 register to be active
+						 * Configure FOC1A bit in the TCCR1A register to be active
 						 * As Timer1 is non-PWM
 						 * Make FOC1A to be Active as it is compare mode
 						 */
-						TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-						/*
-						 * Configure compare output mode to work with Timer1
-						 * with one mode from 4 modes in TCCR1A
-						 * Configure COM1A0/COM1A1 bits in TCCR1A register
-						 */
-						TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) | ((Config_Ptr->COM)<<COM1A_SHIFT_VALUE);
+						control_A |= (1<<TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
+
 						/*
 						 * Configure Compare match value for Timer1 to start count from it
 						 * Anding with 0XFFFF to make sure the value won't exceed
@@ -562,25 +529,18 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 						 *           -OCF1 bit in the TIFR register to be set
 						 * Timer1 compare match mode is ready to work after that
 						 */
-						TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A);
+						SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A);
 
 						break; /*End of channel A*/
 
 					case ChannelB:
 
 						/*
-						 * Configure FOC1B bit in the TCCR1 register to be active
+						 * Configure FOC1B bit in the TCCR1A register to be active
 						 * As Timer1 is non-PWM
 						 * Make FOC1B to be Active as it is compare mode
 						 */
-						TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-						/*
-						 * Configure compare output mode to work with Timer1
-						 * with one mode from 4 modes in TCCR1A
-						 * Configure COM1B0/COM1B1 bits in TCCR1A register
-						 */
-						TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) | ((Config_Ptr->COM)<<COM1B_SHIFT_VALUE);
+						control_A |= (1<<TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
 
 						/*
 						 * Configure Compare match value for Timer1 to start count from it
@@ -597,7 +557,7 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 						 *           -OCF1 bit in the TIFR register to be set
 						 * Timer1 compare match mode is ready to work after that
 						 */
-						TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_B);
+						SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_B);
 
 						break;/*End of channel B*/
 
@@ -611,73 +571,24 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 						 * Configure wave form generation mode to work with Fast PWM TOP in ICR1
 						 * Clear WGM10 bit in TCCR1A register
 						 * SET WGM11 bit in TCCR1A register
+						 * SET WMG12 and WMG13 bits in TCCR1B register
+						 * FOC1A/FOC1B stay cleared as Timer1 is PWM
 						 */
-						TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-						TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-						/*
-						 * Configure wave form generation mode to work with normal mode
-						 * SET WMG13 bit in TCCR1B register
-						 * Set WMG12 bit in TCCR1B register
-						 */
-						TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-						TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-
-					switch((Config_Ptr->compare_register))
-					{
-
-					case ChannelA:
+						control_A |= (1<<TIMER1_WAVE_FORM_GENERATION_BIT11);
+						control |= TIMER1_WAVE_FORM_GENERATION_MASK_B;
 
 						/*
-						 * Configure OC1A as Output PIN
+						 * Configure OC1A or OC1B as Output PIN
 						 * the pin where the PWM signal is generated from MC
 						 */
-						OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-						/*
-						 * Configure FOC1A bit in the TCCR1 register to be active
-						 * As Timer1 is PWM
-						 * Make FOC1A to be Active as it is Fast PWM mode
-						 */
-						TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-
-						/*
-						 * Configure compare output mode to work with Timer1
-						 * with one mode from 4 modes in TCCR1A
-						 * Configure COM1A0/COM1A1 bits in TCCR1A register
-						 */
-						TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) | ((Config_Ptr->COM)<<COM1A_SHIFT_VALUE);
-
-						/*
-						 * Configure Compare match value for Timer1 to start count till reach it
-						 * Anding with 0XFFFF to make sure the value won't exceed
-						 * OXFFFF as it is 16-bit Timer
-						 */
-						INPUT_CAPTURE_REGISRTER1 = ((Config_Ptr->timer_compare_MatchValue)) & 0XFFFF;
-
-						break;
-
-					case ChannelB:
-						/*
-						 * Configure OC1B as Output PIN
-						 * the pin where the PWM signal is generated from MC
-						 */
-						OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-						/*
-						 * Configure FOC1A bit in the TCCR1 register to be active
-						 * As Timer1 is PWM
-						 * Make FOC1A to be Active as it is Fast PWM mode
-						 */
-						TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-						/*
-						 * Configure compare output mode to work with Timer1
-						 * with one mode from 4 modes in TCCR1A
-						 * Configure COM1A0/COM1A1 bits in TCCR1A register
-						 */
-						TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) | ((Config_Ptr->COM)<<COM1B_SHIFT_VALUE);
+						if(Config_Ptr->compare_register == ChannelA)
+						{
+							SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
+						}
+						else
+						{
+							SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
+						}
 
 						/*
 						 * Configure Compare match value for Timer1 to start count till reach it
@@ -686,14 +597,14 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 						 */
 						INPUT_CAPTURE_REGISRTER1 = ((Config_Ptr->timer_compare_MatchValue)) & 0XFFFF;
 
-						break;
-
-					}/*End of Switch case Channel Type*/
-
 						break; /*End of FAST PWM*/
 
 			} /*End of internal switch case*/
 
+			/*The whole TCCR1A then TCCR1B with the clock, one write each*/
+			TIMER1_CONTROL_REGIRSTER_A = control_A;
+			TIMER1_CONTROL_REGIRSTER_B = control;
+
 			break; /*End of Timer1*/
 
 			/**************************************************************************
@@ -701,13 +612,11 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 			 * ************************************************************************/
 			case Timer2:
 
-				/*Clear registers of Timer0 before accessing any of them*/
-				TIMER2_CONTROL_REGIRSTER        &= 0X00;
-				TIMER2_INITIAL_VALUE_REGISTER   &= 0X00;
-				TIMER2_OUTPUT_COMPARE_REGISTER  &= 0X00;
-				TIMER2_INTERRUPT_MASK_REGISTER  &= 0X00;
+				/*Clear registers of Timer2 before accessing any of them, TIMSK: its own bits only*/
+				TIMER2_OUTPUT_COMPARE_REGISTER  = 0X00;
+				CLEAR_BITS(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_INTERRUPTS_MASK);
 				/*************************************************************************/
-				ASSR  &= 0X00;
+				ASSR  = 0X00;
 				/*******************************************************************************/
 				/*
 				 * Configure initial value for Timer2 to start count from it
@@ -718,14 +627,17 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 				TIMER2_INITIAL_VALUE_REGISTER = ( (Config_Ptr->timer_InitialValue) ) & 0XFF;
 
 				/*
-				 * Configure Clock Pre-scaler value for Timer0 in TCCR2 Register
-				 * Anding with 0XF8 to make sure the first 3-bits in TCCR2 register=0
-				 * ORing with the selected timer clock to include it in the first 3-bits
-				 * and keep the other bits as they are
+				 * Configure Clock Pre-scaler value for Timer2 in the first 3-bits of TCCR2
+				 * Anding with the complement of 0XF8 to make sure the value won't exceed them
 				 */
+				control = (Config_Ptr->timer_clock) & (~TIMER2_CLOCK_MASK_CLEAR);
 
-				TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER  & TIMER2_CLOCK_MASK_CLEAR) | (Config_Ptr->timer_clock);
-
+				/*
+				 * Configure compare output mode of OC2
+				 * Configure COM20 bit in TCCR2 register
+				 * Configure COM21 bit in TCCR2 register
+				 */
+				control |= ((Config_Ptr->COM)<<COM2_SHIFT_VALUE) & (~TIMER2_CLEAR_COMPARE_OUTPUT_MODE_BITS_VALUE);
 
 				switch(Config_Ptr->timer_mode)
 				{
@@ -733,70 +645,43 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 
 					/*
 					 * Configure wave form generation mode to work with normal mode
-					 * Clear WGM00 bit in TCCR0 register
-					 * Clear WGM01 bit in TCCR0 register
-					 */
-					TIMER2_CONTROL_REGIRSTER  = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER , TIMER2_WAVE_FORM_GENERATION_BIT0);
-					TIMER2_CONTROL_REGIRSTER  = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER , TIMER2_WAVE_FORM_GENERATION_BIT1);
-
-					/*
-					 * Configure compare output mode to work with normal port operation
-					 * configure OC2
-					 * Configure COM20 bit in TCCR2 register
-					 * Configure COM21 bit in TCCR2 register
-					 */
-					TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER & TIMER2_CLEAR_COMPARE_OUTPUT_MODE_BITS_VALUE ) | ((Config_Ptr->COM)<<COM2_SHIFT_VALUE);
-
-					/*
+					 * WGM20 and WGM21 bits in TCCR2 register stay cleared
+					 *
 					 * Configure FOC2 bit in the TCCR2 register to be active
 					 * As Timer2 is non-PWM
 					 * Make FOC2 to be Active as it is overflow mode
 					 */
-					TIMER2_CONTROL_REGIRSTER =  SET_BIT(TIMER2_CONTROL_REGIRSTER ,TIMER2_FORCE_OUTPUT_COMPARE_BIT);
-
+					control |= (1<<TIMER2_FORCE_OUTPUT_COMPARE_BIT);
 
 					/*
-					 * Enable Timer0 overflow interrupt
+					 * Enable Timer2 overflow interrupt
 					 * wait for: -Enable I-bit "mask bit" in the SREG register
-					 *           -TOV0 bit in the TIFR register to be set
-					 * Timer0 overflow mode is ready to work after that
+					 *           -TOV2 bit in the TIFR register to be set
+					 * Timer2 overflow mode is ready to work after that
 					 */
-					TIMER2_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER2_INTERRUPT_MASK_REGISTER,TIMER2_OUTPUT_OVERFLOW_INTERRUPT);
+					SET_BIT(TIMER2_INTERRUPT_MASK_REGISTER,TIMER2_OUTPUT_OVERFLOW_INTERRUPT);
 
 					break;
 
 				case PWM_PhaseCorrect:
 
 					/*
-					 * Configure OC0 as Output PIN
+					 * Configure OC2 as Output PIN
 					 * the pin where the PWM signal is generated from MC
 					 */
 
-					OC2_DIRECTION_PORT = SET_BIT(OC2_DIRECTION_PORT, OC2_PIN);
+					SET_BIT(OC2_DIRECTION_PORT, OC2_PIN);
 
 					/*
-					 *Clear force output compare bit in Timer/Counter control register
-					 *to work with pulse width modulation
-					 */
-					TIMER2_CONTROL_REGIRSTER = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_FORCE_OUTPUT_COMPARE_BIT);
-
-					/*
-					 * Configure wave form generation mode to work with normal mode
-					 * SET WGM00 bit in TCCR0 register
-					 * Clear WGM01 bit in TCCR0 register
+					 * Configure wave form generation mode to work with PWM phase correct mode
+					 * SET WGM20 bit in TCCR2 register
+					 * Clear WGM21 bit in TCCR2 register
+					 * FOC2 stays cleared to work with pulse width modulation
 					 */
-					TIMER2_CONTROL_REGIRSTER = SET_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT0);
-					TIMER2_CONTROL_REGIRSTER = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT1);
+					control |= (1<<TIMER2_WAVE_FORM_GENERATION_BIT0);
 
 					/*
-					 * Configure compare output mode to work with normal port operation
-					 * Decide the mode of OC0 from compare output modes with non PWM
-					 * Configure COM00 bit in TCCR0 register
-					 * Configure COM01 bit in TCCR0 register
-					 */
-					TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER & TIMER2_CLEAR_COMPARE_OUTPUT_MODE_BITS_VALUE ) | ((Config_Ptr->COM)<<COM2_SHIFT_VALUE);
-					/*
-					 * Configure Compare match value for Timer0 to start count till reach it
+					 * Configure Compare match value for Timer2 to start count till reach it
 					 * Anding with 0XFF to make sure the value won't exceed
 					 * 255 as it is 8-bit Timer
 					 */
@@ -806,27 +691,15 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 
 				case Compare:
 					/*
-					 * Configure wave form generation mode to work with normal mode
+					 * Configure wave form generation mode to work with CTC mode
 					 * Clear WGM20 bit in TCCR2 register
-					 * Clear WGM21 bit in TCCR2 register
-					 */
-					TIMER2_CONTROL_REGIRSTER  = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER , TIMER2_WAVE_FORM_GENERATION_BIT0);
-					TIMER2_CONTROL_REGIRSTER  = SET_BIT(TIMER2_CONTROL_REGIRSTER , TIMER2_WAVE_FORM_GENERATION_BIT1);
-
-					/*
-					 * Configure compare output mode to work with normal port operation
-					 * configure OC2
-					 * Configure COM20 bit in TCCR2 register
-					 * Configure COM21 bit in TCCR2 register
-					 */
-					TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER & TIMER2_CLEAR_COMPARE_OUTPUT_MODE_BITS_VALUE ) | ((Config_Ptr->COM)<<COM2_SHIFT_VALUE);
-
-					/*
+					 * SET WGM21 bit in TCCR2 register
+					 *
 					 * Configure FOC2 bit in the TCCR2 register to be active
 					 * As Timer2 is non-PWM
 					 * Make FOC2 to be Active as it is compare mode
 					 */
-					TIMER2_CONTROL_REGIRSTER =  SET_BIT(TIMER2_CONTROL_REGIRSTER , TIMER2_FORCE_OUTPUT_COMPARE_BIT);
+					control |= (1<<TIMER2_WAVE_FORM_GENERATION_BIT1) | (1<<TIMER2_FORCE_OUTPUT_COMPARE_BIT);
 
 					/*
 					 * Configure Compare match value for Timer2 to start count from it
@@ -841,42 +714,28 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 					 *           -OCF2 bit in the TIFR register to be set
 					 * Timer2 compare match mode is ready to work after that
 					 */
-					TIMER2_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_OUTPUT_COMPARE_MATCH_INTERRUPT);
+					SET_BIT(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_OUTPUT_COMPARE_MATCH_INTERRUPT);
 					break;
 
 				case FAST_PWM:
 
 					/*
-					 * Configure OC0 as Output PIN
+					 * Configure OC2 as Output PIN
 					 * the pin where the PWM signal is generated from MC
 					 */
 
-					OC2_DIRECTION_PORT = SET_BIT(OC2_DIRECTION_PORT, OC2_PIN);
+					SET_BIT(OC2_DIRECTION_PORT, OC2_PIN);
 
 					/*
-					 *Clear force output compare bit in Timer/Counter control register
-					 *to work with pulse width modulation
+					 * Configure wave form generation mode to work with Fast PWM mode
+					 * SET WGM20 bit in TCCR2 register
+					 * SET WGM21 bit in TCCR2 register
+					 * FOC2 stays cleared to work with pulse width modulation
 					 */
-					TIMER2_CONTROL_REGIRSTER = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_FORCE_OUTPUT_COMPARE_BIT);
+					control |= TIMER2_WAVE_FORM_GENERATION_MASK;
 
 					/*
-					 * Configure wave form generation mode to work with normal mode
-					 * SET WGM00 bit in TCCR0 register
-					 * SET WGM01 bit in TCCR0 register
-					 */
-					TIMER2_CONTROL_REGIRSTER = SET_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT0);
-					TIMER2_CONTROL_REGIRSTER = SET_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT1);
-
-					/*
-					 * Configure compare output mode to work with normal port operation
-					 * Decide the mode of OC0 from compare output modes with non PWM
-					 * Configure COM00 bit in TCCR0 register
-					 * Configure COM01 bit in TCCR0 register
-					 */
-					TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER & TIMER2_CLEAR_COMPARE_OUTPUT_MODE_BITS_VALUE ) | ((Config_Ptr->COM)<<COM2_SHIFT_VALUE);
-
-					/*
-					 * Configure Compare match value for Timer0 to start count till reach it
+					 * Configure Compare match value for Timer2 to start count till reach it
 					 * Anding with 0XFF to make sure the value won't exceed
 					 * 255 as it is 8-bit Timer
 					 */
@@ -886,6 +745,8 @@ void Timer_init(const Timer_ConfigType * Config_Ptr)
 
 				} /*End of internal switch case*/
 
+				/*The whole TCCR2 in one write*/
+				TIMER2_CONTROL_REGIRSTER = control;
 
 				break; /*End of Timer2*/
 
@@ -919,17 +780,23 @@ void Timer_setCallBack(void(*a_ptr)(void), Timer_Type timer_type )
 	{
 	case Timer0:
 		/* Save the address of the Call back function in a global variable */
+#ifndef TIMER0_ISR_HANDLER
 		g_Timer0_callBackPtr = a_ptr;
+#endif
 		break;
 
 	case Timer1:
 		/* Save the address of the Call back function in a global variable */
+#ifndef TIMER1_ISR_HANDLER
 		g_Timer1_callBackPtr = a_ptr;
+#endif
 		break;
 
 	case Timer2:
 		/* Save the address of the Call back function in a global variable */
+#ifndef TIMER2_ISR_HANDLER
 		g_Timer2_callBackPtr = a_ptr;
+#endif
 		break;
 	} /*End of the switch case*/
 
@@ -939,6 +806,8 @@ void Timer_setCallBack(void(*a_ptr)(void), Timer_Type timer_type )
 
 void Timer_changeCompareValue(Timer_Type timerID,uint16 newCompareValue, Channel_Type channel)
 {
+	PROFILE_ENTER(PROFILER_ID_TIMER_COMPARE);
+
 	switch(timerID)
 	{
 
@@ -991,6 +860,7 @@ void Timer_changeCompareValue(Timer_Type timerID,uint16 newCompareValue, Channel
 		break;
 	}
 
+	PROFILE_EXIT(PROFILER_ID_TIMER_COMPARE);
 }
 
 /***************************************************************************************************
@@ -1130,36 +1000,68 @@ void Timer_DeInit(Timer_Type timer_type)
 	{
 	case Timer0:
 
-		/*Clear all register in Timer0*/
-		TIMER0_CONTROL_REGIRSTER        &= 0X00;
-		TIMER0_INITIAL_VALUE_REGISTER   &= 0X00;
-		TIMER0_OUTPUT_COMPARE_REGISTER  &= 0X00;
-		TIMER0_INTERRUPT_MASK_REGISTER  &= 0X00;
+		/*Clear all register in Timer0, TIMSK: its own bits only*/
+		TIMER0_CONTROL_REGIRSTER        = 0X00;
+		TIMER0_INITIAL_VALUE_REGISTER   = 0X00;
+		TIMER0_OUTPUT_COMPARE_REGISTER  = 0X00;
+		CLEAR_BITS(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_INTERRUPTS_MASK);
 		break;
 
 	case Timer1:
 
-		/*Clear all register in Timer1*/
-		TIMER1_CONTROL_REGIRSTER_A         &= 0X00;
-		TIMER1_CONTROL_REGIRSTER_B         &= 0X00;
-		TIMER1_INITIAL_VALUE_REGISTER      &= 0X00;
-		TIMER1_OUTPUT_COMPARE_REGISTER_A   &= 0X00;
-		TIMER1_OUTPUT_COMPARE_REGISTER_B   &= 0X00;
-		TIMER1_INTERRUPT_MASK_REGISTER     &= 0X00;
-		INPUT_CAPTURE_REGISRTER1           &= 0X00;
+		/*Clear all register in Timer1, TIMSK: its own bits only*/
+		TIMER1_CONTROL_REGIRSTER_A         = 0X00;
+		TIMER1_CONTROL_REGIRSTER_B         = 0X00;
+		TIMER1_INITIAL_VALUE_REGISTER      = 0X00;
+		TIMER1_OUTPUT_COMPARE_REGISTER_A   = 0X00;
+		TIMER1_OUTPUT_COMPARE_REGISTER_B   = 0X00;
+		CLEAR_BITS(TIMER1_INTERRUPT_MASK_REGISTER, TIMER1_INTERRUPTS_MASK);
+		INPUT_CAPTURE_REGISRTER1           = 0X00;
 		break;
 
 
 	case Timer2:
 
-		/*Clear all register in Timer2*/
-		TIMER2_CONTROL_REGIRSTER        &= 0X00;
-		TIMER2_INITIAL_VALUE_REGISTER   &= 0X00;
-		TIMER2_OUTPUT_COMPARE_REGISTER  &= 0X00;
-		TIMER2_INTERRUPT_MASK_REGISTER  &= 0X00;
+		/*Clear all register in Timer2, TIMSK: its own bits only*/
+		TIMER2_CONTROL_REGIRSTER        = 0X00;
+		TIMER2_INITIAL_VALUE_REGISTER   = 0X00;
+		TIMER2_OUTPUT_COMPARE_REGISTER  = 0X00;
+		CLEAR_BITS(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_INTERRUPTS_MASK);
 		break;
 
 	} /*End of the switch case*/
 
 
 }/*end of the Timer_DeInit function*/
+
+/***************************************************************************************************
+ * [Function Name]: Timer_startCycleCounter
+ *
+ * [Description]:  Function to run Timer1 as a free running counter clocked by F_CPU
+ *                 - Normal mode, OC1A/OC1B disconnected
+ *                 - No interrupts, the counter wraps every 65536 cycles
+ *                 - TIMER_CYCLE_COUNTER_REGISTER counts CPU cycles
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer_startCycleCounter(void)
+{
+	/*Normal mode and compare outputs disconnected*/
+	TIMER1_CONTROL_REGIRSTER_A = 0X00;
+
+	/*Timer1 interrupts are not used by the cycle counter*/
+	TIMER1_INTERRUPT_MASK_REGISTER &= ~( (1<<TIMER1_OUTPUT_OVERFLOW_INTERRUPT) |
+			(1<<TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A) | (1<<TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_B) );
+
+	TIMER1_INITIAL_VALUE_REGISTER = 0X0000;
+
+	/*Clock of Timer1 = F_CPU*/
+	TIMER1_CONTROL_REGIRSTER_B = F_CPU_CLOCK;
+
+}/*End of Timer_startCycleCounter function*/
@@ -22,6 +22,9 @@
  *                      Preprocessor Macros                                    *
  *******************************************************************************/
 
+#define ENABLE                                       TRUE
+#define DISABLE                                      FALSE
+
 /**************************************************************************
  *                              Timer0
  * ************************************************************************/
@@ -36,6 +39,7 @@
 #define TIMER0_FORCE_OUTPUT_COMPARE_BIT              FOC0
 #define TIMER0_WAVE_FORM_GENERATION_BIT0             WGM00
 #define TIMER0_WAVE_FORM_GENERATION_BIT1             WGM01
+#define TIMER0_WAVE_FORM_GENERATION_MASK             ((1<<WGM00) | (1<<WGM01))
 #define TIMER0_COMPARE_OUTPUT_MODE_BIT0              COM00
 #define TIMER0_COMPARE_OUTPUT_MODE_BIT1              COM01
 #define TIMER0_CLOCK_SELECT_BIT0                     CS00
@@ -45,6 +49,8 @@
 /*TIMER0_INTERRUPT_FLAG_REGISTER*/
 #define TIMER0_OUTPUT_OVERFLOW_INTERRUPT             TOIE0
 #define TIMER0_OUTPUT_COMPARE_MATCH_INTERRUPT        OCIE0
+/*Bits of Timer0 in TIMSK, shared with Timer1 and Timer2*/
+#define TIMER0_INTERRUPTS_MASK                       ((1<<TOIE0) | (1<<OCIE0))
 
 #define TIMER0_CLOCK_MASK_CLEAR                0XF8
 #define TIMER0_COM0_MASK_CLEAR                 0XCF
@@ -75,15 +81,19 @@
 
 #define TIMER1_WAVE_FORM_GENERATION_BIT12      WGM12
 #define TIMER1_WAVE_FORM_GENERATION_BIT13      WGM13
+#define TIMER1_WAVE_FORM_GENERATION_MASK_B     ((1<<WGM12) | (1<<WGM13))
 
 #define TIMER1_WAVE_FORM_GENERATION_BIT10      WGM10
 #define TIMER1_WAVE_FORM_GENERATION_BIT11      WGM11
+#define TIMER1_WAVE_FORM_GENERATION_MASK_A     ((1<<WGM10) | (1<<WGM11))
 
 
 /*TIMER1_INTERRUPT_FLAG_REGISTER*/
 #define TIMER1_OUTPUT_OVERFLOW_INTERRUPT       TOIE1
 #define TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A  OCIE1A
 #define TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_B  OCIE1B
+/*Bits of Timer1 in TIMSK, shared with Timer0 and Timer2*/
+#define TIMER1_INTERRUPTS_MASK                 ((1<<TOIE1) | (1<<OCIE1A) | (1<<OCIE1B) | (1<<TICIE1))
 
 #define INPUT_CAPTURE_REGISRTER1                      ICR1
 
@@ -103,6 +113,15 @@
 #define TIMER1_COM1A_MASK_CLEAR                           0X3F
 #define TIMER1_COM1B_MASK_CLEAR                            0XCF
 
+/*
+ * Post an event (payload = TIFR flag of the vector) to the event queue
+ * instead of calling the call back function from the ISRs
+ */
+#define TIMER_POST_EVENTS                                  DISABLE
+
+/*Timer1 used as free running cycle counter (no prescaler)*/
+#define TIMER_CYCLE_COUNTER_REGISTER                       TIMER1_INITIAL_VALUE_REGISTER
+
 
 
 /*************************************************************************/
@@ -123,6 +142,7 @@
 #define TIMER2_FORCE_OUTPUT_COMPARE_BIT       FOC2
 #define TIMER2_WAVE_FORM_GENERATION_BIT0      WGM20
 #define TIMER2_WAVE_FORM_GENERATION_BIT1      WGM21
+#define TIMER2_WAVE_FORM_GENERATION_MASK      ((1<<WGM20) | (1<<WGM21))
 #define TIMER2_COMPARE_OUTPUT_MODE_BIT0       COM20
 #define TIMER2_COMPARE_OUTPUT_MODE_BIT1       COM21
 #define TIMER2_CLOCK_SELECT_BIT0              CS20
@@ -132,6 +152,8 @@
 /*TIMER2_INTERRUPT_FLAG_REGISTER*/
 #define TIMER2_OUTPUT_OVERFLOW_INTERRUPT       TOIE2
 #define TIMER2_OUTPUT_COMPARE_MATCH_INTERRUPT  OCIE2
+/*Bits of Timer2 in TIMSK, shared with Timer0 and Timer1*/
+#define TIMER2_INTERRUPTS_MASK                 ((1<<TOIE2) | (1<<OCIE2))
 
 #define TIMER2_CLEAR_COMPARE_OUTPUT_MODE_BITS_VALUE     0XCF
 #define TIMER2_CLOCK_MASK_CLEAR                           0XF8
@@ -231,4 +253,10 @@ void Timer_DeInit(Timer_Type timer_type);
  */
 void Timer_changeCompareValue(Timer_Type timerID,uint16 newCompareValue, Channel_Type channel);
 
+/*
+ * Description: Function to run Timer1 as a free running counter clocked by F_CPU
+ *              without interrupts, TIMER_CYCLE_COUNTER_REGISTER counts CPU cycles
+ */
+void Timer_startCycleCounter(void);
+
 #endif /* TIMERS_H_ */
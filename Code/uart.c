@@ -0,0 +1,250 @@
+/**********************************************************************************
+ * [FILE NAME]: uart.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Functions of the interrupt driven USART driver.
+ *
+ ***********************************************************************************/
+
+#include"uart.h"
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/*
+ * Free running indexes like the event queue, the byte of an index is
+ * (index & MASK) and the number of bytes waiting is (head - tail)
+ * TX: head written by the main loop, tail by USART_UDRE_vect
+ * RX: head written by USART_RXC_vect, tail by the main loop
+ */
+static uint8 g_uart_txBuffer[UART_TX_BUFFER_SIZE];
+static volatile uint8 g_uart_txHead = 0;
+static volatile uint8 g_uart_txTail = 0;
+
+static uint8 g_uart_rxBuffer[UART_RX_BUFFER_SIZE];
+static volatile uint8 g_uart_rxHead = 0;
+static volatile uint8 g_uart_rxTail = 0;
+
+static volatile uint16 g_uart_rxOverflows = 0;
+static volatile uint16 g_uart_rxErrors = 0;
+
+/*******************************************************************************
+ *                       Interrupt Service Routines                            *
+ *******************************************************************************/
+
+/*
+ * UDR empty: send the next byte, the interrupt is disabled once the buffer is
+ * empty (UDRE stays set so it would run again) and enabled by the next send
+ */
+ISR(USART_UDRE_vect)
+{
+	ISR_INSTR_ENTRY(ISR_ID_USART_UDRE);
+
+	uint8 tail = g_uart_txTail;
+
+	UDR = g_uart_txBuffer[tail & UART_TX_BUFFER_MASK];
+	tail++;
+	g_uart_txTail = tail;
+
+	if(tail == g_uart_txHead)
+	{
+		CLEAR_BIT(UCSRB, UDRIE);
+	}
+
+	ISR_INSTR_EXIT(ISR_ID_USART_UDRE);
+}
+
+ISR(USART_RXC_vect)
+{
+	ISR_INSTR_ENTRY(ISR_ID_USART_RXC);
+
+	/* the error flags belong to the byte in UDR, read them first */
+	uint8 status = UCSRA;
+	uint8 data = UDR;
+	uint8 head = g_uart_rxHead;
+
+	if(status & ((1<<FE) | (1<<PE)))
+	{
+		g_uart_rxErrors++;
+	}
+	else if((uint8)(head - g_uart_rxTail) >= UART_RX_BUFFER_SIZE)
+	{
+		g_uart_rxOverflows++;
+	}
+	else
+	{
+		g_uart_rxBuffer[head & UART_RX_BUFFER_MASK] = data;
+		g_uart_rxHead = head + 1;
+	}
+
+	/* bytes lost by the hardware before this one */
+	if(BIT_IS_SET(status, DOR))
+	{
+		g_uart_rxOverflows++;
+	}
+
+	ISR_INSTR_EXIT(ISR_ID_USART_RXC);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+/***************************************************************************************************
+ * [Function Name]: UART_init
+ *
+ * [Description]:  Function to initialize the USART
+ *                 - Baud rate register from F_CPU, rounded to the nearest
+ *                 - Asynchronous, 8 data bits, parity and stop bits of the configuration
+ *                 - TX and RX enabled, RX interrupt enabled, TX interrupt
+ *                   enabled only while there is something to send
+ *
+ * [Args]:         Config_Ptr
+ *
+ * [In]            Config_Ptr: Pointer to the UART Configuration Structure
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void UART_init(const UART_ConfigType * Config_Ptr)
+{
+	uint32 divisor = ((Config_Ptr->speed == UART_DOUBLE_SPEED) ? 8UL : 16UL) * Config_Ptr->baud_rate;
+	uint16 ubrr = (uint16)((F_CPU + divisor / 2) / divisor - 1);
+	uint8 sreg = SREG;
+
+	cli();
+
+	UCSRB = 0;
+	g_uart_txHead = 0;
+	g_uart_txTail = 0;
+	g_uart_rxHead = 0;
+	g_uart_rxTail = 0;
+	g_uart_rxOverflows = 0;
+	g_uart_rxErrors = 0;
+
+	UCSRA = (Config_Ptr->speed == UART_DOUBLE_SPEED) ? (1<<U2X) : 0;
+
+	/* UBRRH and UCSRC share their address, URSEL selects UCSRC */
+	UBRRH = (uint8)(ubrr >> 8);
+	UBRRL = (uint8)ubrr;
+	UCSRC = (1<<URSEL) | ((uint8)Config_Ptr->parity << UPM0) |
+			((uint8)Config_Ptr->stop_bits << USBS) | (1<<UCSZ1) | (1<<UCSZ0);
+
+	UCSRB = (1<<RXCIE) | (1<<RXEN) | (1<<TXEN);
+
+	SREG = sreg;
+
+}/*End of UART_init*/
+
+void UART_deinit(void)
+{
+	UCSRB = 0;
+}
+
+bool UART_sendByte(uint8 data)
+{
+	return UART_send(&data, 1);
+}
+
+/***************************************************************************************************
+ * [Function Name]: UART_send
+ *
+ * [Description]:  Function to queue a buffer for transmission, never waits
+ *                 - All the bytes are written first then the head is published
+ *                 - The ISR never writes the head so no lock is needed
+ *                 - UDRIE is set by sbi (UCSRB is in the I/O space), atomic
+ *                   with the clearing by the ISR
+ *
+ * [Args]:         Data_Ptr, length
+ *
+ * [In]            Data_Ptr: -Pointer to the bytes to send
+ *
+ *                 length:   -Number of bytes
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the TX buffer has not enough room (nothing queued), TRUE otherwise
+ ***************************************************************************************************/
+bool UART_send(const uint8 * Data_Ptr, uint8 length)
+{
+	uint8 head = g_uart_txHead;
+	uint8 i;
+
+	if(length == 0)
+	{
+		return TRUE;
+	}
+	if(length > (uint8)(UART_TX_BUFFER_SIZE - (uint8)(head - g_uart_txTail)))
+	{
+		return FALSE;
+	}
+
+	for(i = 0; i < length; i++)
+	{
+		g_uart_txBuffer[head & UART_TX_BUFFER_MASK] = Data_Ptr[i];
+		head++;
+	}
+
+	UART_BARRIER();
+	g_uart_txHead = head;
+	SET_BIT(UCSRB, UDRIE);
+
+	return TRUE;
+
+}/*End of UART_send*/
+
+uint8 UART_getTxFree(void)
+{
+	return (uint8)(UART_TX_BUFFER_SIZE - (uint8)(g_uart_txHead - g_uart_txTail));
+}
+
+bool UART_receiveByte(uint8 * Data_Ptr)
+{
+	uint8 tail = g_uart_rxTail;
+
+	if(tail == g_uart_rxHead)
+	{
+		return FALSE;
+	}
+
+	*Data_Ptr = g_uart_rxBuffer[tail & UART_RX_BUFFER_MASK];
+
+	UART_BARRIER();
+	g_uart_rxTail = tail + 1;
+
+	return TRUE;
+}
+
+uint8 UART_getRxCount(void)
+{
+	return (uint8)(g_uart_rxHead - g_uart_rxTail);
+}
+
+uint16 UART_getRxOverflows(void)
+{
+	uint16 overflows;
+	uint8 sreg = SREG;
+
+	cli();
+	overflows = g_uart_rxOverflows;
+	SREG = sreg;
+
+	return overflows;
+}
+
+uint16 UART_getRxErrors(void)
+{
+	uint16 errors;
+	uint8 sreg = SREG;
+
+	cli();
+	errors = g_uart_rxErrors;
+	SREG = sreg;
+
+	return errors;
+}
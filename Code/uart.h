@@ -0,0 +1,142 @@
+/**********************************************************************************
+ * [FILE NAME]: uart.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                USART driver, interrupt driven and never blocking:
+ *                - TX: the main loop fills a ring buffer, USART_UDRE_vect
+ *                  moves it to UDR one byte at a time
+ *                - RX: USART_RXC_vect fills a ring buffer, the main loop reads it
+ *                Each ring buffer has one producer and one consumer, so like
+ *                the event queue the indexes are single bytes and no
+ *                interrupt has to be disabled to pass the data.
+ *                RXD/TXD are PD0/PD1, the RS/RW pins of the LCD on this board.
+ *
+ ***********************************************************************************/
+
+#ifndef UART_H_
+#define UART_H_
+
+#include "std_types.h"
+#include "micro_config.h"
+#include "common_macros.h"
+#include "isr_instrumentation.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/*Sizes of the ring buffers, powers of two from 2 to 128*/
+#define UART_TX_BUFFER_SIZE                      64
+#define UART_RX_BUFFER_SIZE                      16
+#define UART_TX_BUFFER_MASK                      (UART_TX_BUFFER_SIZE - 1)
+#define UART_RX_BUFFER_MASK                      (UART_RX_BUFFER_SIZE - 1)
+
+#if (UART_TX_BUFFER_SIZE < 2) || (UART_TX_BUFFER_SIZE > 128) || (UART_TX_BUFFER_SIZE & UART_TX_BUFFER_MASK)
+#error "UART TX buffer size must be a power of two from 2 to 128"
+#endif
+
+#if (UART_RX_BUFFER_SIZE < 2) || (UART_RX_BUFFER_SIZE > 128) || (UART_RX_BUFFER_SIZE & UART_RX_BUFFER_MASK)
+#error "UART RX buffer size must be a power of two from 2 to 128"
+#endif
+
+/*Stop the compiler moving the buffer accesses after the publication of an index*/
+#define UART_BARRIER()                           __asm__ __volatile__("" ::: "memory")
+
+/*
+ * 250 kbaud is exact at 8Mhz: UBRR = 8Mhz / (16 * 250000) - 1 = 1,
+ * one frame of 10 bits every 40us = 320 cycles
+ */
+#define UART_DEFAULT_BAUD_RATE                   250000UL
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef enum
+{
+	UART_NORMAL_SPEED, UART_DOUBLE_SPEED
+
+}UART_Speed;
+
+typedef enum
+{
+	UART_PARITY_DISABLED, UART_PARITY_EVEN = 2, UART_PARITY_ODD = 3
+
+}UART_Parity;
+
+typedef enum
+{
+	UART_ONE_STOP_BIT, UART_TWO_STOP_BITS
+
+}UART_StopBits;
+
+typedef struct
+{
+	uint32 baud_rate;
+	UART_Speed speed;
+	UART_Parity parity;
+	UART_StopBits stop_bits;
+
+}UART_ConfigType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description: Function to initialize the USART, 8 data bits, TX and RX with
+ *              the receive interrupt, the buffers are emptied
+ */
+void UART_init(const UART_ConfigType * Config_Ptr);
+
+/*
+ * Description: Function to stop the USART, PD0/PD1 go back to the ports
+ */
+void UART_deinit(void);
+
+/*
+ * Description: Function to queue one byte for transmission
+ *              Returns FALSE if the TX buffer is full
+ */
+bool UART_sendByte(uint8 data);
+
+/*
+ * Description: Function to queue a whole buffer for transmission, nothing is
+ *              queued if it doesn't fit so a frame is never cut
+ *              Returns FALSE if the TX buffer has not enough room
+ */
+bool UART_send(const uint8 * Data_Ptr, uint8 length);
+
+/*
+ * Description: Function to get the free room in the TX buffer
+ */
+uint8 UART_getTxFree(void);
+
+/*
+ * Description: Function to take the oldest received byte
+ *              Returns FALSE if nothing was received
+ */
+bool UART_receiveByte(uint8 * Data_Ptr);
+
+/*
+ * Description: Function to get the number of received bytes waiting
+ */
+uint8 UART_getRxCount(void);
+
+/*
+ * Description: Function to get the number of received bytes lost, RX buffer
+ *              full or overrun of the hardware
+ */
+uint16 UART_getRxOverflows(void);
+
+/*
+ * Description: Function to get the number of received bytes with a frame or
+ *              parity error, they are dropped
+ */
+uint16 UART_getRxErrors(void);
+
+#endif /* UART_H_ */
@@ -0,0 +1,62 @@
+#!/bin/sh
+#
+# Build the benchmark firmware (Code/benchmark.c) and run it under simavr,
+# ATmega16 at 8Mhz, the results are printed as CSV "name,cycles".
+# The run fails if a result of the firmware differs from its known value.
+#
+# usage: Tools/benchmark.sh [previous_results.csv]
+#        with previous results a third column gives the difference in cycles
+#
+# environment: AVR_GCC          (default avr-gcc)
+#              SIMAVR           (default simavr)
+#              SIMAVR_INCLUDE   directory of avr_mcu_section.h
+#                               (default /usr/include/simavr/avr)
+#              BUILD_DIR        (default Tools/build)
+#              BENCHMARK_CFLAGS options added to the build, for instance
+#                               -DEXTERNAL_INTERRUPT_ENCODER_MODE=TRUE for
+#                               the encoder benchmarks
+#
+
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+AVR_GCC=${AVR_GCC:-avr-gcc}
+SIMAVR=${SIMAVR:-simavr}
+SIMAVR_INCLUDE=${SIMAVR_INCLUDE:-/usr/include/simavr/avr}
+BUILD_DIR=${BUILD_DIR:-$ROOT/Tools/build}
+PREVIOUS=$1
+
+mkdir -p "$BUILD_DIR"
+
+# Same options as the firmware, the .mmcu section tells simavr the part and clock
+"$AVR_GCC" -mmcu=atmega16 -DF_CPU=8000000UL -DBENCHMARK -Os -std=gnu99 $BENCHMARK_CFLAGS \
+	-I"$ROOT/Code" -I"$SIMAVR_INCLUDE" \
+	-Wl,--undefined=_mmcu,--section-start=.mmcu=0x910000 \
+	"$ROOT"/Code/*.c -o "$BUILD_DIR/benchmark.elf"
+
+# simavr prints the console lines with its own prefix, keep what follows "benchmark,"
+"$SIMAVR" "$BUILD_DIR/benchmark.elf" > "$BUILD_DIR/benchmark.log" 2>&1 || true
+sed -n 's/.*benchmark,\([^,]*\),\([0-9]*\).*/\1,\2/p' "$BUILD_DIR/benchmark.log" | \
+	grep -v '^done,' > "$BUILD_DIR/benchmark.csv" || true
+
+if [ ! -s "$BUILD_DIR/benchmark.csv" ]; then
+	echo "benchmark: no results from simavr" >&2
+	exit 1
+fi
+
+# A result different from its known value: the kernel is wrong, whatever its cycles
+if grep -q 'benchmark_error,' "$BUILD_DIR/benchmark.log"; then
+	sed -n 's/.*benchmark_error,\([^,]*\),\(-*[0-9]*\).*/benchmark: wrong result of \1: \2/p' \
+		"$BUILD_DIR/benchmark.log" >&2
+	exit 1
+fi
+
+if [ -n "$PREVIOUS" ]; then
+	echo "name,cycles,delta"
+	awk -F, 'NR == FNR { if ($1 != "name") previous[$1] = $2; next }
+		{ delta = ($1 in previous) ? $2 - previous[$1] : "new"; print $1 "," $2 "," delta }' \
+		"$PREVIOUS" "$BUILD_DIR/benchmark.csv"
+else
+	echo "name,cycles"
+	cat "$BUILD_DIR/benchmark.csv"
+fi
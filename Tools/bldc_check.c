@@ -0,0 +1,175 @@
+/**********************************************************************************
+ * [FILE NAME]: bldc_check.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Host tool running the sensorless six-step driver
+ *                (Code/bldc_motor.h) on the model of the motor
+ *                (Code/bldc_plant.h), from rest to the closed loop:
+ *
+ *                gcc -O2 -DHOST_SIMULATION -DBLDC_MOTOR=TRUE -ICode \
+ *                    -o bldc_check Tools/bldc_check.c Code/bldc_motor.c \
+ *                    Code/bldc_plant.c Code/timers.c Code/hal_host.c -lm
+ *                bldc_check
+ *
+ *                For each duty, from 20% to full: align, ramp and close the
+ *                loop from rest, then watch the gates for 60 steps. Checks:
+ *                - BLDC_RUNNING reached, no step with both sides of a phase on
+ *                - The step period of the driver against the speed of the
+ *                  model
+ *                - The electrical angle of the model at every change of the
+ *                  gates against the ideal commutation, 30 degrees after a
+ *                  zero crossing of the back-EMF
+ *                - Gates off after Bldc_stop
+ *                One line per figure "name,value,limit", the exit code is 1
+ *                if a check fails. The gates are polled every microsecond and
+ *                the model moves every 10us, which bounds the angle error
+ *                measured to about 0.7 degrees at full speed.
+ *
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "bldc_motor.h"
+#include "bldc_plant.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#if (BLDC_MOTOR == DISABLE)
+#error "Build with -DBLDC_MOTOR=TRUE"
+#endif
+
+#define CHECK_START_MS                           1500
+#define CHECK_STEPS                              60
+#define CHECK_POLL_US                            1
+#define CHECK_TIMEOUT_US                         500000UL
+
+/* Angle of the rotor at the init, not on a step boundary */
+#define CHECK_START_ANGLE                        1.0
+
+/* Limits: worst commutation error in electrical degrees, step period against the speed */
+#define CHECK_ANGLE_LIMIT                        1.5
+#define CHECK_PERIOD_LIMIT                       0.05
+
+/* Duties of OC0 checked: 20%, 50%, full */
+#define CHECK_DUTIES                             3
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* 12V motor with 2 pole pairs, L/R = 0.5ms, about 600 rad/s without load */
+static const BldcPlant_ConfigType g_checkPlant =
+{
+		1.0, 0.5e-3, 0.01, 0.01, 2, 2e-5, 1e-5, 1e-3, 12.0, 0.05, 10e-6
+};
+
+static const uint8 g_checkDuties[CHECK_DUTIES] = {51, 128, 255};
+
+static int g_checkFailed = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static void Check_report(const char * name, uint8 duty, double value, double limit)
+{
+	printf("%s_%u,%g,%g\n", name, duty, value, limit);
+	if(value > limit)
+	{
+		fprintf(stderr, "bldc_check: %s at duty %u %g beyond %g\n", name, duty, value, limit);
+		g_checkFailed = 1;
+	}
+}
+
+/*
+ * Description: error of the electrical angle (rad) to the nearest ideal
+ *              commutation, in degrees between -30 and 30
+ */
+static double Check_angleError(double electrical_angle)
+{
+	double degrees = fmod(electrical_angle * 180.0 / M_PI - 30.0 + 720.0, 60.0);
+
+	return (degrees > 30.0) ? (degrees - 60.0) : degrees;
+}
+
+/*
+ * Description: start from rest at one duty and check the closed loop
+ */
+static void Check_duty(uint8 duty)
+{
+	Timer_ConfigType pwm = {0};
+	BldcPlant_StateType state;
+	uint8 gates;
+	uint8 last;
+	double worst = 0;
+	double period;
+	uint8 steps = 0;
+	uint32 waited = 0;
+
+	HostHal_reset();
+	sei();
+	pwm.COM = Clear;
+	pwm.timer_ID = BLDC_PWM_TIMER;
+	pwm.timer_clock = F_CPU_8;
+	pwm.timer_mode = FAST_PWM;
+	Timer_init(&pwm);
+
+	BldcPlant_init(&g_checkPlant, CHECK_START_ANGLE);
+	Bldc_init();
+	Bldc_setDuty(duty);
+	(void)Bldc_start();
+	_delay_ms(CHECK_START_MS);
+
+	Check_report("not_running", duty, Bldc_getState() != BLDC_RUNNING, 0);
+
+	last = HostHal_peek8(PORTC_ADDRESS) & BLDC_GATE_MASK;
+	while( (steps < CHECK_STEPS) && (waited < CHECK_TIMEOUT_US) )
+	{
+		_delay_us(CHECK_POLL_US);
+		waited += CHECK_POLL_US;
+		gates = HostHal_peek8(PORTC_ADDRESS) & BLDC_GATE_MASK;
+		if(gates != last)
+		{
+			BldcPlant_getState(&state);
+			worst = fmax(worst, fabs(Check_angleError(state.electrical_angle)));
+			last = gates;
+			steps++;
+		}
+	}
+
+	/* 60 electrical degrees at the speed of the model, in us */
+	BldcPlant_getState(&state);
+	period = (M_PI / 3.0) / (fabs(state.speed) * g_checkPlant.pole_pairs) * 1e6;
+
+	Check_report("missing_steps", duty, CHECK_STEPS - steps, 0);
+	Check_report("commutation_error_deg", duty, worst, CHECK_ANGLE_LIMIT);
+	Check_report("step_period_error", duty, fabs(Bldc_getStepPeriod() - period) / period, CHECK_PERIOD_LIMIT);
+	Check_report("shoot_through", duty, state.shoot_through, 0);
+	printf("speed_rad_s_%u,%g,\n", duty, state.speed);
+
+	Bldc_stop();
+	Check_report("gates_on_after_stop", duty, HostHal_peek8(PORTC_ADDRESS) & BLDC_GATE_MASK, 0);
+	BldcPlant_deinit();
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+int main(void)
+{
+	uint8 i;
+
+	printf("name,value,limit\n");
+	for(i = 0; i < CHECK_DUTIES; i++)
+	{
+		Check_duty(g_checkDuties[i]);
+	}
+
+	return g_checkFailed;
+}
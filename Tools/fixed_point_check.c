@@ -0,0 +1,174 @@
+/**********************************************************************************
+ * [FILE NAME]: fixed_point_check.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Host tool checking the fixed point math (Code/fixed_point.h)
+ *                against the exact results, 64-bit integers and doubles:
+ *
+ *                gcc -O2 -DHOST_SIMULATION -ICode -o fixed_point_check \
+ *                    Tools/fixed_point_check.c Code/fixed_point.c -lm
+ *                fixed_point_check [samples]
+ *
+ *                The host build runs the C reference of every operation only.
+ *                The assembly of the AVR is checked by the benchmark firmware
+ *                (Tools/benchmark.sh) against results of this reference, the
+ *                saturations included. One line per operation
+ *                "name,samples,worst error in LSB", the exit code is 1 if an
+ *                error is above its limit.
+ *
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fixed_point.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define CHECK_DEFAULT_SAMPLES                    1000000L
+#define CHECK_PI                                 3.14159265358979323846
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static uint32 g_checkRandom = 0X12345678UL;
+static int g_checkFailed = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: xorshift32, the same samples on every run
+ */
+static uint32 Check_random(void)
+{
+	g_checkRandom ^= g_checkRandom << 13;
+	g_checkRandom ^= g_checkRandom >> 17;
+	g_checkRandom ^= g_checkRandom << 5;
+	return g_checkRandom;
+}
+
+/*
+ * Description: random value of 1 to 32 significant bits, the small ones too
+ */
+static sint32 Check_randomValue(void)
+{
+	uint8 bits = (uint8)(Check_random() % 32) + 1;
+	uint32 value = Check_random() >> (32 - bits);
+
+	return (Check_random() & 1) ? -(sint32)value : (sint32)value;
+}
+
+static sint64 Check_saturate(sint64 value, sint64 min, sint64 max)
+{
+	return (value > max) ? max : ((value < min) ? min : value);
+}
+
+static void Check_report(const char * name, long samples, double worst, double limit)
+{
+	printf("%s,%ld,%g\n", name, samples, worst);
+	if(worst > limit)
+	{
+		fprintf(stderr, "fixed_point_check: %s error %g above %g\n", name, worst, limit);
+		g_checkFailed = 1;
+	}
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+int main(int argc, char * argv[])
+{
+	long samples = (argc > 1) ? atol(argv[1]) : CHECK_DEFAULT_SAMPLES;
+	long i;
+	sint32 a;
+	sint32 b;
+	double error;
+	double worst_add16 = 0, worst_sub16 = 0, worst_add32 = 0, worst_sub32 = 0;
+	double worst_mul_u16 = 0, worst_mul_s16 = 0, worst_mul_su16 = 0;
+	double worst_mul_q15 = 0, worst_mul_q7_8 = 0, worst_mul_q16_16 = 0;
+	double worst_reciprocal = 0, worst_sqrt = 0, worst_sin = 0, worst_cos = 0;
+	double exact;
+	uint32 angle;
+
+	for(i = 0; i < samples; i++)
+	{
+		a = Check_randomValue();
+		b = Check_randomValue();
+
+		/* exact operations, any difference is a bug */
+		error = fabs((double)Fixed_add16((sint16)a, (sint16)b) - Check_saturate((sint64)(sint16)a + (sint16)b, -32768, 32767));
+		worst_add16 = (error > worst_add16) ? error : worst_add16;
+		error = fabs((double)Fixed_sub16((sint16)a, (sint16)b) - Check_saturate((sint64)(sint16)a - (sint16)b, -32768, 32767));
+		worst_sub16 = (error > worst_sub16) ? error : worst_sub16;
+		error = fabs((double)Fixed_add32(a, b) - Check_saturate((sint64)a + b, FIXED_Q16_16_MIN, FIXED_Q16_16_MAX));
+		worst_add32 = (error > worst_add32) ? error : worst_add32;
+		error = fabs((double)Fixed_sub32(a, b) - Check_saturate((sint64)a - b, FIXED_Q16_16_MIN, FIXED_Q16_16_MAX));
+		worst_sub32 = (error > worst_sub32) ? error : worst_sub32;
+
+		error = fabs((double)Fixed_mulU16((uint16)a, (uint16)b) - (double)((uint64)(uint16)a * (uint16)b));
+		worst_mul_u16 = (error > worst_mul_u16) ? error : worst_mul_u16;
+		error = fabs((double)Fixed_mulS16((sint16)a, (sint16)b) - (double)((sint64)(sint16)a * (sint16)b));
+		worst_mul_s16 = (error > worst_mul_s16) ? error : worst_mul_s16;
+		error = fabs((double)Fixed_mulSU16((sint16)a, (uint16)b) - (double)((sint64)(sint16)a * (uint16)b));
+		worst_mul_su16 = (error > worst_mul_su16) ? error : worst_mul_su16;
+
+		/* products rounded toward minus infinity, floor of the exact one */
+		error = fabs((double)Fixed_mulQ15((sint16)a, (sint16)b) -
+				Check_saturate(((sint64)(sint16)a * (sint16)b) >> 15, -32768, 32767));
+		worst_mul_q15 = (error > worst_mul_q15) ? error : worst_mul_q15;
+		error = fabs((double)Fixed_mulQ7_8((sint16)a, (sint16)b) -
+				Check_saturate(((sint64)(sint16)a * (sint16)b) >> 8, -32768, 32767));
+		worst_mul_q7_8 = (error > worst_mul_q7_8) ? error : worst_mul_q7_8;
+		error = fabs((double)Fixed_mulQ16_16(a, b) -
+				Check_saturate(((sint64)a * b) >> 16, FIXED_Q16_16_MIN, FIXED_Q16_16_MAX));
+		worst_mul_q16_16 = (error > worst_mul_q16_16) ? error : worst_mul_q16_16;
+
+		/* approximations, relative error of the reciprocal in units of 2^-15 */
+		if(a != 0)
+		{
+			exact = Check_saturate((sint64)llround(4294967296.0 / a), -FIXED_Q16_16_MAX, FIXED_Q16_16_MAX);
+			error = fabs((double)Fixed_reciprocalQ16_16(a) - exact);
+			/* the rounding of the small results counts for one LSB */
+			error = (error <= 1) ? 0 : error / fabs(exact) * 32768.0;
+			worst_reciprocal = (error > worst_reciprocal) ? error : worst_reciprocal;
+		}
+		exact = (a > 0) ? floor(sqrt((double)a * 65536.0) + 0.5) : 0;
+		error = fabs((double)Fixed_sqrtQ16_16(a) - exact);
+		worst_sqrt = (error > worst_sqrt) ? error : worst_sqrt;
+	}
+
+	for(angle = 0; angle < 0X10000UL; angle++)
+	{
+		error = fabs(Fixed_sinQ15((uint16)angle) - 32768.0 * sin(angle * CHECK_PI / 32768.0));
+		worst_sin = (error > worst_sin) ? error : worst_sin;
+		error = fabs(Fixed_cosQ15((uint16)angle) - 32768.0 * cos(angle * CHECK_PI / 32768.0));
+		worst_cos = (error > worst_cos) ? error : worst_cos;
+	}
+
+	printf("name,samples,worst_error_lsb\n");
+	Check_report("add16", samples, worst_add16, 0);
+	Check_report("sub16", samples, worst_sub16, 0);
+	Check_report("add32", samples, worst_add32, 0);
+	Check_report("sub32", samples, worst_sub32, 0);
+	Check_report("mul_u16", samples, worst_mul_u16, 0);
+	Check_report("mul_s16", samples, worst_mul_s16, 0);
+	Check_report("mul_su16", samples, worst_mul_su16, 0);
+	Check_report("mul_q15", samples, worst_mul_q15, 0);
+	Check_report("mul_q7_8", samples, worst_mul_q7_8, 0);
+	Check_report("mul_q16_16", samples, worst_mul_q16_16, 0);
+	Check_report("reciprocal_q16_16", samples, worst_reciprocal, 2);
+	Check_report("sqrt_q16_16", samples, worst_sqrt, 0);
+	Check_report("sin_q15", 0X10000L, worst_sin, 2);
+	Check_report("cos_q15", 0X10000L, worst_cos, 2);
+
+	return g_checkFailed;
+}
@@ -0,0 +1,370 @@
+/**********************************************************************************
+ * [FILE NAME]: hal_host_check.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Host regression test of the drivers on the simulated
+ *                ATmega16 (Code/hal_host.h):
+ *
+ *                gcc -O2 -DHOST_SIMULATION -ICode -o hal_host_check \
+ *                    Tools/hal_host_check.c Code/hal_host.c Code/adc.c \
+ *                    Code/timers.c Code/lcd.c Code/external_interrupts.c \
+ *                    Code/event_queue.c Code/power.c Code/eeprom_store.c \
+ *                    Code/crc8.c
+ *                hal_host_check
+ *
+ *                Every check drives a driver through its API and reads the
+ *                result from outside, as the hardware would show it: the ADC
+ *                value and its conversion time, the rate of the tick, the
+ *                edges of INT1, the time stamps of the event queue, the CPU
+ *                utilization of the power manager with a long tick vector,
+ *                the text of the LCD, the duty of OC0 and the records of the
+ *                EEPROM across a reset. One line per check
+ *                "name,value,expected", the exit code is 1 if one fails.
+ *
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "micro_config.h"
+#include "adc.h"
+#include "timers.h"
+#include "lcd.h"
+#include "external_interrupts.h"
+#include "eeprom_store.h"
+#include "event_queue.h"
+#include "power.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/* ADC clock F_CPU/8, 13 ADC clocks a conversion, 25 for the first one */
+#define CHECK_ADC_CYCLES_MIN                     (13UL * 8UL)
+#define CHECK_ADC_CYCLES_MAX                     (25UL * 8UL + 16UL)
+
+/* Tick of the application: F_CPU/128/(249+1) = 250Hz */
+#define CHECK_TICK_CLOCK                         F_CPU_1024
+#define CHECK_TICK_COMPARE                       249
+#define CHECK_TICKS_PER_SECOND                   250
+
+#define CHECK_EEPROM_VERSION                     1
+
+/* Cycles between two events posted */
+#define CHECK_EVENT_CYCLES                       800
+
+/* Tick vector kept busy 10% of the period (32000 cycles), in per mille */
+#define CHECK_POWER_BUSY_CYCLES                  3200UL
+#define CHECK_POWER_UTILIZATION                  100
+
+/* Port D = 3 of HostHal_setInputPin */
+#define CHECK_PORT_D                             3
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static volatile uint16 g_checkTicks = 0;
+static volatile uint16 g_checkEdges = 0;
+static int g_checkFailed = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static void Check_tick(void)
+{
+	g_checkTicks++;
+}
+
+static void Check_edge(void)
+{
+	g_checkEdges++;
+}
+
+static void Check_busyTick(void)
+{
+	g_checkTicks++;
+	Power_tick();
+	HostHal_advance(CHECK_POWER_BUSY_CYCLES);
+}
+
+static void Check_report(const char * name, long value, long min, long max)
+{
+	if(min == max)
+	{
+		printf("%s,%ld,%ld\n", name, value, min);
+	}
+	else
+	{
+		printf("%s,%ld,%ld:%ld\n", name, value, min, max);
+	}
+
+	if( (value < min) || (value > max) )
+	{
+		fprintf(stderr, "hal_host_check: %s %ld out of %ld:%ld\n", name, value, min, max);
+		g_checkFailed = 1;
+	}
+}
+
+/*
+ * Description: conversions of two channels with their duration
+ */
+static void Check_adc(void)
+{
+	uint64 start;
+	uint16 value;
+
+	ADC_init();
+	HostHal_setAdcInput(0, 777);
+	HostHal_setAdcInput(5, 12);
+
+	start = HostHal_getCycles();
+	value = ADC_readChannel(0);
+	Check_report("adc_value", value, 777, 777);
+	Check_report("adc_cycles", (long)(HostHal_getCycles() - start), CHECK_ADC_CYCLES_MIN, CHECK_ADC_CYCLES_MAX);
+	Check_report("adc_channel", ADC_readChannel(5), 12, 12);
+}
+
+/*
+ * Description: the compare interrupt of Timer2 for one simulated second
+ */
+static void Check_timer(void)
+{
+	Timer_ConfigType tick = {0};
+
+	tick.COM = Disconnected;
+	tick.timer_ID = Timer2;
+	tick.timer_clock = CHECK_TICK_CLOCK;
+	tick.timer_mode = Compare;
+	tick.timer_compare_MatchValue = CHECK_TICK_COMPARE;
+	Timer_setCallBack(Check_tick, Timer2);
+	Timer_init(&tick);
+
+	g_checkTicks = 0;
+	_delay_ms(1000);
+	Check_report("timer2_ticks_per_second", g_checkTicks, CHECK_TICKS_PER_SECOND - 1, CHECK_TICKS_PER_SECOND);
+	Timer_DeInit(Timer2);
+}
+
+/*
+ * Description: Timer_init and Timer_DeInit of Timer0 keep the compare
+ *              interrupt of Timer2, they share TIMSK
+ */
+static void Check_timerMask(void)
+{
+	Timer_ConfigType tick = {0};
+	Timer_ConfigType pwm = {0};
+
+	tick.COM = Disconnected;
+	tick.timer_ID = Timer2;
+	tick.timer_clock = CHECK_TICK_CLOCK;
+	tick.timer_mode = Compare;
+	tick.timer_compare_MatchValue = CHECK_TICK_COMPARE;
+	pwm.COM = Clear;
+	pwm.timer_ID = Timer0;
+	pwm.timer_clock = F_CPU_8;
+	pwm.timer_mode = FAST_PWM;
+	Timer_setCallBack(Check_tick, Timer2);
+	Timer_init(&tick);
+	Timer_init(&pwm);
+	Timer_DeInit(Timer0);
+
+	g_checkTicks = 0;
+	_delay_ms(1000);
+	Check_report("timer2_ticks_after_timer0", g_checkTicks, CHECK_TICKS_PER_SECOND - 1, CHECK_TICKS_PER_SECOND);
+	Timer_DeInit(Timer2);
+}
+
+/*
+ * Description: INT1 on the falling edges only
+ */
+static void Check_interrupt(void)
+{
+	External_Interrupt_ConfigType button = {0};
+
+	HostHal_setInputPin(CHECK_PORT_D, INTERRUPT1_PIN, 1);
+	button.INT_ID = INTERRUPT1;
+	button.INT_control = Falling;
+	Interrupt_setCallBack(Check_edge, INTERRUPT1);
+	External_Interrupt_init(&button);
+
+	g_checkEdges = 0;
+	HostHal_setInputPin(CHECK_PORT_D, INTERRUPT1_PIN, 0);
+	HostHal_setInputPin(CHECK_PORT_D, INTERRUPT1_PIN, 1);
+	HostHal_setInputPin(CHECK_PORT_D, INTERRUPT1_PIN, 0);
+	HostHal_setInputPin(CHECK_PORT_D, INTERRUPT1_PIN, 1);
+	_delay_ms(1);
+	Check_report("int1_falling_edges", g_checkEdges, 2, 2);
+}
+
+/*
+ * Description: two events posted apart, their time stamps in cycles
+ */
+static void Check_eventQueue(void)
+{
+	Event_RecordType first;
+	Event_RecordType second;
+
+	EventQueue_init();
+	(void)EventQueue_postFromMain(EVENT_APPLICATION, 1);
+	HostHal_advance(CHECK_EVENT_CYCLES);
+	(void)EventQueue_postFromMain(EVENT_APPLICATION, 2);
+	(void)EventQueue_get(&first);
+	(void)EventQueue_get(&second);
+
+	/* the posts themselves access registers, a few cycles more */
+	Check_report("event_timestamp_cycles", (uint16)(second.timestamp - first.timestamp),
+			CHECK_EVENT_CYCLES, CHECK_EVENT_CYCLES + 16);
+	Timer_DeInit(Timer1);
+}
+
+/*
+ * Description: an empty loop sleeping, the tick vector is the only work: the
+ *              utilization of one window and the host cycles asleep are both
+ *              its share of the period
+ */
+static void Check_power(void)
+{
+	Timer_ConfigType tick = {0};
+	uint64 cycles;
+	uint64 sleep;
+
+	tick.COM = Disconnected;
+	tick.timer_ID = Timer2;
+	tick.timer_clock = CHECK_TICK_CLOCK;
+	tick.timer_mode = Compare;
+	tick.timer_compare_MatchValue = CHECK_TICK_COMPARE;
+	Timer_setCallBack(Check_busyTick, Timer2);
+	Timer_init(&tick);
+	Power_init();
+
+	g_checkTicks = 0;
+	cycles = HostHal_getCycles();
+	sleep = HostHal_getSleepCycles();
+	while(g_checkTicks < POWER_WINDOW_TICKS)
+	{
+		cli();
+		Power_sleep(POWER_IDLE);
+		sei();
+	}
+	cycles = HostHal_getCycles() - cycles;
+	sleep = HostHal_getSleepCycles() - sleep;
+
+	/*
+	 * the loop and the vector access a few registers more. The model raises
+	 * the compare flag one count (4 per mille) before the hardware, which
+	 * sets it with the clear of the counter, and the vector of the last tick
+	 * falls in the next window
+	 */
+	Check_report("power_utilization_per_mille", Power_getUtilization(),
+			CHECK_POWER_UTILIZATION - 5, CHECK_POWER_UTILIZATION + 5);
+	Check_report("host_awake_per_mille", (long)((cycles - sleep) * 1000 / cycles),
+			CHECK_POWER_UTILIZATION, CHECK_POWER_UTILIZATION + 5);
+	Timer_DeInit(Timer2);
+}
+
+/*
+ * Description: text of both rows, the number written over the string
+ */
+static void Check_lcd(void)
+{
+	char row[HOST_HAL_LCD_COLUMNS + 1];
+
+	LCD_init();
+	LCD_clearScreen();
+	LCD_displayString("ADC Value = ");
+	LCD_goToRowColumn(0, 12);
+	LCD_intgerToString(777);
+	LCD_displayStringRowColumn(1, 0, "CPU 5%");
+
+	HostHal_getLcdRow(0, row);
+	Check_report("lcd_row0", strcmp(row, "ADC Value = 777 "), 0, 0);
+	HostHal_getLcdRow(1, row);
+	Check_report("lcd_row1", strcmp(row, "CPU 5%          "), 0, 0);
+}
+
+/*
+ * Description: fast PWM of Timer0, non-inverting: HIGH (OCR0 + 1) / 256
+ */
+static void Check_pwm(void)
+{
+	Timer_ConfigType pwm = {0};
+
+	pwm.COM = Clear;
+	pwm.timer_ID = Timer0;
+	pwm.timer_clock = F_CPU_8;
+	pwm.timer_mode = FAST_PWM;
+	Timer_init(&pwm);
+	Timer_changeCompareValue(Timer0, 127, 0);
+	_delay_ms(1);
+
+	Check_report("pwm_oc0_duty_q16", (long)HostHal_getPwmDuty(0, 0), 0X8000, 0X8000);
+}
+
+/*
+ * Description: two saves, the newest loaded after a reset, then the
+ *              previous one once the newest is corrupted
+ */
+static void Check_eeprom(void)
+{
+	uint32 first = 0X11223344UL;
+	uint32 second = 0X55667788UL;
+	uint32 loaded = 0;
+	uint8 * eeprom_Ptr;
+
+	/* erased EEPROM, the scan makes the next save go to the first slot */
+	memset(HostHal_getEeprom(), 0XFF, HOST_HAL_EEPROM_SIZE);
+	(void)EepromStore_load(&loaded, sizeof(loaded), CHECK_EEPROM_VERSION);
+
+	(void)EepromStore_save(&first, sizeof(first), CHECK_EEPROM_VERSION);
+	while(EepromStore_isBusy())
+	{
+		_delay_ms(1);
+	}
+	(void)EepromStore_save(&second, sizeof(second), CHECK_EEPROM_VERSION);
+	while(EepromStore_isBusy())
+	{
+		_delay_ms(1);
+	}
+
+	/* the content is kept, like a power cycle */
+	HostHal_reset();
+	sei();
+	Check_report("eeprom_load", EepromStore_load(&loaded, sizeof(loaded), CHECK_EEPROM_VERSION), TRUE, TRUE);
+	Check_report("eeprom_newest", loaded == second, TRUE, TRUE);
+
+	/* a byte of the payload of the second slot */
+	eeprom_Ptr = HostHal_getEeprom();
+	eeprom_Ptr[EEPROM_STORE_BASE_ADDRESS + EEPROM_STORE_SLOT_SIZE + EEPROM_STORE_HEADER_SIZE] ^= 0X01;
+	HostHal_reset();
+	sei();
+	loaded = 0;
+	(void)EepromStore_load(&loaded, sizeof(loaded), CHECK_EEPROM_VERSION);
+	Check_report("eeprom_corrupted_falls_back", loaded == first, TRUE, TRUE);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+int main(void)
+{
+	HostHal_reset();
+	sei();
+
+	printf("name,value,expected\n");
+	Check_adc();
+	Check_timer();
+	Check_timerMask();
+	Check_interrupt();
+	Check_eventQueue();
+	Check_power();
+	Check_lcd();
+	Check_pwm();
+	Check_eeprom();
+
+	return g_checkFailed;
+}
@@ -0,0 +1,281 @@
+/**********************************************************************************
+ * [FILE NAME]: motion_planner_check.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Host tool checking the profiles of the motion planner
+ *                (Code/motion_planner.h) against the continuous time S-curve
+ *                and trapezoid of the same move, in doubles:
+ *
+ *                gcc -O2 -DHOST_SIMULATION -ICode -o motion_planner_check \
+ *                    Tools/motion_planner_check.c Code/motion_planner.c \
+ *                    Code/timers.c Code/hal_host.c -lm
+ *                motion_planner_check
+ *
+ *                Every move runs tick by tick. The target, the velocity and
+ *                acceleration limits and a velocity which never reverses are
+ *                exact checks. The duration and the position at every tick
+ *                are compared with the reference. One line per move
+ *                "name,ticks,reference ticks,worst position error in counts",
+ *                the exit code is 1 if a check fails.
+ *
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "motion_planner.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define CHECK_FREQUENCY                          ((double)MOTION_PLANNER_TICK_FREQUENCY)
+#define CHECK_ONE                                65536.0
+#define CHECK_MAX_TICKS                          1000000UL
+
+/*
+ * The planner rounds the limits to Q16.16 and the segments to whole ticks,
+ * the reference doesn't: the duration may differ by this fraction plus
+ * CHECK_DURATION_TICKS, the position by this fraction of the distance plus
+ * CHECK_POSITION_TICKS ticks at the max velocity
+ */
+#define CHECK_TOLERANCE                          0.005
+#define CHECK_DURATION_TICKS                     4
+#define CHECK_POSITION_TICKS                     2.0
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	const char * name;
+	sint32 start;
+	MotionPlanner_MoveType move;
+
+}Check_CaseType;
+
+/* Continuous time profile, durations in seconds */
+typedef struct
+{
+	double jerk;
+	double jerk_time;      /* of each of the 4 jerk parts */
+	double accel_time;     /* of each of the 2 constant acceleration parts */
+	double cruise_time;
+	double acceleration;   /* reached at the end of the first jerk part */
+	double peak_velocity;
+
+}Check_ReferenceType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static const Check_CaseType g_checkCases[] =
+{
+		{"trapezoid",             0,  {100000, 20000,  50000,       0}},
+		{"trapezoid_short",       0,    {2000, 20000,  50000,       0}},
+		{"trapezoid_reverse",  5000,  {-40000, 10000,  20000,       0}},
+		{"s_curve",               0,  {100000, 20000,  50000,  500000}},
+		{"s_curve_no_accel_part", 0,  {100000, 20000, 200000, 2000000}},
+		{"s_curve_short",         0,    {3000, 20000,  50000,  500000}},
+		{"s_curve_very_short",    0,     {200, 20000,  50000,  500000}},
+		{"s_curve_reverse",   80000,       {0, 15000,  30000, 1000000}},
+};
+
+static int g_checkFailed = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: durations of the minimum time profile covering distance,
+ *              limited by velocity, acceleration and jerk (0 = trapezoid)
+ */
+static void Check_plan(double distance, double velocity, double acceleration, double jerk,
+		Check_ReferenceType * Reference_Ptr)
+{
+	double jerk_time = (jerk > 0) ? (acceleration / jerk) : 0;
+	double accel_time;
+
+	/* the max velocity is reached before the max acceleration */
+	if( (jerk > 0) && (jerk * jerk_time * jerk_time > velocity) )
+	{
+		jerk_time = sqrt(velocity / jerk);
+	}
+	acceleration = (jerk > 0) ? (jerk * jerk_time) : acceleration;
+	accel_time = velocity / acceleration - jerk_time;
+
+	/* too short for the max velocity: largest constant acceleration part */
+	if(velocity * (2 * jerk_time + accel_time) > distance)
+	{
+		accel_time = (-3 * jerk_time + sqrt(jerk_time * jerk_time + 4 * distance / acceleration)) / 2;
+		if(accel_time < 0)
+		{
+			/* then shorter jerk parts */
+			accel_time = 0;
+			jerk_time = cbrt(distance / (2 * jerk));
+			acceleration = jerk * jerk_time;
+		}
+		velocity = acceleration * (jerk_time + accel_time);
+	}
+
+	Reference_Ptr->jerk = jerk;
+	Reference_Ptr->jerk_time = jerk_time;
+	Reference_Ptr->accel_time = accel_time;
+	Reference_Ptr->acceleration = acceleration;
+	Reference_Ptr->peak_velocity = velocity;
+	Reference_Ptr->cruise_time = (distance - velocity * (2 * jerk_time + accel_time)) / velocity;
+}
+
+static double Check_duration(const Check_ReferenceType * Reference_Ptr)
+{
+	return 4 * Reference_Ptr->jerk_time + 2 * Reference_Ptr->accel_time + Reference_Ptr->cruise_time;
+}
+
+/*
+ * Description: distance of the reference at the time t, integrating the 7
+ *              parts of constant jerk in closed form
+ */
+static double Check_position(const Check_ReferenceType * Reference_Ptr, double time)
+{
+	const double jerk = Reference_Ptr->jerk;
+	double parts[7][2];
+	double acceleration = 0;
+	double velocity = 0;
+	double position = 0;
+	double step;
+	int i;
+
+	parts[0][0] =  jerk; parts[0][1] = Reference_Ptr->jerk_time;
+	parts[1][0] =  0;    parts[1][1] = Reference_Ptr->accel_time;
+	parts[2][0] = -jerk; parts[2][1] = Reference_Ptr->jerk_time;
+	parts[3][0] =  0;    parts[3][1] = Reference_Ptr->cruise_time;
+	parts[4][0] = -jerk; parts[4][1] = Reference_Ptr->jerk_time;
+	parts[5][0] =  0;    parts[5][1] = Reference_Ptr->accel_time;
+	parts[6][0] =  jerk; parts[6][1] = Reference_Ptr->jerk_time;
+
+	/* the trapezoid steps the acceleration at the start of its ramps */
+	if(jerk == 0)
+	{
+		acceleration = Reference_Ptr->acceleration;
+	}
+
+	for(i = 0; (i < 7) && (time > 0); i++)
+	{
+		if( (jerk == 0) && (i == 3) )
+		{
+			acceleration = 0;
+		}
+		else if( (jerk == 0) && (i == 5) )
+		{
+			acceleration = -Reference_Ptr->acceleration;
+		}
+
+		step = (time < parts[i][1]) ? time : parts[i][1];
+		position += velocity * step + acceleration * step * step / 2 + parts[i][0] * step * step * step / 6;
+		velocity += acceleration * step + parts[i][0] * step * step / 2;
+		acceleration += parts[i][0] * step;
+		time -= step;
+	}
+
+	return position;
+}
+
+static void Check_fail(const char * name, const char * what)
+{
+	fprintf(stderr, "motion_planner_check: %s %s\n", name, what);
+	g_checkFailed = 1;
+}
+
+/*
+ * Description: run one move and compare it with its reference
+ */
+static void Check_move(const Check_CaseType * Case_Ptr)
+{
+	const MotionPlanner_MoveType * move_Ptr = &Case_Ptr->move;
+	sint32 direction = (move_Ptr->target >= Case_Ptr->start) ? 1 : -1;
+	double distance = (double)(move_Ptr->target - Case_Ptr->start) * direction;
+	/* limits of the generator, the conversions of the planner round them down */
+	double velocity_limit = floor(move_Ptr->max_velocity * CHECK_ONE / CHECK_FREQUENCY);
+	double acceleration_limit = floor(move_Ptr->acceleration * CHECK_ONE / (CHECK_FREQUENCY * CHECK_FREQUENCY));
+	Check_ReferenceType reference;
+	double reference_ticks;
+	double error;
+	double worst = 0;
+	double previous = 0;
+	double velocity;
+	double acceleration;
+	uint32 ticks = 0;
+
+	Check_plan(distance, move_Ptr->max_velocity, move_Ptr->acceleration, move_Ptr->jerk, &reference);
+	reference_ticks = Check_duration(&reference) * CHECK_FREQUENCY;
+
+	MotionPlanner_init(move_Ptr->max_velocity, 0XFF);
+	MotionPlanner_setPosition(Case_Ptr->start);
+	if(!MotionPlanner_startMove(move_Ptr))
+	{
+		Check_fail(Case_Ptr->name, "not started");
+		return;
+	}
+
+	while(MotionPlanner_isBusy() && (ticks < CHECK_MAX_TICKS))
+	{
+		velocity = (double)MotionPlanner_tick() * direction;
+		acceleration = velocity - previous;
+		previous = velocity;
+		ticks++;
+
+		if( (velocity < 0) || (velocity > velocity_limit) )
+		{
+			Check_fail(Case_Ptr->name, "velocity out of range");
+		}
+		if(fabs(acceleration) > acceleration_limit)
+		{
+			Check_fail(Case_Ptr->name, "acceleration above the limit");
+		}
+
+		error = fabs((double)(MotionPlanner_getPosition() - Case_Ptr->start) * direction -
+				Check_position(&reference, ticks / CHECK_FREQUENCY));
+		worst = (error > worst) ? error : worst;
+	}
+
+	printf("%s,%lu,%.1f,%.2f\n", Case_Ptr->name, (unsigned long)ticks, reference_ticks, worst);
+
+	if(MotionPlanner_isBusy())
+	{
+		Check_fail(Case_Ptr->name, "never ends");
+	}
+	if(MotionPlanner_getPosition() != move_Ptr->target)
+	{
+		Check_fail(Case_Ptr->name, "target missed");
+	}
+	if(fabs(ticks - reference_ticks) > reference_ticks * CHECK_TOLERANCE + CHECK_DURATION_TICKS)
+	{
+		Check_fail(Case_Ptr->name, "duration off the reference");
+	}
+	if(worst > distance * CHECK_TOLERANCE + CHECK_POSITION_TICKS * move_Ptr->max_velocity / CHECK_FREQUENCY)
+	{
+		Check_fail(Case_Ptr->name, "position off the reference");
+	}
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+int main(void)
+{
+	uint8 i;
+
+	printf("name,ticks,reference_ticks,worst_position_error\n");
+	for(i = 0; i < sizeof(g_checkCases) / sizeof(g_checkCases[0]); i++)
+	{
+		Check_move(&g_checkCases[i]);
+	}
+
+	return g_checkFailed;
+}
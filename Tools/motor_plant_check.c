@@ -0,0 +1,277 @@
+/**********************************************************************************
+ * [FILE NAME]: motor_plant_check.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Host tool validating the model of the DC motor
+ *                (Code/motor_plant.h) and measuring its speed:
+ *
+ *                gcc -O2 -DHOST_SIMULATION -ICode -o motor_plant_check \
+ *                    Tools/motor_plant_check.c Code/motor_plant.c \
+ *                    Code/DCmotor.c Code/timers.c Code/hal_host.c -lm
+ *                motor_plant_check [simulated seconds]
+ *
+ *                - Validation: the motor driven at full duty from rest, then
+ *                  loaded, against the closed form step response of the
+ *                  linear model (no Coulomb friction) and its steady states
+ *                - Speed: simulated seconds per wall clock second, the bare
+ *                  model stepped directly, then with the PWM and the tick
+ *                  running on hal_host, the ADC and the encoder connected
+ *                One line per figure "name,value,limit", the exit code is 1
+ *                if the model is off its reference or slower than its limit.
+ *                The speed depends on the host: the limits are half of the
+ *                slowest runs on the machine of the check, 167 and 67 times
+ *                real time.
+ *
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <complex.h>
+#include <time.h>
+#include "motor_plant.h"
+#include "DCmotor.h"
+#include "timers.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#define CHECK_STEP_TIME                          20e-6
+#define CHECK_RESPONSE_TIME                      1.0
+#define CHECK_LOAD_TORQUE                        0.02
+#define CHECK_DEFAULT_SECONDS                    20.0
+
+/* Relative to the stall current and the steady speed, RK4 at 20us is far below */
+#define CHECK_RESPONSE_LIMIT                     1e-6
+#define CHECK_STEADY_LIMIT                       1e-6
+
+/* Simulated seconds per wall clock second, bare model and on hal_host */
+#define CHECK_REALTIME_FACTOR_BARE               80.0
+#define CHECK_REALTIME_FACTOR_HAL_HOST           32.0
+
+/* Tick of the application, F_CPU/128/(249+1) = 250Hz */
+#define CHECK_TICK_COMPARE                       249
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Small 12V motor, L/R = 0.5ms, mechanical time constant about 50ms */
+static MotorPlant_ConfigType g_checkPlant =
+{
+		2.0, 1e-3, 0.02, 0.02, 1e-5, 1e-6, 0, 12.0,
+		0, MOTOR_PLANT_NOT_CONNECTED, 0.5, MOTOR_PLANT_NOT_CONNECTED, 0.005, 0, 3, PD2, PD3, FALSE,
+		CHECK_STEP_TIME
+};
+
+static int g_checkFailed = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static double Check_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void Check_report(const char * name, double value, double limit, bool above)
+{
+	printf("%s,%g,%g\n", name, value, limit);
+	if(above ? (value < limit) : (value > limit))
+	{
+		fprintf(stderr, "motor_plant_check: %s %g beyond %g\n", name, value, limit);
+		g_checkFailed = 1;
+	}
+}
+
+/*
+ * Description: steady state of the linear model under a voltage and a load
+ */
+static void Check_steady(double voltage, double load, double * Current_Ptr, double * Speed_Ptr)
+{
+	const MotorPlant_ConfigType * p = &g_checkPlant;
+	double speed = (p->torque_constant * voltage / p->resistance - load) /
+			(p->viscous_friction + p->torque_constant * p->back_emf_constant / p->resistance);
+
+	*Speed_Ptr = speed;
+	*Current_Ptr = (voltage - p->back_emf_constant * speed) / p->resistance;
+}
+
+/*
+ * Description: closed form response of x' = A x + b from x0, with the two
+ *              eigenvalues of A (complex when underdamped)
+ */
+static void Check_response(double voltage, double load, double current0, double speed0, double time,
+		double * Current_Ptr, double * Speed_Ptr)
+{
+	const MotorPlant_ConfigType * p = &g_checkPlant;
+	double a11 = -p->resistance / p->inductance;
+	double a12 = -p->back_emf_constant / p->inductance;
+	double a21 = p->torque_constant / p->inertia;
+	double a22 = -p->viscous_friction / p->inertia;
+	double trace = a11 + a22;
+	double complex root = csqrt(trace * trace / 4 - (a11 * a22 - a12 * a21));
+	double complex l1 = trace / 2 + root;
+	double complex l2 = trace / 2 - root;
+	double complex c1;
+	double complex c2;
+	double current_ss;
+	double speed_ss;
+	double d_current;
+	double d_speed;
+
+	Check_steady(voltage, load, &current_ss, &speed_ss);
+	d_current = current0 - current_ss;
+	d_speed = speed0 - speed_ss;
+
+	/* eigenvectors (a12, l - a11), the start written on both of them */
+	c1 = (d_speed * a12 - d_current * (l2 - a11)) / (a12 * (l1 - l2));
+	c2 = (d_current - c1 * a12) / a12;
+
+	*Current_Ptr = current_ss + creal(c1 * a12 * cexp(l1 * time) + c2 * a12 * cexp(l2 * time));
+	*Speed_Ptr = speed_ss + creal(c1 * (l1 - a11) * cexp(l1 * time) + c2 * (l2 - a11) * cexp(l2 * time));
+}
+
+/*
+ * Description: Timer0 at full duty clock wise, Timer2 ticking like the application
+ */
+static void Check_startMotor(void)
+{
+	Timer_ConfigType pwm = {0};
+	Timer_ConfigType tick = {0};
+
+	HostHal_reset();
+	sei();
+
+	pwm.COM = Clear;
+	pwm.timer_ID = Timer0;
+	pwm.timer_clock = F_CPU_8;
+	pwm.timer_mode = FAST_PWM;
+	tick.COM = Disconnected;
+	tick.timer_ID = Timer2;
+	tick.timer_clock = F_CPU_1024;
+	tick.timer_mode = Compare;
+	tick.timer_compare_MatchValue = CHECK_TICK_COMPARE;
+
+	DC_motor_Init();
+	Timer_init(&pwm);
+	Timer_init(&tick);
+	Timer_changeCompareValue(Timer0, 0XFF, 0); /* HIGH (255 + 1) / 256 of the period */
+	DC_motor_on_ClockWise();
+}
+
+/*
+ * Description: start and load step against the closed form, model stepped directly
+ */
+static void Check_validate(void)
+{
+	const double voltage = g_checkPlant.supply_voltage;
+	MotorPlant_StateType state;
+	double current;
+	double speed;
+	double current0;
+	double speed0;
+	double current_ss;
+	double speed_ss;
+	double worst_current = 0;
+	double worst_speed = 0;
+	long steps = (long)(CHECK_RESPONSE_TIME / CHECK_STEP_TIME + 0.5);
+	long i;
+
+	Check_startMotor();
+	MotorPlant_init(&g_checkPlant);
+	MotorPlant_deinit(); /* stepped here, not by the hook */
+	Check_steady(voltage, 0, &current_ss, &speed_ss);
+
+	for(i = 1; i <= steps; i++)
+	{
+		MotorPlant_step();
+		MotorPlant_getState(&state);
+		Check_response(voltage, 0, 0, 0, i * CHECK_STEP_TIME, &current, &speed);
+		worst_current = fmax(worst_current, fabs(state.current - current));
+		worst_speed = fmax(worst_speed, fabs(state.speed - speed));
+	}
+	Check_report("start_voltage", state.voltage, voltage, TRUE);
+	Check_report("start_current_error", worst_current / (voltage / g_checkPlant.resistance), CHECK_RESPONSE_LIMIT, FALSE);
+	Check_report("start_speed_error", worst_speed / speed_ss, CHECK_RESPONSE_LIMIT, FALSE);
+
+	/* the load from the state reached, to its own steady state */
+	MotorPlant_setLoadTorque(CHECK_LOAD_TORQUE);
+	MotorPlant_getState(&state);
+	current0 = state.current;
+	speed0 = state.speed;
+	worst_current = 0;
+	worst_speed = 0;
+	for(i = 1; i <= steps; i++)
+	{
+		MotorPlant_step();
+		MotorPlant_getState(&state);
+		Check_response(voltage, CHECK_LOAD_TORQUE, current0, speed0, i * CHECK_STEP_TIME, &current, &speed);
+		worst_current = fmax(worst_current, fabs(state.current - current));
+		worst_speed = fmax(worst_speed, fabs(state.speed - speed));
+	}
+	Check_steady(voltage, CHECK_LOAD_TORQUE, &current_ss, &speed_ss);
+	Check_report("load_current_error", worst_current / (voltage / g_checkPlant.resistance), CHECK_RESPONSE_LIMIT, FALSE);
+	Check_report("load_speed_error", worst_speed / speed_ss, CHECK_RESPONSE_LIMIT, FALSE);
+	Check_report("load_steady_speed_error", fabs(state.speed - speed_ss) / speed_ss, CHECK_STEADY_LIMIT, FALSE);
+}
+
+/*
+ * Description: simulated seconds per wall clock second
+ */
+static void Check_speed(double seconds)
+{
+	long steps = (long)(seconds / CHECK_STEP_TIME + 0.5);
+	double start;
+	double factor;
+	long i;
+
+	Check_startMotor();
+	MotorPlant_init(&g_checkPlant);
+	MotorPlant_deinit();
+	start = Check_now();
+	for(i = 0; i < steps; i++)
+	{
+		MotorPlant_step();
+	}
+	factor = seconds / (Check_now() - start);
+	Check_report("realtime_factor_bare", factor, CHECK_REALTIME_FACTOR_BARE, TRUE);
+
+	/* with the microcontroller, sensors wired */
+	g_checkPlant.current_adc_channel = 1;
+	g_checkPlant.speed_adc_channel = 2;
+	g_checkPlant.encoder_lines = 100;
+	Check_startMotor();
+	MotorPlant_init(&g_checkPlant);
+	start = Check_now();
+	for(i = 0; i < (long)seconds; i++)
+	{
+		_delay_ms(1000);
+	}
+	factor = (double)(long)seconds / (Check_now() - start);
+	Check_report("realtime_factor_hal_host", factor, CHECK_REALTIME_FACTOR_HAL_HOST, TRUE);
+	MotorPlant_deinit();
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+int main(int argc, char * argv[])
+{
+	double seconds = (argc > 1) ? atof(argv[1]) : CHECK_DEFAULT_SECONDS;
+
+	printf("name,value,limit\n");
+	Check_validate();
+	Check_speed(seconds);
+
+	return g_checkFailed;
+}
@@ -0,0 +1,170 @@
+/**********************************************************************************
+ * [FILE NAME]: overcurrent_check.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Host tool checking the overcurrent protection
+ *                (Code/overcurrent.h) on the simulated ATmega16, both paths:
+ *
+ *                gcc -O2 -DHOST_SIMULATION -DOVERCURRENT_FAST_PATH=TRUE -ICode \
+ *                    -o overcurrent_check Tools/overcurrent_check.c \
+ *                    Code/overcurrent.c Code/adc.c Code/power.c Code/timers.c \
+ *                    Code/hal_host.c
+ *                overcurrent_check
+ *
+ *                - Slow path: a constant current above the nominal one, the
+ *                  trip after ceil(limit / (I^2 - In^2)) ticks, the retries
+ *                  from half the budget and the latch
+ *                - Fast path: a falling edge of the comparator disconnects
+ *                  OC0 at once, the latency measured by the input capture of
+ *                  Timer1 (OVERCURRENT_LATENCY_MEASUREMENT)
+ *                One line per check "name,value,expected", the exit code is 1
+ *                if one fails. The latency is the one of the host, which
+ *                counts the accesses to the registers only: no interrupt
+ *                response, no prologue. It is reported, not checked.
+ *
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include "overcurrent.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+#if (OVERCURRENT_FAST_PATH == DISABLE)
+#error "Build with -DOVERCURRENT_FAST_PATH=TRUE"
+#endif
+
+#define CHECK_CHANNEL                            1
+#define CHECK_NOMINAL                            400
+#define CHECK_CURRENT                            600
+#define CHECK_I2T_LIMIT                          20000000UL
+#define CHECK_RETRY_TICKS                        250
+#define CHECK_MAX_RETRIES                        3
+#define CHECK_MAX_TICKS                          10000
+
+/* COM01:0 of TCCR0, 10 with the Fast PWM non inverting */
+#define CHECK_COM0_MASK                          ((uint8)(~TIMER0_COM0_MASK_CLEAR))
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static const Overcurrent_ConfigType g_checkConfig =
+{
+		CHECK_CHANNEL, CHECK_NOMINAL, CHECK_I2T_LIMIT, CHECK_RETRY_TICKS, CHECK_MAX_RETRIES,
+		(1<<DC_MOTOR_PWM_OC0)
+};
+
+static int g_checkFailed = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static void Check_report(const char * name, long value, long expected)
+{
+	printf("%s,%ld,%ld\n", name, value, expected);
+	if(value != expected)
+	{
+		fprintf(stderr, "overcurrent_check: %s %ld instead of %ld\n", name, value, expected);
+		g_checkFailed = 1;
+	}
+}
+
+static bool Check_pwmConnected(void)
+{
+	return (TIMER0_CONTROL_REGIRSTER & CHECK_COM0_MASK) != 0;
+}
+
+/*
+ * Description: control ticks until the state changes, CHECK_MAX_TICKS at most
+ */
+static long Check_ticksUntilChange(void)
+{
+	Overcurrent_State state = Overcurrent_getState();
+	long ticks = 0;
+
+	while( (Overcurrent_getState() == state) && (ticks < CHECK_MAX_TICKS) )
+	{
+		Overcurrent_update();
+		ticks++;
+	}
+
+	return ticks;
+}
+
+/*
+ * Description: I^2t to the limit, retries from half of it, then the latch
+ */
+static void Check_slowPath(void)
+{
+	const uint32 excess = (uint32)CHECK_CURRENT * CHECK_CURRENT - (uint32)CHECK_NOMINAL * CHECK_NOMINAL;
+	const long to_limit = (long)((CHECK_I2T_LIMIT + excess - 1) / excess);
+	const long to_retry_limit = (long)((CHECK_I2T_LIMIT - CHECK_I2T_LIMIT / 2 + excess - 1) / excess);
+	uint8 retry;
+
+	HostHal_setAdcInput(CHECK_CHANNEL, CHECK_CURRENT);
+
+	Check_report("slow_trip_ticks", Check_ticksUntilChange(), to_limit);
+	Check_report("slow_trip_pwm_connected", Check_pwmConnected(), FALSE);
+
+	for(retry = 0; retry < CHECK_MAX_RETRIES; retry++)
+	{
+		/* the delay, then the tick reconnecting */
+		Check_report("retry_ticks", Check_ticksUntilChange(), CHECK_RETRY_TICKS + 1);
+		Check_report("retry_pwm_connected", Check_pwmConnected(), TRUE);
+		Check_report("retry_trip_ticks", Check_ticksUntilChange(), to_retry_limit);
+	}
+
+	Check_report("latched", Check_ticksUntilChange() == 1 && Overcurrent_getState() == OVERCURRENT_LATCHED, TRUE);
+	Check_report("latched_pwm_connected", Check_pwmConnected(), FALSE);
+	Check_report("trips", Overcurrent_getTripsCount(), CHECK_MAX_RETRIES + 1);
+
+	HostHal_setAdcInput(CHECK_CHANNEL, 0);
+	Overcurrent_clearFault();
+	Check_report("cleared_pwm_connected", Check_pwmConnected(), TRUE);
+}
+
+/*
+ * Description: the sense voltage above the bandgap, the comparator output falls
+ */
+static void Check_fastPath(void)
+{
+	HostHal_setComparatorOutput(1);
+	HostHal_setComparatorOutput(0);
+
+	Check_report("fast_trip_state", Overcurrent_getState(), OVERCURRENT_TRIPPED);
+	Check_report("fast_trip_pwm_connected", Check_pwmConnected(), FALSE);
+	printf("fast_trip_latency_host_cycles,%u,\n", Overcurrent_getTripLatency());
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+int main(void)
+{
+	Timer_ConfigType pwm = {0};
+
+	HostHal_reset();
+	sei();
+
+	pwm.COM = Clear;
+	pwm.timer_ID = Timer0;
+	pwm.timer_clock = F_CPU_8;
+	pwm.timer_mode = FAST_PWM;
+	Timer_init(&pwm);
+	Timer_changeCompareValue(Timer0, 127, 0);
+	ADC_init();
+	Overcurrent_init(&g_checkConfig);
+
+	printf("name,value,expected\n");
+	Check_slowPath();
+	Check_fastPath();
+
+	return g_checkFailed;
+}
@@ -0,0 +1,238 @@
+/**********************************************************************************
+ * [FILE NAME]: profile_report.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Host tool turning the dumps of the profiler (Code/profiler.h)
+ *                into a flat profile of the main loop, one CSV line per
+ *                profiled function: calls, total, self, average and max
+ *                cycles, sorted by self time. The ids are repeated here so
+ *                the tool builds with the host compiler alone:
+ *
+ *                gcc -O2 -o profile_report Tools/profile_report.c
+ *                profile_report [uart_capture.txt] > profile.csv
+ *
+ *                The capture is read from stdin without a file, only the lines
+ *                "P<marker><time>" are used so the other output of the UART
+ *                can stay in it. The entries and exits are matched with a
+ *                stack, the self time of a call is its time minus the time of
+ *                the calls it made. An exit without its entry (the ring had
+ *                overwritten it) is skipped, so are the calls still open at
+ *                the end.
+ *
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/* Must match Code/profiler.h */
+#define PROFILER_EXIT_FLAG                       0X80
+#define PROFILER_TIME_BITS                       24
+
+#define REPORT_IDS                               (PROFILER_EXIT_FLAG)
+#define REPORT_STACK_SIZE                        32
+#define REPORT_LINE_SIZE                         256
+
+/*******************************************************************************
+ *                         Types Declaration                                   *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint8_t id;
+	uint64_t start;
+	uint64_t children;     /* cycles of the calls made by this one */
+
+}Report_FrameType;
+
+typedef struct
+{
+	uint32_t calls;
+	uint64_t total;
+	uint64_t self;
+	uint64_t max;
+
+}Report_StatsType;
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+/* Profiler_ID of Code/profiler.h, in order */
+static const char * const g_reportNames[] =
+{
+		"loop", "control", "sample", "utilization",
+		"button", "commands", "telemetry", "sleep",
+		"adc_read", "timer_compare",
+		"lcd_command", "lcd_character", "lcd_string",
+		"lcd_integer", "itoa"
+};
+
+static Report_StatsType g_reportStats[REPORT_IDS];
+static Report_FrameType g_reportStack[REPORT_STACK_SIZE];
+static int g_reportDepth = 0;
+static uint32_t g_reportSkipped = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+static void Report_enter(uint8_t id, uint64_t time)
+{
+	if(g_reportDepth == REPORT_STACK_SIZE)
+	{
+		g_reportSkipped++;
+		return;
+	}
+
+	g_reportStack[g_reportDepth].id = id;
+	g_reportStack[g_reportDepth].start = time;
+	g_reportStack[g_reportDepth].children = 0;
+	g_reportDepth++;
+}
+
+static void Report_exit(uint8_t id, uint64_t time)
+{
+	int depth = g_reportDepth;
+	Report_FrameType *frame_Ptr;
+	Report_StatsType *stats_Ptr;
+	uint64_t duration;
+
+	/* the calls above it lost their exit, they are dropped with their time */
+	while( (depth > 0) && (g_reportStack[depth - 1].id != id) )
+	{
+		depth--;
+	}
+	if(depth == 0)
+	{
+		g_reportSkipped++;
+		return;
+	}
+	g_reportSkipped += g_reportDepth - depth;
+	g_reportDepth = depth - 1;
+
+	frame_Ptr = &g_reportStack[g_reportDepth];
+	duration = time - frame_Ptr->start;
+	stats_Ptr = &g_reportStats[id];
+	stats_Ptr->calls++;
+	stats_Ptr->total += duration;
+	stats_Ptr->self += (duration > frame_Ptr->children) ? (duration - frame_Ptr->children) : 0;
+	if(duration > stats_Ptr->max)
+	{
+		stats_Ptr->max = duration;
+	}
+
+	if(g_reportDepth > 0)
+	{
+		g_reportStack[g_reportDepth - 1].children += duration;
+	}
+}
+
+static int Report_compareSelf(const void * a, const void * b)
+{
+	uint64_t self_a = g_reportStats[*(const uint8_t *)a].self;
+	uint64_t self_b = g_reportStats[*(const uint8_t *)b].self;
+
+	return (self_a < self_b) ? 1 : ((self_a > self_b) ? -1 : 0);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+int main(int argc, char * argv[])
+{
+	FILE *input = stdin;
+	char line[REPORT_LINE_SIZE];
+	unsigned int marker;
+	unsigned long stamp;
+	uint32_t previous = 0;
+	uint64_t time = 0;
+	uint64_t self_total = 0;
+	uint32_t markers = 0;
+	uint8_t order[REPORT_IDS];
+	int count = 0;
+	int i;
+	const char *name;
+	char unknown[8];
+
+	if(argc > 1)
+	{
+		input = fopen(argv[1], "r");
+		if(input == NULL)
+		{
+			perror(argv[1]);
+			return 1;
+		}
+	}
+
+	while(fgets(line, sizeof(line), input) != NULL)
+	{
+		if( (sscanf(line, "P%2x%6lx", &marker, &stamp) != 2) || (strlen(line) < 9) )
+		{
+			continue;
+		}
+
+		/* the time stamps wrap at 24 bits, the calls are much shorter */
+		time += ((uint32_t)stamp - previous) & ((1UL << PROFILER_TIME_BITS) - 1);
+		previous = (uint32_t)stamp;
+		markers++;
+
+		if(marker & PROFILER_EXIT_FLAG)
+		{
+			Report_exit((uint8_t)(marker & ~PROFILER_EXIT_FLAG), time);
+		}
+		else
+		{
+			Report_enter((uint8_t)marker, time);
+		}
+	}
+
+	if(input != stdin)
+	{
+		fclose(input);
+	}
+
+	for(i = 0; i < REPORT_IDS; i++)
+	{
+		if(g_reportStats[i].calls != 0)
+		{
+			order[count++] = (uint8_t)i;
+			self_total += g_reportStats[i].self;
+		}
+	}
+	qsort(order, count, sizeof(order[0]), Report_compareSelf);
+
+	printf("name,calls,total_cycles,self_cycles,self_percent,average_cycles,max_cycles\n");
+	for(i = 0; i < count; i++)
+	{
+		const Report_StatsType *stats_Ptr = &g_reportStats[order[i]];
+
+		if(order[i] < sizeof(g_reportNames) / sizeof(g_reportNames[0]))
+		{
+			name = g_reportNames[order[i]];
+		}
+		else
+		{
+			snprintf(unknown, sizeof(unknown), "id%u", order[i]);
+			name = unknown;
+		}
+		printf("%s,%lu,%llu,%llu,%.1f,%llu,%llu\n", name, (unsigned long)stats_Ptr->calls,
+				(unsigned long long)stats_Ptr->total, (unsigned long long)stats_Ptr->self,
+				(self_total != 0) ? (100.0 * stats_Ptr->self / self_total) : 0.0,
+				(unsigned long long)(stats_Ptr->total / stats_Ptr->calls), (unsigned long long)stats_Ptr->max);
+	}
+
+	fprintf(stderr, "profile_report: %lu markers, %lu skipped (entry or exit out of the ring)\n",
+			(unsigned long)markers, (unsigned long)(g_reportSkipped + g_reportDepth));
+
+	return 0;
+}
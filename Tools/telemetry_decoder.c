@@ -0,0 +1,252 @@
+/**********************************************************************************
+ * [FILE NAME]: telemetry_decoder.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 19, 2026
+ *
+ * [Description]: Host tool turning the telemetry stream of the USART
+ *                (Code/telemetry.h) into CSV, one line per valid frame.
+ *                The frame layout is repeated here so the tool builds with
+ *                the host compiler alone:
+ *
+ *                gcc -O2 -o telemetry_decoder Tools/telemetry_decoder.c
+ *                telemetry_decoder [-t tick_ms] [capture.bin] > telemetry.csv
+ *
+ *                The stream is read from stdin without a file, the values not
+ *                in a frame are empty. Frames with a bad CRC are skipped and
+ *                the decoder resynchronizes on the next sync byte, the counts
+ *                of bad and lost (sequence gaps) frames go to stderr.
+ *
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/* Must match Code/telemetry.h */
+#define TELEMETRY_SYNC                           0XA5
+#define TELEMETRY_FIELD_ADC                      (1<<0)
+#define TELEMETRY_FIELD_DUTY                     (1<<1)
+#define TELEMETRY_FIELD_DIRECTION                (1<<2)
+#define TELEMETRY_FIELD_SPEED                    (1<<3)
+#define TELEMETRY_FIELD_CURRENT                  (1<<4)
+#define TELEMETRY_FIELD_MEMORY                   (1<<5)
+#define TELEMETRY_FIELD_SECTIONS                 (1<<6)
+#define TELEMETRY_FIELDS_ALL                     0X7F
+#define TELEMETRY_HEADER_SIZE                    5
+#define TELEMETRY_MAX_FRAME_SIZE                 24
+
+/* Must match Code/crc8.h */
+#define CRC8_POLYNOMIAL                          0X07
+#define CRC8_INITIAL_VALUE                       0X00
+
+#define DEFAULT_TICK_MS                          4.0
+
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+
+static double g_tickMs = DEFAULT_TICK_MS;
+static unsigned long g_frames = 0;
+static unsigned long g_badFrames = 0;
+static unsigned long g_lostFrames = 0;
+static int g_firstFrame = 1;
+static uint8_t g_lastSequence = 0;
+static uint16_t g_lastTicks = 0;
+static uint64_t g_ticks = 0;
+
+/*******************************************************************************
+ *                      Private Functions                                      *
+ *******************************************************************************/
+
+/*
+ * Description: bit by bit CRC-8, independent of the table of the firmware
+ */
+static uint8_t crc8(const uint8_t *data, size_t length)
+{
+	uint8_t crc = CRC8_INITIAL_VALUE;
+	uint8_t bit;
+
+	while(length > 0)
+	{
+		crc ^= *data++;
+		for(bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0X80) ? (uint8_t)((crc << 1) ^ CRC8_POLYNOMIAL) : (uint8_t)(crc << 1);
+		}
+		length--;
+	}
+
+	return crc;
+}
+
+static size_t frameSize(uint8_t fields)
+{
+	size_t size = TELEMETRY_HEADER_SIZE + 1;
+
+	if(fields & TELEMETRY_FIELD_ADC)       size += 2;
+	if(fields & TELEMETRY_FIELD_DUTY)      size += 1;
+	if(fields & TELEMETRY_FIELD_DIRECTION) size += 1;
+	if(fields & TELEMETRY_FIELD_SPEED)     size += 2;
+	if(fields & TELEMETRY_FIELD_CURRENT)   size += 2;
+	if(fields & TELEMETRY_FIELD_MEMORY)    size += 4;
+	if(fields & TELEMETRY_FIELD_SECTIONS)  size += 6;
+
+	return size;
+}
+
+static uint16_t get16(const uint8_t *data)
+{
+	return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+/*
+ * Description: one CSV line of a valid frame, the time stamp is unwrapped
+ */
+static void printFrame(const uint8_t *frame)
+{
+	uint8_t sequence = frame[1];
+	uint8_t fields = frame[2];
+	uint16_t ticks = get16(&frame[3]);
+	const uint8_t *value = &frame[TELEMETRY_HEADER_SIZE];
+
+	if(g_firstFrame)
+	{
+		g_firstFrame = 0;
+		g_ticks = ticks;
+	}
+	else
+	{
+		g_lostFrames += (uint8_t)(sequence - g_lastSequence - 1);
+		g_ticks += (uint16_t)(ticks - g_lastTicks);
+	}
+	g_lastSequence = sequence;
+	g_lastTicks = ticks;
+	g_frames++;
+
+	printf("%u,%.3f,", sequence, (double)g_ticks * g_tickMs);
+
+	if(fields & TELEMETRY_FIELD_ADC)       { printf("%u", get16(value)); value += 2; }
+	printf(",");
+	if(fields & TELEMETRY_FIELD_DUTY)      { printf("%u", value[0]); value += 1; }
+	printf(",");
+	if(fields & TELEMETRY_FIELD_DIRECTION) { printf("%u", value[0]); value += 1; }
+	printf(",");
+	if(fields & TELEMETRY_FIELD_SPEED)     { printf("%d", (int16_t)get16(value)); value += 2; }
+	printf(",");
+	if(fields & TELEMETRY_FIELD_CURRENT)   { printf("%u", get16(value)); value += 2; }
+	printf(",");
+	if(fields & TELEMETRY_FIELD_MEMORY)    { printf("%u", get16(value)); value += 2; }
+	printf(",");
+	if(fields & TELEMETRY_FIELD_MEMORY)    { printf("%u", get16(value)); value += 2; }
+	printf(",");
+	if(fields & TELEMETRY_FIELD_SECTIONS)  { printf("%u", get16(value)); value += 2; }
+	printf(",");
+	if(fields & TELEMETRY_FIELD_SECTIONS)  { printf("%u", get16(value)); value += 2; }
+	printf(",");
+	if(fields & TELEMETRY_FIELD_SECTIONS)  { printf("%u", get16(value)); value += 2; }
+	printf("\n");
+}
+
+/*
+ * Description: decode the frames at the start of the buffer
+ *              Returns the number of bytes used, the rest waits for more data
+ */
+static size_t decode(const uint8_t *buffer, size_t length)
+{
+	size_t used = 0;
+	size_t size;
+
+	while(used < length)
+	{
+		if(buffer[used] != TELEMETRY_SYNC)
+		{
+			used++;
+			continue;
+		}
+		if(length - used < TELEMETRY_HEADER_SIZE)
+		{
+			break;
+		}
+		if(buffer[used + 2] & ~TELEMETRY_FIELDS_ALL)
+		{
+			used++; /* not a header */
+			continue;
+		}
+
+		size = frameSize(buffer[used + 2]);
+		if(length - used < size)
+		{
+			break;
+		}
+
+		if(crc8(&buffer[used + 1], size - 2) == buffer[used + size - 1])
+		{
+			printFrame(&buffer[used]);
+			used += size;
+		}
+		else
+		{
+			g_badFrames++;
+			used++; /* the sync byte was a value, look again from the next one */
+		}
+	}
+
+	return used;
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+	uint8_t buffer[4096];
+	size_t length = 0;
+	size_t count;
+	size_t used;
+	FILE *input = stdin;
+	int i;
+
+	for(i = 1; i < argc; i++)
+	{
+		if( (strcmp(argv[i], "-t") == 0) && (i + 1 < argc) )
+		{
+			g_tickMs = atof(argv[++i]);
+		}
+		else if(argv[i][0] == '-')
+		{
+			fprintf(stderr, "usage: %s [-t tick_ms] [capture.bin]\n", argv[0]);
+			return 1;
+		}
+		else
+		{
+			input = fopen(argv[i], "rb");
+			if(input == NULL)
+			{
+				perror(argv[i]);
+				return 1;
+			}
+		}
+	}
+
+	printf("sequence,time_ms,adc,duty,direction,speed,current,stack,ram_free,data,bss,heap\n");
+
+	while((count = fread(&buffer[length], 1, sizeof(buffer) - length, input)) > 0)
+	{
+		length += count;
+		used = decode(buffer, length);
+		memmove(buffer, &buffer[used], length - used);
+		length -= used;
+	}
+
+	fprintf(stderr, "telemetry: %lu frames, %lu bad, %lu lost\n", g_frames, g_badFrames, g_lostFrames);
+
+	return 0;
+}